@@ -42,7 +42,7 @@ public:
    * @return `ApiToken` Token object if record exists
    */
   std::unique_ptr<ApiToken> get(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, owner, hash, createdAt, expiresAt, status, service, invalidatedAt
       FROM api_tokens
@@ -50,11 +50,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, id);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<ApiToken>(ApiToken::fromResult(stmt));
+    return std::make_unique<ApiToken>(ApiToken::fromResult(*stmt));
   }
 
   /**
@@ -66,7 +66,7 @@ public:
    * @return `std::vector<ApiToken>` API token objects
    */
   std::vector<ApiToken> list() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, owner, hash, createdAt, expiresAt, status, service, invalidatedAt
       FROM api_tokens
@@ -74,8 +74,8 @@ public:
       )"
     );
     std::vector<ApiToken> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(ApiToken::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(ApiToken::fromResult(*stmt));
     }
     return vec;
   }
@@ -88,20 +88,20 @@ public:
    * @return `uint32_t` API token record iD
    */
   uint32_t insert(const ApiToken& apiToken) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO api_tokens (owner, hash, createdAt, expiresAt, status, service)
       VALUES (?, ?, ?, ?, ?, ?);
       )"
     );
-    stmt.bind(1, apiToken.getOwner());
-    stmt.bind(2, apiToken.getHash());
-    stmt.bind(3, DatetimeParser::toISO8601(apiToken.getCreatedAt()));
-    stmt.bind(4, DatetimeParser::toISO8601(apiToken.getExpiresAt()));
-    stmt.bind(5, static_cast<int>(apiToken.getStatus()));
-    stmt.bind(6, apiToken.canUseServiceMode());
+    stmt->bind(1, apiToken.getOwner());
+    stmt->bind(2, apiToken.getHash());
+    stmt->bind(3, DatetimeParser::toISO8601(apiToken.getCreatedAt()));
+    stmt->bind(4, DatetimeParser::toISO8601(apiToken.getExpiresAt()));
+    stmt->bind(5, static_cast<int>(apiToken.getStatus()));
+    stmt->bind(6, apiToken.canUseServiceMode());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -123,21 +123,21 @@ public:
    * @return `uint32_t` API token record ID
    */
   uint32_t insertWithId(const ApiToken& apiToken) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO api_tokens (id, owner, hash, createdAt, expiresAt, status, service)
       VALUES (?, ?, ?, ?, ?, ?, ?);
       )"
     );
-    stmt.bind(1, apiToken.getId());
-    stmt.bind(2, apiToken.getOwner());
-    stmt.bind(3, apiToken.getHash());
-    stmt.bind(4, DatetimeParser::toISO8601(apiToken.getCreatedAt()));
-    stmt.bind(5, DatetimeParser::toISO8601(apiToken.getExpiresAt()));
-    stmt.bind(6, static_cast<int>(apiToken.getStatus()));
-    stmt.bind(7, apiToken.canUseServiceMode());
+    stmt->bind(1, apiToken.getId());
+    stmt->bind(2, apiToken.getOwner());
+    stmt->bind(3, apiToken.getHash());
+    stmt->bind(4, DatetimeParser::toISO8601(apiToken.getCreatedAt()));
+    stmt->bind(5, DatetimeParser::toISO8601(apiToken.getExpiresAt()));
+    stmt->bind(6, static_cast<int>(apiToken.getStatus()));
+    stmt->bind(7, apiToken.canUseServiceMode());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -158,7 +158,7 @@ public:
    * @param token API token object
    */
   void update(const ApiToken &token) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
         UPDATE api_tokens
         SET status = ?, invalidatedAt = ?
@@ -166,11 +166,11 @@ public:
       )"
     );
     auto invalidated_at = token.getInvalidatedAt();
-    stmt.bind(1, static_cast<int>(token.getStatus()));
-    stmt.bind(2, invalidated_at.has_value() ? DatetimeParser::toISO8601(invalidated_at.value()) : nullptr);
-    stmt.bind(3, token.getId());
+    stmt->bind(1, static_cast<int>(token.getStatus()));
+    stmt->bind(2, invalidated_at.has_value() ? DatetimeParser::toISO8601(invalidated_at.value()) : nullptr);
+    stmt->bind(3, token.getId());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -188,18 +188,18 @@ public:
    * @param now Revocation timestamp
    */
   bool revoke(uint32_t id, const std::chrono::system_clock::time_point &now) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       UPDATE api_tokens
       SET status = ?, invalidatedAt = ?
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, static_cast<int>(ApiToken::Status::Revoked));
-    stmt.bind(2, DatetimeParser::toISO8601(now));
-    stmt.bind(3, id);
+    stmt->bind(1, static_cast<int>(ApiToken::Status::Revoked));
+    stmt->bind(2, DatetimeParser::toISO8601(now));
+    stmt->bind(3, id);
     try {
-      auto changes = stmt.exec();
+      auto changes = stmt->exec();
       return changes != 0;
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
@@ -219,14 +219,14 @@ public:
    * @param id Record ID
    */
   void remove(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM api_tokens
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, id);
-    stmt.exec();
+    stmt->bind(1, id);
+    stmt->exec();
   }
 };
 
@@ -18,8 +18,10 @@
 
 #include <cstddef>
 #include <memory>
+#include <stdexcept>
 
 #include <SQLiteCpp/SQLiteCpp.h>
+#include <repositories/statement_cache.hpp>
 
 namespace iqrf::db::repos {
 
@@ -32,8 +34,14 @@ public:
    * Constructor
    *
    * @param db Shared pointer to database connection
+   * @param statementCache Prepared statement cache of the connection, statements are prepared for each query if not set
    */
-  explicit BaseRepository(std::shared_ptr<SQLite::Database> db) : m_db(db) {}
+  explicit BaseRepository(std::shared_ptr<SQLite::Database> db, std::shared_ptr<StatementCache> statementCache = nullptr)
+    : m_db(db), m_statementCache(statementCache) {
+    if (m_statementCache && m_statementCache->getDatabase() != m_db) {
+      throw std::invalid_argument("Statement cache belongs to another database connection.");
+    }
+  }
 
   /**
    * Destructor
@@ -68,8 +76,26 @@ protected:
     return placeholder;
   }
 
+  /**
+   * Returns statement of query with constant text, reused from statement cache if repository has one
+   *
+   * Statement is reset and its bindings cleared once the returned lease is destroyed.
+   * Queries with generated text (e.g. placeholder lists) should construct `SQLite::Statement` directly.
+   *
+   * @param query Query text
+   * @return Statement lease
+   */
+  StatementCache::Lease prepare(const std::string &query) {
+    if (m_statementCache) {
+      return m_statementCache->acquire(query);
+    }
+    return StatementCache::Lease(std::make_unique<SQLite::Statement>(*m_db, query));
+  }
+
   /// Database connection container
   std::shared_ptr<SQLite::Database> m_db;
+  /// Prepared statement cache of database connection
+  std::shared_ptr<StatementCache> m_statementCache;
 };
 
 }
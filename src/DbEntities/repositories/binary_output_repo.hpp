@@ -41,7 +41,7 @@ public:
    * @return Pointer to deserialized `BinaryOutput` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<BinaryOutput> get(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, deviceId, count
       FROM bo
@@ -49,11 +49,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, id);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<BinaryOutput>(BinaryOutput::fromResult(stmt));
+    return std::make_unique<BinaryOutput>(BinaryOutput::fromResult(*stmt));
   }
 
   /**
@@ -62,15 +62,15 @@ public:
    * @return Vector of deserialized `BinaryOutput` objects
    */
   std::vector<BinaryOutput> getAll() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, deviceId, count
       FROM bo;
       )"
     );
     std::vector<BinaryOutput> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(BinaryOutput::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(BinaryOutput::fromResult(*stmt));
     }
     return vec;
   }
@@ -82,7 +82,7 @@ public:
    * @return Pointer to deserialized `BinaryOutput` object, or `nullptr` if record does not exist
    */
   std::optional<BinaryOutput> getByDeviceId(uint32_t deviceId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, deviceId, count
       FROM bo
@@ -90,11 +90,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, deviceId);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, deviceId);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return BinaryOutput::fromResult(stmt);
+    return BinaryOutput::fromResult(*stmt);
   }
 
   /**
@@ -107,16 +107,16 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   uint32_t insert(uint32_t deviceId, uint8_t count) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO bo (deviceId, count)
       VALUES (?, ?);
       )"
     );
-    stmt.bind(1, deviceId);
-    stmt.bind(2, count);
+    stmt->bind(1, deviceId);
+    stmt->bind(2, count);
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -136,18 +136,18 @@ public:
    * @throws `std::runtime_error` If the record cannot be updated
    */
   void update(const BinaryOutput &binaryOutput) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       UPDATE bo
       SET deviceId = ?, count = ?
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, binaryOutput.getDeviceId());
-    stmt.bind(2, binaryOutput.getCount());
-    stmt.bind(3, binaryOutput.getId());
+    stmt->bind(1, binaryOutput.getDeviceId());
+    stmt->bind(2, binaryOutput.getCount());
+    stmt->bind(3, binaryOutput.getId());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -164,14 +164,14 @@ public:
    * @param id Record ID
    */
   void remove(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM bo
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, id);
-    stmt.exec();
+    stmt->bind(1, id);
+    stmt->exec();
   }
 
   /**
@@ -180,14 +180,14 @@ public:
    * @param deviceId Device ID
    */
   void removeByDeviceId(uint32_t deviceId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM bo
       WHERE deviceId = ?;
       )"
     );
-    stmt.bind(1, deviceId);
-    stmt.exec();
+    stmt->bind(1, deviceId);
+    stmt->exec();
   }
 
   /**
@@ -196,7 +196,7 @@ public:
    * @return Set of device addresses
    */
   std::set<uint8_t> getAddresses() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT d.address
       FROM bo as b
@@ -204,8 +204,8 @@ public:
       )"
     );
     std::set<uint8_t> addrs;
-    while(stmt.executeStep()) {
-      addrs.insert(static_cast<uint8_t>(stmt.getColumn(0).getUInt()));
+    while(stmt->executeStep()) {
+      addrs.insert(static_cast<uint8_t>(stmt->getColumn(0).getUInt()));
     }
     return addrs;
   }
@@ -216,7 +216,7 @@ public:
    * @return Map of device addresses and binary outputs count
    */
   std::map<uint8_t, uint8_t> getAddressCountMap() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT d.address, b.count
       FROM bo as b
@@ -224,11 +224,11 @@ public:
       )"
     );
     std::map<uint8_t, uint8_t> map;
-    while(stmt.executeStep()) {
+    while(stmt->executeStep()) {
       map.insert(
         std::make_pair(
-          static_cast<uint8_t>(stmt.getColumn(0).getUInt()),
-          static_cast<uint8_t>(stmt.getColumn(1).getUInt())
+          static_cast<uint8_t>(stmt->getColumn(0).getUInt()),
+          static_cast<uint8_t>(stmt->getColumn(1).getUInt())
         )
       );
     }
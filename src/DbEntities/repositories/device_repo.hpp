@@ -44,7 +44,7 @@ public:
    * @return Pointer to deserialized `Device` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Device> get(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, address, discovered, mid, vrn, zone, parent, enumerated, productId, metadata
       FROM device
@@ -52,11 +52,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, id);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Device>(Device::fromResult(stmt));
+    return std::make_unique<Device>(Device::fromResult(*stmt));
   }
 
   /**
@@ -65,7 +65,7 @@ public:
    * @return Vector of deserialized `Device` objects
    */
   std::vector<Device> getAll() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, address, discovered, mid, vrn, zone, parent, enumerated, productId, metadata
       FROM device
@@ -73,8 +73,8 @@ public:
       )"
     );
     std::vector<Device> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(Device::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(Device::fromResult(*stmt));
     }
     return vec;
   }
@@ -114,7 +114,7 @@ public:
    * @return Pointer to deserialized `Device` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Device> getByAddress(uint8_t addr) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, address, discovered, mid, vrn, zone, parent, enumerated, productId, metadata
       FROM device
@@ -122,11 +122,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, addr);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, addr);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Device>(Device::fromResult(stmt));
+    return std::make_unique<Device>(Device::fromResult(*stmt));
   }
 
   /**
@@ -136,7 +136,7 @@ public:
    * @return Pointer to deserialized `Device` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Device> getByMid(const uint32_t mid) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, address, discovered, mid, vrn, zone, parent, enumerated, productId, metadata
       FROM device
@@ -144,11 +144,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, mid);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, mid);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Device>(Device::fromResult(stmt));
+    return std::make_unique<Device>(Device::fromResult(*stmt));
   }
 
   /**
@@ -160,31 +160,31 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   uint32_t insert(const Device &device) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO device (address, discovered, mid, vrn, zone, parent, enumerated, productId, metadata)
       VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);
       )"
     );
-    stmt.bind(1, device.getAddress());
-    stmt.bind(2, device.isDiscovered());
-    stmt.bind(3, device.getMid());
-    stmt.bind(4, device.getVrn());
-    stmt.bind(5, device.getZone());
+    stmt->bind(1, device.getAddress());
+    stmt->bind(2, device.isDiscovered());
+    stmt->bind(3, device.getMid());
+    stmt->bind(4, device.getVrn());
+    stmt->bind(5, device.getZone());
     if (device.getParent() == std::nullopt) {
-      stmt.bind(6);
+      stmt->bind(6);
     } else {
-      stmt.bind(6, device.getParent().value());
+      stmt->bind(6, device.getParent().value());
     }
-    stmt.bind(7, device.isEnumerated());
-    stmt.bind(8, device.getProductId());
+    stmt->bind(7, device.isEnumerated());
+    stmt->bind(8, device.getProductId());
     if (device.getMetadata() == nullptr) {
-      stmt.bind(9);
+      stmt->bind(9);
     } else {
-      stmt.bind(9, *device.getMetadata());
+      stmt->bind(9, *device.getMetadata());
     }
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -204,7 +204,7 @@ public:
    * @throws `std::runtime_error` If the record cannot be updated
    */
   void update(const Device &device) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       UPDATE device
       SET address = ?, discovered = ?, mid = ?, vrn = ?, zone = ?, parent = ?, enumerated = ?, productId = ?,
@@ -212,26 +212,26 @@ public:
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, device.getAddress());
-    stmt.bind(2, device.isDiscovered());
-    stmt.bind(3, device.getMid());
-    stmt.bind(4, device.getVrn());
-    stmt.bind(5, device.getZone());
+    stmt->bind(1, device.getAddress());
+    stmt->bind(2, device.isDiscovered());
+    stmt->bind(3, device.getMid());
+    stmt->bind(4, device.getVrn());
+    stmt->bind(5, device.getZone());
     if (device.getParent() == std::nullopt) {
-      stmt.bind(6);
+      stmt->bind(6);
     } else {
-      stmt.bind(6, device.getParent().value());
+      stmt->bind(6, device.getParent().value());
     }
-    stmt.bind(7, device.isEnumerated());
-    stmt.bind(8, device.getProductId());
+    stmt->bind(7, device.isEnumerated());
+    stmt->bind(8, device.getProductId());
     if (device.getMetadata() == nullptr) {
-      stmt.bind(9);
+      stmt->bind(9);
     } else {
-      stmt.bind(9, *device.getMetadata());
+      stmt->bind(9, *device.getMetadata());
     }
-    stmt.bind(10, device.getId());
+    stmt->bind(10, device.getId());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -248,14 +248,14 @@ public:
    * @param id Record ID
    */
   void remove(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM device
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, id);
-    stmt.exec();
+    stmt->bind(1, id);
+    stmt->exec();
   }
 
   /**
@@ -265,9 +265,9 @@ public:
    */
   std::set<uint8_t> getAddresses() {
     std::set<uint8_t> addrs;
-    SQLite::Statement stmt(*m_db, "SELECT d.address FROM device as d");
-    while(stmt.executeStep()) {
-      addrs.insert(static_cast<uint8_t>(stmt.getColumn(0).getUInt()));
+    auto stmt = prepare( "SELECT d.address FROM device as d");
+    while(stmt->executeStep()) {
+      addrs.insert(static_cast<uint8_t>(stmt->getColumn(0).getUInt()));
     }
     return addrs;
   }
@@ -280,7 +280,7 @@ public:
    * @return Optional value container, HWPID if record exists, `std::nullopt` otherwise
    */
   std::optional<uint16_t> getHwpidByAddress(uint8_t addr) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT p.hwpid
       FROM product as p INNER JOIN device as d
@@ -289,11 +289,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, addr);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, addr);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return static_cast<uint16_t>(stmt.getColumn(0).getUInt());
+    return static_cast<uint16_t>(stmt->getColumn(0).getUInt());
   }
 
   /**
@@ -304,7 +304,7 @@ public:
    * @return Optional value container, MID if record exists, `std::nullopt` otherwise
    */
   std::optional<uint32_t> getMidByAddress(uint8_t addr) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT mid
       FROM device
@@ -312,11 +312,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, addr);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, addr);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return stmt.getColumn(0).getUInt();
+    return stmt->getColumn(0).getUInt();
   }
 
   /**
@@ -327,7 +327,7 @@ public:
    * @return Pointer to serialized metadata object, or `nullptr` if record does not exist
    */
   std::shared_ptr<std::string> getMetadataByAddress(uint8_t addr) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT metadata
       FROM device
@@ -335,11 +335,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, addr);
-    if (!stmt.executeStep() || stmt.getColumn(0).isNull()) {
+    stmt->bind(1, addr);
+    if (!stmt->executeStep() || stmt->getColumn(0).isNull()) {
       return nullptr;
     } else {
-      return std::make_shared<std::string>(stmt.getColumn(0).getString());
+      return std::make_shared<std::string>(stmt->getColumn(0).getString());
     }
   }
 
@@ -351,7 +351,7 @@ public:
    * @return `true` if device implements peripheral, `false` otherwise
    */
   bool implementsPeripheral(uint32_t id, int16_t peripheral) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT COUNT(*)
       FROM device as d
@@ -360,12 +360,12 @@ public:
       WHERE d.id = ? and drv.peripheralNumber = ?
       )"
     );
-    stmt.bind(1, id);
-    stmt.bind(2, peripheral);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    stmt->bind(2, peripheral);
+    if (!stmt->executeStep()) {
       return false;
     }
-    return stmt.getColumn(0).getUInt() > 0;
+    return stmt->getColumn(0).getUInt() > 0;
   }
 
   /**
@@ -374,17 +374,17 @@ public:
    * @return Map of device addresses and product IDs
    */
   std::map<uint8_t, uint32_t> getAddressProductIdMap() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT address, productId
       FROM device;
       )"
     );
     std::map<uint8_t, uint32_t> map;
-    while (stmt.executeStep()) {
+    while (stmt->executeStep()) {
       map.insert_or_assign(
-          static_cast<uint8_t>(stmt.getColumn(0).getUInt()),
-          stmt.getColumn(1).getUInt()
+          static_cast<uint8_t>(stmt->getColumn(0).getUInt()),
+          stmt->getColumn(1).getUInt()
       );
     }
     return map;
@@ -397,17 +397,17 @@ public:
    * @return Set of device addresses
    */
   std::set<uint8_t> getProductAddresses(uint32_t productId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT address
       FROM device
       WHERE productId = ?;
       )"
     );
-    stmt.bind(1, productId);
+    stmt->bind(1, productId);
     std::set<uint8_t> set;
-    while (stmt.executeStep()) {
-      set.insert(static_cast<uint8_t>(stmt.getColumn(0).getUInt()));
+    while (stmt->executeStep()) {
+      set.insert(static_cast<uint8_t>(stmt->getColumn(0).getUInt()));
     }
     return set;
   }
@@ -418,7 +418,7 @@ public:
    * @return Map of device addresses and MID/HWPID objects
    */
   std::map<uint8_t, iqrf::embed::node::NodeMidHwpid> getNodeMidHwpidMap() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT d.address, d.mid, p.hwpid
       FROM device as d
@@ -427,13 +427,13 @@ public:
       )"
     );
     std::map<uint8_t, iqrf::embed::node::NodeMidHwpid> map;
-    while (stmt.executeStep()) {
+    while (stmt->executeStep()) {
       map.insert(
         std::make_pair(
-          static_cast<uint8_t>(stmt.getColumn(0).getUInt()),
+          static_cast<uint8_t>(stmt->getColumn(0).getUInt()),
           iqrf::embed::node::NodeMidHwpid(
-            stmt.getColumn(1).getUInt(),
-            static_cast<uint16_t>(stmt.getColumn(2).getUInt())
+            stmt->getColumn(1).getUInt(),
+            static_cast<uint16_t>(stmt->getColumn(2).getUInt())
           )
         )
       );
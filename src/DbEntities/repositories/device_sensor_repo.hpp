@@ -29,6 +29,20 @@ using iqrf::db::models::Sensor;
 
 namespace iqrf::db::repos {
 
+/**
+ * Device sensor value update
+ */
+struct DeviceSensorValue {
+  /// Device address
+  uint8_t address;
+  /// Sensor type
+  uint8_t type;
+  /// Sensor global index, or type index if updated from FRC
+  uint8_t index;
+  /// Sensor value
+  double value;
+};
+
 /**
  * Device sensor repository
  */
@@ -36,6 +50,26 @@ class DeviceSensorRepository : public BaseRepository {
 public:
   using BaseRepository::BaseRepository;
 
+  /**
+   * @brief Lists all device sensor records
+   *
+   * @return Vector of deserialized `DeviceSensor` objects ordered by device address and global index
+   */
+  std::vector<DeviceSensor> getAll() {
+    auto stmt = prepare(
+      R"(
+      SELECT address, type, globalIndex, typeIndex, sensorId, value, updated, metadata
+      FROM deviceSensor
+      ORDER BY address ASC, globalIndex ASC;
+      )"
+    );
+    std::vector<DeviceSensor> vec;
+    while (stmt->executeStep()) {
+      vec.emplace_back(DeviceSensor::fromResult(*stmt));
+    }
+    return vec;
+  }
+
   /**
    * @brief Finds device sensor record by device address, sensor type and sensor index
    *
@@ -48,25 +82,25 @@ public:
    */
   std::unique_ptr<DeviceSensor> getByAddressTypeIndex(uint8_t address, uint8_t type, uint8_t index, bool frc) {
     if (frc) {
-      SQLite::Statement stmt(*m_db,
+      auto stmt = prepare(
         R"(
         SELECT address, type, globalIndex, typeIndex, sensorId, value, updated, metadata
         FROM deviceSensor
         WHERE address = ? AND type = ?;
         )"
       );
-      stmt.bind(1, address);
-      stmt.bind(2, type);
+      stmt->bind(1, address);
+      stmt->bind(2, type);
       std::vector<DeviceSensor> vector;
-      while (stmt.executeStep()) {
-        vector.push_back(DeviceSensor::fromResult(stmt));
+      while (stmt->executeStep()) {
+        vector.push_back(DeviceSensor::fromResult(*stmt));
       }
       if (index >= vector.size()) {
         return nullptr;
       }
       return std::make_unique<DeviceSensor>(vector[index]);
     } else {
-      SQLite::Statement stmt(*m_db,
+      auto stmt = prepare(
         R"(
         SELECT address, type, globalIndex, typeIndex, sensorId, value, updated, metadata
         FROM deviceSensor
@@ -74,13 +108,13 @@ public:
         LIMIT 1;
         )"
       );
-      stmt.bind(1, address);
-      stmt.bind(2, type);
-      stmt.bind(3, index);
-      if (!stmt.executeStep()) {
+      stmt->bind(1, address);
+      stmt->bind(2, type);
+      stmt->bind(3, index);
+      if (!stmt->executeStep()) {
         return nullptr;
       }
-      return std::make_unique<DeviceSensor>(DeviceSensor::fromResult(stmt));
+      return std::make_unique<DeviceSensor>(DeviceSensor::fromResult(*stmt));
     }
   }
 
@@ -92,34 +126,34 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   void insert(const DeviceSensor &deviceSensor) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO deviceSensor (address, type, globalIndex, typeIndex, sensorId, value, updated, metadata)
       VALUES (?, ?, ?, ?, ?, ?, ?, ?);
       )"
     );
-    stmt.bind(1, deviceSensor.getAddress());
-    stmt.bind(2, deviceSensor.getType());
-    stmt.bind(3, deviceSensor.getGlobalIndex());
-    stmt.bind(4, deviceSensor.getTypeIndex());
-    stmt.bind(5, deviceSensor.getSensorId());
+    stmt->bind(1, deviceSensor.getAddress());
+    stmt->bind(2, deviceSensor.getType());
+    stmt->bind(3, deviceSensor.getGlobalIndex());
+    stmt->bind(4, deviceSensor.getTypeIndex());
+    stmt->bind(5, deviceSensor.getSensorId());
     if (deviceSensor.getValue() == std::nullopt) {
-      stmt.bind(6);
+      stmt->bind(6);
     } else {
-      stmt.bind(6, deviceSensor.getValue().value());
+      stmt->bind(6, deviceSensor.getValue().value());
     }
     if (deviceSensor.getUpdated() == nullptr) {
-      stmt.bind(7);
+      stmt->bind(7);
     } else {
-      stmt.bind(7, *deviceSensor.getUpdated());
+      stmt->bind(7, *deviceSensor.getUpdated());
     }
     if (deviceSensor.getMetadata() == nullptr) {
-      stmt.bind(8);
+      stmt->bind(8);
     } else {
-      stmt.bind(8, *deviceSensor.getMetadata());
+      stmt->bind(8, *deviceSensor.getMetadata());
     }
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -138,7 +172,7 @@ public:
    * @throws `std::runtime_error` If the record cannot be updated
    */
   void update(const DeviceSensor &deviceSensor) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       UPDATE deviceSensor
       SET value = ?, updated = ?, metadata = ?
@@ -146,25 +180,25 @@ public:
       )"
     );
     if (deviceSensor.getValue() == std::nullopt) {
-      stmt.bind(1);
+      stmt->bind(1);
     } else {
-      stmt.bind(1, deviceSensor.getValue().value());
+      stmt->bind(1, deviceSensor.getValue().value());
     }
     if (deviceSensor.getUpdated() == nullptr) {
-      stmt.bind(2);
+      stmt->bind(2);
     } else {
-      stmt.bind(2, *deviceSensor.getUpdated());
+      stmt->bind(2, *deviceSensor.getUpdated());
     }
     if (deviceSensor.getMetadata() == nullptr) {
-      stmt.bind(3);
+      stmt->bind(3);
     } else {
-      stmt.bind(3, *deviceSensor.getMetadata());
+      stmt->bind(3, *deviceSensor.getMetadata());
     }
-    stmt.bind(4, deviceSensor.getAddress());
-    stmt.bind(5, deviceSensor.getType());
-    stmt.bind(6, deviceSensor.getGlobalIndex());
+    stmt->bind(4, deviceSensor.getAddress());
+    stmt->bind(5, deviceSensor.getType());
+    stmt->bind(6, deviceSensor.getGlobalIndex());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -176,6 +210,116 @@ public:
     }
   }
 
+  /**
+   * @brief Updates metadata of existing device sensor record
+   *
+   * Sensor value is left untouched, so that metadata can be stored while the value is pending in write-behind store.
+   *
+   * @param deviceSensor Device sensor object
+   * @param setUpdated Store update timestamp along with metadata
+   *
+   * @throws `std::runtime_error` If the record cannot be updated
+   */
+  void updateMetadata(const DeviceSensor &deviceSensor, bool setUpdated) {
+    auto stmt = prepare(setUpdated ?
+      R"(
+      UPDATE deviceSensor
+      SET metadata = ?, updated = ?
+      WHERE address = ? AND type = ? AND globalIndex = ?;
+      )" :
+      R"(
+      UPDATE deviceSensor
+      SET metadata = ?
+      WHERE address = ? AND type = ? AND globalIndex = ?;
+      )"
+    );
+    if (deviceSensor.getMetadata() == nullptr) {
+      stmt->bind(1);
+    } else {
+      stmt->bind(1, *deviceSensor.getMetadata());
+    }
+    if (setUpdated) {
+      if (deviceSensor.getUpdated() == nullptr) {
+        stmt->bind(2);
+      } else {
+        stmt->bind(2, *deviceSensor.getUpdated());
+      }
+    }
+    const int key = setUpdated ? 3 : 2;
+    stmt->bind(key, deviceSensor.getAddress());
+    stmt->bind(key + 1, deviceSensor.getType());
+    stmt->bind(key + 2, deviceSensor.getGlobalIndex());
+    try {
+      stmt->exec();
+    } catch (const SQLite::Exception &e) {
+      throw std::runtime_error(
+        this->formatErrorMessage(
+          "Failed to update DeviceSensor metadata at address " + std::to_string(deviceSensor.getAddress())
+            + ", type " + std::to_string(deviceSensor.getType()) + ", index " + std::to_string(deviceSensor.getGlobalIndex()),
+          e.what()
+        )
+      );
+    }
+  }
+
+  /**
+   * @brief Updates values of multiple device sensor records
+   *
+   * Records are updated by a single prepared statement and share the update timestamp, the statement
+   * does not open a transaction of its own so that callers can apply the whole batch in one transaction.
+   *
+   * @param values Sensor values
+   * @param updated Update timestamp
+   * @param frc Values are indexed by sensor type index (FRC indexing)
+   *
+   * @return Values of sensors that have no record
+   *
+   * @throws `std::runtime_error` If a record cannot be updated
+   */
+  std::vector<DeviceSensorValue> updateValues(const std::vector<DeviceSensorValue> &values,
+    const std::shared_ptr<std::string> &updated, bool frc) {
+    auto stmt = prepare(frc ?
+      R"(
+      UPDATE deviceSensor
+      SET value = ?, updated = ?
+      WHERE address = ? AND type = ? AND typeIndex = ?;
+      )" :
+      R"(
+      UPDATE deviceSensor
+      SET value = ?, updated = ?
+      WHERE address = ? AND type = ? AND globalIndex = ?;
+      )"
+    );
+    // timestamp binding is kept by statement reset
+    if (updated == nullptr) {
+      stmt->bind(2);
+    } else {
+      stmt->bind(2, *updated);
+    }
+    std::vector<DeviceSensorValue> missing;
+    for (const auto &item : values) {
+      stmt->bind(1, item.value);
+      stmt->bind(3, item.address);
+      stmt->bind(4, item.type);
+      stmt->bind(5, item.index);
+      try {
+        if (stmt->exec() == 0) {
+          missing.push_back(item);
+        }
+        stmt->reset();
+      } catch (const SQLite::Exception &e) {
+        throw std::runtime_error(
+          this->formatErrorMessage(
+            "Failed to update DeviceSensor value at address " + std::to_string(item.address)
+              + ", type " + std::to_string(item.type) + ", index " + std::to_string(item.index),
+            e.what()
+          )
+        );
+      }
+    }
+    return missing;
+  }
+
   /**
    * @brief Remove device sensor record by device address and sensor index
    *
@@ -183,15 +327,15 @@ public:
    * @param index Sensor index
    */
   void removeByAddressIndex(uint8_t addr, uint8_t index) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM deviceSensor
       WHERE address = ? AND globalIndex = ?;
       )"
     );
-    stmt.bind(1, addr);
-    stmt.bind(2, index);
-    stmt.exec();
+    stmt->bind(1, addr);
+    stmt->bind(2, index);
+    stmt->exec();
   }
 
   /**
@@ -202,14 +346,14 @@ public:
    * @param addr Device address
    */
   void removeMultipleByAddress(uint8_t addr) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM deviceSensor
       WHERE address = ?;
       )"
     );
-    stmt.bind(1, addr);
-    stmt.exec();
+    stmt->bind(1, addr);
+    stmt->exec();
   }
 
   /**
@@ -238,7 +382,7 @@ public:
    */
   std::map<uint8_t, std::vector<std::pair<uint8_t, Sensor>>> getDeviceAddressIndexSensorMap() {
     std::map<uint8_t, std::vector<std::pair<uint8_t, Sensor>>> map;
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT s.id, s.type, s.name, s.shortname, s.unit, s.decimals, s.frc2bit, s.frc1Byte, s.frc2Byte, s.frc4Byte,
           ds.address, ds.globalIndex
@@ -249,22 +393,22 @@ public:
       )"
     );
     std::vector<std::pair<uint8_t, Sensor>> vector;
-    while (stmt.executeStep()) {
-      const uint8_t addr = static_cast<uint8_t>(stmt.getColumn(10).getUInt());
+    while (stmt->executeStep()) {
+      const uint8_t addr = static_cast<uint8_t>(stmt->getColumn(10).getUInt());
       if (map.count(addr) == 0) {
         map.insert(
           std::make_pair(
             addr,
             std::vector<std::pair<uint8_t, Sensor>>{{
-              static_cast<uint8_t>(stmt.getColumn(11).getUInt()),
-              Sensor::fromResult(stmt)
+              static_cast<uint8_t>(stmt->getColumn(11).getUInt()),
+              Sensor::fromResult(*stmt)
             }}
           )
         );
       } else {
         map[addr].emplace_back(
-          static_cast<uint8_t>(stmt.getColumn(11).getUInt()),
-          Sensor::fromResult(stmt)
+          static_cast<uint8_t>(stmt->getColumn(11).getUInt()),
+          Sensor::fromResult(*stmt)
         );
       }
     }
@@ -316,16 +460,16 @@ public:
    */
   std::map<uint8_t, std::vector<std::pair<DeviceSensor, Sensor>>> getDeviceAddressSensorMap() {
     std::map<uint8_t, std::vector<std::pair<DeviceSensor, Sensor>>> map;
-    SQLite::Statement dsStmt(*m_db,
+    auto dsStmt = prepare(
       R"(
       SELECT address, type, globalIndex, typeIndex, sensorId, value, updated, metadata
       FROM deviceSensor
       ORDER BY address ASC, globalIndex ASC;
       )"
     );
-    while (dsStmt.executeStep()) {
-      auto deviceSensor = DeviceSensor::fromResult(dsStmt);
-      SQLite::Statement sStmt(*m_db,
+    while (dsStmt->executeStep()) {
+      auto deviceSensor = DeviceSensor::fromResult(*dsStmt);
+      auto sStmt = prepare(
         R"(
         SELECT id, type, name, shortname, unit, decimals, frc2bit, frc1Byte, frc2Byte, frc4Byte
         FROM sensor
@@ -333,8 +477,8 @@ public:
         LIMIT 1;
         )"
       );
-      sStmt.bind(1, deviceSensor.getSensorId());
-      if (!sStmt.executeStep()) {
+      sStmt->bind(1, deviceSensor.getSensorId());
+      if (!sStmt->executeStep()) {
         continue;
       }
       const uint8_t addr = deviceSensor.getAddress();
@@ -344,14 +488,14 @@ public:
             addr,
             std::vector<std::pair<DeviceSensor, Sensor>>{{
               deviceSensor,
-              Sensor::fromResult(sStmt)
+              Sensor::fromResult(*sStmt)
             }}
           )
         );
       } else {
         map[addr].emplace_back(
           deviceSensor,
-          Sensor::fromResult(sStmt)
+          Sensor::fromResult(*sStmt)
         );
       }
     }
@@ -365,18 +509,18 @@ public:
    */
   std::unordered_map<uint8_t, std::vector<std::pair<uint8_t, uint8_t>>> getSensorTypeAddressIndexMap() {
     std::unordered_map<uint8_t, std::vector<std::pair<uint8_t, uint8_t>>> map;
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT address, type, typeIndex
       FROM deviceSensor
       ORDER BY address ASC, globalIndex ASC;
       )"
     );
-    while (stmt.executeStep()) {
-      uint8_t type = static_cast<uint8_t>(stmt.getColumn(1).getUInt());
+    while (stmt->executeStep()) {
+      uint8_t type = static_cast<uint8_t>(stmt->getColumn(1).getUInt());
       map[type].emplace_back(
-        static_cast<uint8_t>(stmt.getColumn(0).getUInt()),
-        static_cast<uint8_t>(stmt.getColumn(2).getUInt())
+        static_cast<uint8_t>(stmt->getColumn(0).getUInt()),
+        static_cast<uint8_t>(stmt->getColumn(2).getUInt())
       );
     }
     return map;
@@ -399,7 +543,7 @@ public:
    * @return Optional value container, global index if record exists, `std::nullopt` otherwise
    */
   std::optional<uint8_t> getGlobalSensorIndex(uint8_t address, uint8_t type, uint8_t typeIndex) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT globalIndex
       FROM deviceSensor
@@ -407,13 +551,13 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, address);
-    stmt.bind(2, type);
-    stmt.bind(3, typeIndex);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, address);
+    stmt->bind(2, type);
+    stmt->bind(3, typeIndex);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return static_cast<uint8_t>(stmt.getColumn(0).getUInt());
+    return static_cast<uint8_t>(stmt->getColumn(0).getUInt());
   }
 
   /**
@@ -425,7 +569,7 @@ public:
    * @return Map of HWPIDs and set of device addresses
    */
   std::map<uint16_t, std::set<uint8_t>> getHwpidAddressesMap(uint8_t type) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT d.address, p.hwpid
       FROM product as p
@@ -435,11 +579,11 @@ public:
       GROUP BY d.address;
       )"
     );
-    stmt.bind(1, type);
+    stmt->bind(1, type);
     std::map<uint16_t, std::set<uint8_t>> map;
-    while (stmt.executeStep()) {
-      auto addr = static_cast<uint8_t>(stmt.getColumn(0).getUInt());
-      auto hwpid = static_cast<uint16_t>(stmt.getColumn(1).getUInt());
+    while (stmt->executeStep()) {
+      auto addr = static_cast<uint8_t>(stmt->getColumn(0).getUInt());
+      auto hwpid = static_cast<uint16_t>(stmt->getColumn(1).getUInt());
       if (map.count(hwpid) == 0) {
         map.insert(
           std::make_pair(
@@ -461,19 +605,19 @@ public:
    * @return Map of global indexes and corresponding sensor IDs
    */
   std::map<uint8_t, uint32_t> getGlobalIndexSensorIdMap(uint8_t addr) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT globalIndex, sensorId
       FROM deviceSensor
       WHERE address = ?;
       )"
     );
-    stmt.bind(1, addr);
+    stmt->bind(1, addr);
     std::map<uint8_t, uint32_t> map;
-    while (stmt.executeStep()) {
+    while (stmt->executeStep()) {
       map.insert_or_assign(
-        static_cast<uint8_t>(stmt.getColumn(0).getUInt()),
-        stmt.getColumn(1).getUInt()
+        static_cast<uint8_t>(stmt->getColumn(0).getUInt()),
+        stmt->getColumn(1).getUInt()
       );
     }
     return map;
@@ -486,18 +630,18 @@ public:
    * @return `true` if Device implements sensors, `false` otherwise
    */
   bool deviceHasSensors(uint8_t address) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT COUNT(*)
       FROM deviceSensor
       WHERE address = ?;
       )"
     );
-    stmt.bind(1, address);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, address);
+    if (!stmt->executeStep()) {
       return false;
     }
-    return stmt.getColumn(0).getUInt() > 0;
+    return stmt->getColumn(0).getUInt() > 0;
   }
 };
 
@@ -39,7 +39,7 @@ public:
    * @return Pointer to deserialized `Driver` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Driver> get(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, name, peripheralNumber, version, versionFlags, driver, driverHash
       FROM driver
@@ -47,11 +47,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, id);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Driver>(Driver::fromResult(stmt));
+    return std::make_unique<Driver>(Driver::fromResult(*stmt));
   }
 
   /**
@@ -60,15 +60,15 @@ public:
    * @return Vector of deserialized `Driver` objects
    */
   std::vector<Driver> getAll() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, name, peripheralNumber, version, versionFlags, driver, driverHash
       FROM driver;
       )"
     );
     std::vector<Driver> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(Driver::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(Driver::fromResult(*stmt));
     }
     return vec;
   }
@@ -81,7 +81,7 @@ public:
    * @return Pointer to deserialized `Driver` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Driver> getByPeripheralVersion(int16_t peripheral, double version) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, name, peripheralNumber, version, versionFlags, driver, driverHash
       FROM driver
@@ -89,12 +89,12 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, peripheral);
-    stmt.bind(2, version);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, peripheral);
+    stmt->bind(2, version);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Driver>(Driver::fromResult(stmt));
+    return std::make_unique<Driver>(Driver::fromResult(*stmt));
   }
 
   /**
@@ -106,20 +106,20 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   uint32_t insert(const Driver &driver) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO driver (name, peripheralNumber, version, versionFlags, driver, driverHash)
       VALUES (?, ?, ?, ?, ?, ?)
       )"
     );
-    stmt.bind(1, driver.getName());
-    stmt.bind(2, driver.getPeripheralNumber());
-    stmt.bind(3, driver.getVersion());
-    stmt.bind(4, driver.getVersionFlags());
-    stmt.bind(5, driver.getDriver());
-    stmt.bind(6, driver.getDriverHash());
+    stmt->bind(1, driver.getName());
+    stmt->bind(2, driver.getPeripheralNumber());
+    stmt->bind(3, driver.getVersion());
+    stmt->bind(4, driver.getVersionFlags());
+    stmt->bind(5, driver.getDriver());
+    stmt->bind(6, driver.getDriverHash());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -139,20 +139,20 @@ public:
    * @throws `std::runtime_error` If the record cannot be updated
    */
   void update(const Driver &driver) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       UPDATE driver
       SET name = ?, versionFlags = ?, driver = ?, driverHash = ?
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, driver.getName());
-    stmt.bind(2, driver.getVersionFlags());
-    stmt.bind(3, driver.getDriver());
-    stmt.bind(4, driver.getDriverHash());
-    stmt.bind(5, driver.getId());
+    stmt->bind(1, driver.getName());
+    stmt->bind(2, driver.getVersionFlags());
+    stmt->bind(3, driver.getDriver());
+    stmt->bind(4, driver.getDriverHash());
+    stmt->bind(5, driver.getId());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -169,7 +169,7 @@ public:
    * @return Vector of `Driver` objects
    */
   std::vector<Driver> getLatest() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT d1.id, d1.name, d1.peripheralNumber, d1.version, d1.versionFlags, d1.driver, d1.driverHash
       FROM driver as d1
@@ -182,8 +182,8 @@ public:
       )"
     );
     std::vector<Driver> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(Driver::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(Driver::fromResult(*stmt));
     }
     return vec;
   }
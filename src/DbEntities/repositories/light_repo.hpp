@@ -43,7 +43,7 @@ public:
    * @return `std::optional<Light>` Light record, or nullopt
    */
   std::optional<Light> get(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, deviceId
       FROM light
@@ -51,11 +51,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, id);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return Light::fromResult(stmt);
+    return Light::fromResult(*stmt);
   }
 
   /**
@@ -64,15 +64,15 @@ public:
    * @return Vector of deserialized `Light` objects
    */
   std::vector<Light> getAll() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, deviceId
       FROM light;
       )"
     );
     std::vector<Light> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(Light::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(Light::fromResult(*stmt));
     }
     return vec;
   }
@@ -84,7 +84,7 @@ public:
    * @return `std::optional<Light>` Light record, or nullopt
    */
   std::optional<Light> getByDeviceId(uint32_t deviceId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, deviceId
       FROM light
@@ -92,11 +92,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, deviceId);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, deviceId);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return Light::fromResult(stmt);
+    return Light::fromResult(*stmt);
   }
 
   /**
@@ -108,15 +108,15 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   uint32_t insert(uint32_t deviceId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO light (deviceId)
       VALUES (?);
       )"
     );
-    stmt.bind(1, deviceId);
+    stmt->bind(1, deviceId);
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -136,17 +136,17 @@ public:
    * @throws `std::runtime_error` If the record cannot be updated
    */
   void update(const Light &light) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       UPDATE light
       SET deviceId = ?
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, light.getDeviceId());
-    stmt.bind(2, light.getId());
+    stmt->bind(1, light.getDeviceId());
+    stmt->bind(2, light.getId());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -163,14 +163,14 @@ public:
    * @param id Record ID
    */
   void remove(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM light
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, id);
-    stmt.exec();
+    stmt->bind(1, id);
+    stmt->exec();
   }
 
   /**
@@ -179,14 +179,14 @@ public:
    * @param deviceId Device ID
    */
   void removeByDeviceId(uint32_t deviceId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM light
       WHERE deviceId = ?;
       )"
     );
-    stmt.bind(1, deviceId);
-    stmt.exec();
+    stmt->bind(1, deviceId);
+    stmt->exec();
   }
 
   /**
@@ -195,7 +195,7 @@ public:
    * @return Set of device addresses
    */
   std::set<uint8_t> getAddresses() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT d.address
       FROM light as l
@@ -203,8 +203,8 @@ public:
       )"
     );
     std::set<uint8_t> addrs;
-    while(stmt.executeStep()) {
-      addrs.insert(static_cast<uint8_t>(stmt.getColumn(0).getUInt()));
+    while(stmt->executeStep()) {
+      addrs.insert(static_cast<uint8_t>(stmt->getColumn(0).getUInt()));
     }
     return addrs;
   }
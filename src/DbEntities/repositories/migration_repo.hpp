@@ -39,15 +39,15 @@ public:
    * @return Vector of deserialized `Migration` objects
    */
   std::vector<Migration> getAll() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT version, executedAt
       FROM migrations;
       )"
     );
     std::vector<Migration> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(Migration::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(Migration::fromResult(*stmt));
     }
     return vec;
   }
@@ -59,14 +59,14 @@ public:
    */
   std::set<std::string> getExecutedVersions() {
     std::set<std::string> migrations;
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT version
       FROM migrations;
       )"
     );
-    while(stmt.executeStep()) {
-      migrations.insert(stmt.getColumn(0).getString());
+    while(stmt->executeStep()) {
+      migrations.insert(stmt->getColumn(0).getString());
     }
     return migrations;
   }
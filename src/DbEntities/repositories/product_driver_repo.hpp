@@ -41,15 +41,15 @@ public:
    * @return Vector of deserialized `ProductDriver` objects
    */
   std::vector<ProductDriver> getAll() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT productId, driverId
       FROM productDriver;
       )"
     );
     std::vector<ProductDriver> vector;
-    while (stmt.executeStep()) {
-      vector.emplace_back(ProductDriver::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vector.emplace_back(ProductDriver::fromResult(*stmt));
     }
     return vector;
   }
@@ -63,16 +63,16 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   uint32_t insert(const ProductDriver &productDriver) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO productDriver (productId, driverId)
       VALUES (?, ?);
       )"
     );
-    stmt.bind(1, productDriver.getProductId());
-    stmt.bind(2, productDriver.getDriverId());
+    stmt->bind(1, productDriver.getProductId());
+    stmt->bind(2, productDriver.getDriverId());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -91,15 +91,15 @@ public:
    * @param driverId Driver ID
    */
   void remove(uint32_t productId, uint32_t driverId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       DELETE FROM productDriver
       WHERE productId = ? AND driverId = ?;
       )"
     );
-    stmt.bind(1, productId);
-    stmt.bind(2, driverId);
-    stmt.exec();
+    stmt->bind(1, productId);
+    stmt->bind(2, driverId);
+    stmt->exec();
   }
 
   /**
@@ -109,7 +109,7 @@ public:
    * @return Vector of deserialized `Driver` objects
    */
   std::vector<Driver> getDrivers(uint32_t productId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT d.id, d.name, d.peripheralNumber, d.version, d.versionFlags, d.driver, d.driverHash
       FROM driver as d
@@ -117,10 +117,10 @@ public:
       WHERE pd.productId = ?;
       )"
     );
-    stmt.bind(1, productId);
+    stmt->bind(1, productId);
     std::vector<Driver> vector;
-    while (stmt.executeStep()) {
-      vector.emplace_back(Driver::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vector.emplace_back(Driver::fromResult(*stmt));
     }
     return vector;
   }
@@ -133,17 +133,17 @@ public:
    * @return Set of driver IDs
    */
   std::set<uint32_t> getDriverIds(uint32_t productId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT driverId
       FROM productDriver
       WHERE productId = ?;
       )"
     );
-    stmt.bind(1, productId);
+    stmt->bind(1, productId);
     std::set<uint32_t> set;
-    while (stmt.executeStep()) {
-      set.insert(stmt.getColumn(0).getUInt());
+    while (stmt->executeStep()) {
+      set.insert(stmt->getColumn(0).getUInt());
     }
     return set;
   }
@@ -154,7 +154,7 @@ public:
    * @return Map of product IDs and sets of driver IDs
    */
   std::map<uint32_t, std::set<uint32_t>> getProductsDriversMap() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT p.id, d.id
       FROM driver as d
@@ -163,9 +163,9 @@ public:
       )"
     );
     std::map<uint32_t, std::set<uint32_t>> map;
-    while (stmt.executeStep()) {
-      auto productId = stmt.getColumn(0).getUInt();
-      auto driverId = stmt.getColumn(0).getUInt();
+    while (stmt->executeStep()) {
+      auto productId = stmt->getColumn(0).getUInt();
+      auto driverId = stmt->getColumn(0).getUInt();
       if (map.count(productId) == 0) {
         map.insert(
           std::make_pair(
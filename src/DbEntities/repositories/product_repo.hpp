@@ -40,7 +40,7 @@ public:
    * @return Optional `Product` object, or `std::nullopt` if record does not exist
    */
   std::optional<Product> get(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, hwpid, hwpidVersion, osBuild, osVersion, dpaVersion, handlerUrl, handlerHash, customDriver,
         packageId, manufacturer, name
@@ -49,11 +49,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, id);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return Product::fromResult(stmt);
+    return Product::fromResult(*stmt);
   }
 
   /**
@@ -66,7 +66,7 @@ public:
    * @return Optional `Product` object, or `std::nullopt` if record does not exist
    */
   std::optional<Product> get(uint16_t hwpid, uint16_t hwpidVersion, uint16_t osBuild, uint16_t dpaVersion) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, hwpid, hwpidVersion, osBuild, osVersion, dpaVersion, handlerUrl, handlerHash, customDriver,
         packageId, manufacturer, name
@@ -75,14 +75,14 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, hwpid);
-    stmt.bind(2, hwpidVersion);
-    stmt.bind(3, osBuild);
-    stmt.bind(4, dpaVersion);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, hwpid);
+    stmt->bind(2, hwpidVersion);
+    stmt->bind(3, osBuild);
+    stmt->bind(4, dpaVersion);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return Product::fromResult(stmt);
+    return Product::fromResult(*stmt);
   }
 
   /**
@@ -91,7 +91,7 @@ public:
    * @return Vector of deserialized `Product` objects
    */
   std::vector<Product> getAll() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, hwpid, hwpidVersion, osBuild, osVersion, dpaVersion, handlerUrl, handlerHash, customDriver,
         packageId, manufacturer, name
@@ -99,8 +99,8 @@ public:
       )"
     );
     std::vector<Product> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(Product::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(Product::fromResult(*stmt));
     }
     return vec;
   }
@@ -158,50 +158,50 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   uint32_t insert(const Product &product) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO product (hwpid, hwpidVersion, osBuild, osVersion, dpaVersion, handlerUrl, handlerHash,
         customDriver, packageId, manufacturer, name)
       VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);
       )"
     );
-    stmt.bind(1, product.getHwpid());
-    stmt.bind(2, product.getHwpidVersion());
-    stmt.bind(3, product.getOsBuild());
-    stmt.bind(4, product.getOsVersion());
-    stmt.bind(5, product.getDpaVersion());
+    stmt->bind(1, product.getHwpid());
+    stmt->bind(2, product.getHwpidVersion());
+    stmt->bind(3, product.getOsBuild());
+    stmt->bind(4, product.getOsVersion());
+    stmt->bind(5, product.getDpaVersion());
     if (product.getHandlerUrl().has_value()) {
-      stmt.bind(6, product.getHandlerUrl().value());
+      stmt->bind(6, product.getHandlerUrl().value());
     } else {
-      stmt.bind(6);
+      stmt->bind(6);
     }
     if (product.getHandlerHash().has_value()) {
-      stmt.bind(7, product.getHandlerHash().value());
+      stmt->bind(7, product.getHandlerHash().value());
     } else {
-      stmt.bind(7);
+      stmt->bind(7);
     }
     if (product.getCustomDriver().has_value()) {
-      stmt.bind(8, product.getCustomDriver().value());
+      stmt->bind(8, product.getCustomDriver().value());
     } else {
-      stmt.bind(8);
+      stmt->bind(8);
     }
     if (product.getPackageId().has_value()) {
-      stmt.bind(9, product.getPackageId().value());
+      stmt->bind(9, product.getPackageId().value());
     } else {
-      stmt.bind(9);
+      stmt->bind(9);
     }
     if (product.getManufacturer().has_value()) {
-      stmt.bind(10, product.getManufacturer().value());
+      stmt->bind(10, product.getManufacturer().value());
     } else {
-      stmt.bind(10);
+      stmt->bind(10);
     }
     if (product.getName().has_value()) {
-      stmt.bind(11, product.getName().value());
+      stmt->bind(11, product.getName().value());
     } else {
-      stmt.bind(11);
+      stmt->bind(11);
     }
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -221,7 +221,7 @@ public:
    * @throws `std::runtime_error` If the record cannot be updated
    */
   void update(const Product &product) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       UPDATE product
       SET hwpid = ?, hwpidVersion = ?, osBuild = ?, osVersion = ?, dpaVersion = ?, handlerUrl = ?, handlerHash = ?, customDriver = ?,
@@ -229,44 +229,44 @@ public:
       WHERE id = ?;
       )"
     );
-    stmt.bind(1, product.getHwpid());
-    stmt.bind(2, product.getHwpidVersion());
-    stmt.bind(3, product.getOsBuild());
-    stmt.bind(4, product.getOsVersion());
-    stmt.bind(5, product.getDpaVersion());
+    stmt->bind(1, product.getHwpid());
+    stmt->bind(2, product.getHwpidVersion());
+    stmt->bind(3, product.getOsBuild());
+    stmt->bind(4, product.getOsVersion());
+    stmt->bind(5, product.getDpaVersion());
     if (product.getHandlerUrl().has_value()) {
-      stmt.bind(6, product.getHandlerUrl().value());
+      stmt->bind(6, product.getHandlerUrl().value());
     } else {
-      stmt.bind(6);
+      stmt->bind(6);
     }
     if (product.getHandlerHash().has_value()) {
-      stmt.bind(7, product.getHandlerHash().value());
+      stmt->bind(7, product.getHandlerHash().value());
     } else {
-      stmt.bind(7);
+      stmt->bind(7);
     }
     if (product.getCustomDriver().has_value()) {
-      stmt.bind(8, product.getCustomDriver().value());
+      stmt->bind(8, product.getCustomDriver().value());
     } else {
-      stmt.bind(8);
+      stmt->bind(8);
     }
     if (product.getPackageId().has_value()) {
-      stmt.bind(9, product.getPackageId().value());
+      stmt->bind(9, product.getPackageId().value());
     } else {
-      stmt.bind(9);
+      stmt->bind(9);
     }
     if (product.getManufacturer().has_value()) {
-      stmt.bind(10, product.getManufacturer().value());
+      stmt->bind(10, product.getManufacturer().value());
     } else {
-      stmt.bind(10);
+      stmt->bind(10);
     }
     if (product.getName().has_value()) {
-      stmt.bind(11, product.getName().value());
+      stmt->bind(11, product.getName().value());
     } else {
-      stmt.bind(11);
+      stmt->bind(11);
     }
-    stmt.bind(12, product.getId());
+    stmt->bind(12, product.getId());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -283,7 +283,7 @@ public:
    * @return Optional value container, product ID if record exists, `std::nullopt` otherwise
    */
   std::optional<uint32_t> getCoordinatorProductId() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT p.id
       FROM product as p
@@ -292,10 +292,10 @@ public:
       LIMIT 1;
       )"
     );
-    if (!stmt.executeStep()) {
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return stmt.getColumn(0).getUInt();
+    return stmt->getColumn(0).getUInt();
   }
 
   /**
@@ -309,7 +309,7 @@ public:
    */
   std::optional<uint32_t> getNoncertifiedProductId(uint16_t hwpid, uint16_t hwpidVersion,
     uint16_t osBuild, uint16_t dpaVersion) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, hwpid, hwpidVersion, osBuild, osVersion, dpaVersion, handlerUrl, handlerHash, customDriver,
         packageId, manufacturer, name
@@ -318,15 +318,15 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, hwpid);
-    stmt.bind(2, hwpidVersion);
-    stmt.bind(3, osBuild);
-    stmt.bind(4, dpaVersion);
-    stmt.bind(5);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, hwpid);
+    stmt->bind(2, hwpidVersion);
+    stmt->bind(3, osBuild);
+    stmt->bind(4, dpaVersion);
+    stmt->bind(5);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return stmt.getColumn(0).getUInt();
+    return stmt->getColumn(0).getUInt();
   }
 
   /**
@@ -336,7 +336,7 @@ public:
    * @return Pointer to product driver, if record exists and product has custom driver, `nullptr` otherwise
    */
   std::optional<std::string> getCustomDriver(uint32_t productId) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT customDriver
       FROM product
@@ -344,11 +344,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, productId);
-    if (!stmt.executeStep() || stmt.getColumn(0).isNull()) {
+    stmt->bind(1, productId);
+    if (!stmt->executeStep() || stmt->getColumn(0).isNull()) {
       return std::nullopt;
     }
-    return stmt.getColumn(0).getString();
+    return stmt->getColumn(0).getString();
   }
 
   /**
@@ -358,15 +358,15 @@ public:
    * @return `std::vector<Product>` Vector of products
    */
   std::vector<Product> getAllWithIncompleteProductInfo() {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       "SELECT id, hwpid, hwpidVersion, osBuild, osVersion, dpaVersion, handlerUrl, handlerHash, customDriver,"
       "  packageId, manufacturer, name"
       " FROM product"
       " WHERE manufacturer IS NULL OR name IS NULL;"
     );
     std::vector<Product> vec;
-    while (stmt.executeStep()) {
-      vec.emplace_back(Product::fromResult(stmt));
+    while (stmt->executeStep()) {
+      vec.emplace_back(Product::fromResult(*stmt));
     }
     return vec;
   }
@@ -39,7 +39,7 @@ public:
    * @return Pointer to deserialized `Sensor` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Sensor> get(uint32_t id) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, type, name, shortname, unit, decimals, frc2bit, frc1Byte, frc2Byte, frc4Byte
       FROM sensor
@@ -47,11 +47,11 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, id);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, id);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Sensor>(Sensor::fromResult(stmt));
+    return std::make_unique<Sensor>(Sensor::fromResult(*stmt));
   }
 
   /**
@@ -62,7 +62,7 @@ public:
    * @return Pointer to deserialized `Sensor` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Sensor> getByTypeName(uint8_t type, const std::string& name) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT id, type, name, shortname, unit, decimals, frc2bit, frc1Byte, frc2Byte, frc4Byte
       FROM sensor
@@ -70,12 +70,12 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, type);
-    stmt.bind(2, name);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, type);
+    stmt->bind(2, name);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Sensor>(Sensor::fromResult(stmt));
+    return std::make_unique<Sensor>(Sensor::fromResult(*stmt));
   }
 
   /**
@@ -86,18 +86,18 @@ public:
    * @return `uint32_t` if record exists, `std::nullopt` otherwise
    */
   std::optional<uint32_t> getIdByTypeName(uint8_t type, const std::string& name) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       "SELECT id"
       " FROM sensor"
       " WHERE type = ? AND name = ?"
       " LIMIT 1;"
     );
-    stmt.bind(1, type);
-    stmt.bind(2, name);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, type);
+    stmt->bind(2, name);
+    if (!stmt->executeStep()) {
       return std::nullopt;
     }
-    return stmt.getColumn(0).getUInt();
+    return stmt->getColumn(0).getUInt();
   }
 
   /**
@@ -109,7 +109,7 @@ public:
    * @return Pointer to deserialized `Sensor` object, or `nullptr` if record does not exist
    */
   std::unique_ptr<Sensor> getByAddressIndexType(uint8_t address, uint8_t index, uint8_t type) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT s.id, s.type, s.name, s.shortname, s.unit, s.decimals, s.frc2bit, s.frc1Byte, s.frc2Byte, s.frc4Byte
       FROM sensor as s
@@ -119,13 +119,13 @@ public:
       LIMIT 1;
       )"
     );
-    stmt.bind(1, address);
-    stmt.bind(2, index);
-    stmt.bind(3, type);
-    if (!stmt.executeStep()) {
+    stmt->bind(1, address);
+    stmt->bind(2, index);
+    stmt->bind(3, type);
+    if (!stmt->executeStep()) {
       return nullptr;
     }
-    return std::make_unique<Sensor>(Sensor::fromResult(stmt));
+    return std::make_unique<Sensor>(Sensor::fromResult(*stmt));
   }
 
   /**
@@ -137,23 +137,23 @@ public:
    * @throws `std::runtime_error` If the record cannot be inserted
    */
   uint32_t insert(const Sensor &sensor) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       INSERT INTO sensor (type, name, shortname, unit, decimals, frc2bit, frc1Byte, frc2Byte, frc4Byte)
       VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);
       )"
     );
-    stmt.bind(1, sensor.getType());
-    stmt.bind(2, sensor.getName());
-    stmt.bind(3, sensor.getShortname());
-    stmt.bind(4, sensor.getUnit());
-    stmt.bind(5, sensor.getDecimals());
-    stmt.bind(6, sensor.hasFrc2Bit());
-    stmt.bind(7, sensor.hasFrcByte());
-    stmt.bind(8, sensor.hasFrc2Byte());
-    stmt.bind(9, sensor.hasFrc4Byte());
+    stmt->bind(1, sensor.getType());
+    stmt->bind(2, sensor.getName());
+    stmt->bind(3, sensor.getShortname());
+    stmt->bind(4, sensor.getUnit());
+    stmt->bind(5, sensor.getDecimals());
+    stmt->bind(6, sensor.hasFrc2Bit());
+    stmt->bind(7, sensor.hasFrcByte());
+    stmt->bind(8, sensor.hasFrc2Byte());
+    stmt->bind(9, sensor.hasFrc4Byte());
     try {
-      stmt.exec();
+      stmt->exec();
     } catch (const SQLite::Exception &e) {
       throw std::runtime_error(
         this->formatErrorMessage(
@@ -172,7 +172,7 @@ public:
    * @return Map of sensor indexes and sensor objects
    */
   std::map<uint8_t, Sensor> getDeviceSensorIndexMap(uint8_t address) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT s.id, s.type, s.name, s.shortname, s.unit, s.decimals, s.frc2bit, s.frc1Byte, s.frc2Byte, s.frc4Byte
       FROM sensor as s
@@ -182,14 +182,14 @@ public:
       ORDER BY ds.globalIndex;
       )"
     );
-    stmt.bind(1, address);
+    stmt->bind(1, address);
     std::map<uint8_t, Sensor> map;
     size_t i = 0;
-    while (stmt.executeStep()) {
+    while (stmt->executeStep()) {
       map.insert(
         std::make_pair(
           i++,
-          Sensor::fromResult(stmt)
+          Sensor::fromResult(*stmt)
         )
       );
     }
@@ -203,7 +203,7 @@ public:
    * @return Map of global indexes and sensor IDs
    */
   std::map<uint8_t, uint32_t> getDeviceSensorIdIndexMap(uint8_t address) {
-    SQLite::Statement stmt(*m_db,
+    auto stmt = prepare(
       R"(
       SELECT ds.globalIndex, s.id
       FROM sensor as s
@@ -213,13 +213,13 @@ public:
       ORDER BY ds.globalIndex;
       )"
     );
-    stmt.bind(1, address);
+    stmt->bind(1, address);
     std::map<uint8_t, uint32_t> map;
-    while (stmt.executeStep()) {
+    while (stmt->executeStep()) {
       map.insert(
         std::make_pair(
-          static_cast<uint8_t>(stmt.getColumn(0).getUInt()),
-          stmt.getColumn(1).getUInt()
+          static_cast<uint8_t>(stmt->getColumn(0).getUInt()),
+          stmt->getColumn(1).getUInt()
         )
       );
     }
@@ -0,0 +1,197 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SQLiteCpp/SQLiteCpp.h>
+
+namespace iqrf::db::repos {
+
+/**
+ * Cache of prepared statements of a single database connection
+ *
+ * Statements are lent to repositories for the duration of a single query and returned to the cache
+ * reset and with cleared bindings. A query that is already lent out (nested or concurrent use) gets
+ * a newly prepared statement, so lent statements are never shared.
+ *
+ * The cache keeps its database connection open and has to be released before the connection
+ * owner drops the connection, cached statements would otherwise keep the connection busy.
+ */
+class StatementCache : public std::enable_shared_from_this<StatementCache> {
+  /// Idle statements of a single query
+  struct Entry {
+    std::vector<std::unique_ptr<SQLite::Statement>> idle;
+  };
+
+public:
+  /**
+   * Statement lent from cache, returned to cache on destruction
+   */
+  class Lease {
+  public:
+    /**
+     * Constructs lease of statement not owned by any cache
+     *
+     * @param stmt Statement
+     */
+    explicit Lease(std::unique_ptr<SQLite::Statement> stmt) : m_stmt(std::move(stmt)) {}
+
+    /**
+     * Constructs lease of cached statement
+     *
+     * @param cache Statement cache
+     * @param entry Cache entry of statement query
+     * @param stmt Statement
+     */
+    Lease(std::shared_ptr<StatementCache> cache, Entry *entry, std::unique_ptr<SQLite::Statement> stmt)
+      : m_cache(std::move(cache)), m_entry(entry), m_stmt(std::move(stmt)) {}
+
+    Lease(Lease &&other) noexcept = default;
+    Lease(const Lease &) = delete;
+    Lease &operator=(const Lease &) = delete;
+    Lease &operator=(Lease &&) = delete;
+
+    /**
+     * Destructor, returns statement to cache
+     */
+    ~Lease() {
+      if (m_cache && m_stmt) {
+        m_cache->release(m_entry, std::move(m_stmt));
+      }
+    }
+
+    SQLite::Statement &operator*() const {
+      return *m_stmt;
+    }
+
+    SQLite::Statement *operator->() const {
+      return m_stmt.get();
+    }
+  private:
+    /// Owning cache
+    std::shared_ptr<StatementCache> m_cache;
+    /// Cache entry
+    Entry *m_entry = nullptr;
+    /// Statement
+    std::unique_ptr<SQLite::Statement> m_stmt;
+  };
+
+  /**
+   * Constructor, cache has to be owned by `std::shared_ptr`
+   *
+   * @param db Database connection
+   * @param maxIdle Maximum number of idle statements kept per query
+   */
+  explicit StatementCache(std::shared_ptr<SQLite::Database> db, std::size_t maxIdle = 2)
+    : m_db(std::move(db)), m_maxIdle(maxIdle) {}
+
+  /**
+   * Lends statement of query, the statement is prepared only if there is no idle statement of the query
+   *
+   * Only queries with constant text should be cached, queries with generated text would grow the cache without limit.
+   *
+   * @param query Query text
+   * @return Statement lease
+   *
+   * @throws `SQLite::Exception` If the query cannot be prepared
+   */
+  Lease acquire(const std::string &query) {
+    std::unique_lock<std::mutex> lock(m_mtx);
+    auto &entry = m_entries[query];
+    if (!entry.idle.empty()) {
+      auto stmt = std::move(entry.idle.back());
+      entry.idle.pop_back();
+      ++m_reused;
+      return Lease(shared_from_this(), &entry, std::move(stmt));
+    }
+    ++m_prepared;
+    lock.unlock();
+    return Lease(shared_from_this(), &entry, std::make_unique<SQLite::Statement>(*m_db, query));
+  }
+
+  /**
+   * Returns database connection of the cache
+   *
+   * @return Database connection
+   */
+  const std::shared_ptr<SQLite::Database> &getDatabase() const {
+    return m_db;
+  }
+
+  /**
+   * Returns number of statements prepared by the cache
+   *
+   * @return Number of prepared statements
+   */
+  std::size_t getPrepared() const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_prepared;
+  }
+
+  /**
+   * Returns number of lent statements reused from the cache
+   *
+   * @return Number of reused statements
+   */
+  std::size_t getReused() const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_reused;
+  }
+private:
+  /**
+   * Resets statement and keeps it for reuse if the query does not have enough idle statements yet
+   *
+   * @param entry Cache entry of statement query
+   * @param stmt Statement
+   */
+  void release(Entry *entry, std::unique_ptr<SQLite::Statement> stmt) noexcept {
+    try {
+      try {
+        // reset reports error of the last step, the statement is reset regardless
+        stmt->reset();
+      } catch (const SQLite::Exception &) {}
+      stmt->clearBindings();
+      std::lock_guard<std::mutex> lock(m_mtx);
+      if (entry->idle.size() < m_maxIdle) {
+        entry->idle.push_back(std::move(stmt));
+      }
+    } catch (...) {
+      // statement is finalized instead of being reused
+    }
+  }
+
+  /// Database connection
+  std::shared_ptr<SQLite::Database> m_db;
+  /// Maximum number of idle statements per query
+  std::size_t m_maxIdle;
+  /// Cache access mutex
+  mutable std::mutex m_mtx;
+  /// Cache entries by query text, entries are not erased so lent statements can refer to them
+  std::unordered_map<std::string, Entry> m_entries;
+  /// Number of prepared statements
+  std::size_t m_prepared = 0;
+  /// Number of reused statements
+  std::size_t m_reused = 0;
+};
+
+}
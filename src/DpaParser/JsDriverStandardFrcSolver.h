@@ -175,12 +175,8 @@ namespace iqrf
 
       preResponse(m_responseParamDoc);
 
-      StringBuffer buffer;
-      Writer<rapidjson::StringBuffer> writer(buffer);
-      m_responseParamDoc.Accept(writer);
-      m_responseParamStr = buffer.GetString();
-
-      TRC_DEBUG(PAR(m_responseParamStr));
+      std::string responseParamStr = jsonToStr(m_responseParamDoc);
+      TRC_DEBUG(PAR(responseParamStr));
 
       std::string partialResultStr;
 
@@ -194,10 +190,13 @@ namespace iqrf
         responseResult["sensors"].push_back(nullptr);
       }
 
+      // same function is called in context of every HWPID
+      int functionHandleRsp = m_iJsRenderService->resolveFunction(functionNameRsp);
+
       for (const auto &item : hwpidAddrMap) {
         try {
           std::set<uint8_t> deviceAddresses = item.second;
-          m_iJsRenderService->callContext(*deviceAddresses.begin(), item.first, functionNameRsp, m_responseParamStr, partialResultStr);
+          m_iJsRenderService->callContext(*deviceAddresses.begin(), item.first, functionHandleRsp, responseParamStr, partialResultStr);
           json j = json::parse(partialResultStr);
           if (selectedNodes.size() == 0) {
             for (auto it = deviceAddresses.begin(); it != deviceAddresses.end(); ++it) {
@@ -222,9 +221,9 @@ namespace iqrf
         }
       }
 
-      m_responseResultStr = responseResult.dump();
-      TRC_DEBUG(PAR(m_responseResultStr));
-      m_responseResultDoc.Parse(m_responseResultStr.c_str());
+      std::string responseResultStr = responseResult.dump();
+      TRC_DEBUG(PAR(responseResultStr));
+      m_responseResultDoc.Parse(responseResultStr.c_str());
       postResponse(m_responseResultDoc);
 
       TRC_FUNCTION_LEAVE("");
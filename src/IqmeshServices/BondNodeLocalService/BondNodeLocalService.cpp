@@ -429,13 +429,13 @@ namespace iqrf {
         // Read OS of new node
         osRead(bondResult);
 
-        std::shared_ptr<IJsCacheService::Manufacturer> manufacturer = m_iJsCacheService->getManufacturer(bondResult.getHwpId());
+        std::shared_ptr<const IJsCacheService::Manufacturer> manufacturer = m_iJsCacheService->getManufacturer(bondResult.getHwpId());
         if (manufacturer != nullptr)
         {
           bondResult.setManufacturer(manufacturer->m_name);
         }
 
-        std::shared_ptr<IJsCacheService::Product> product = m_iJsCacheService->getProduct(bondResult.getHwpId());
+        std::shared_ptr<const IJsCacheService::Product> product = m_iJsCacheService->getProduct(bondResult.getHwpId());
         if (product != nullptr)
         {
           bondResult.setProduct(product->m_name);
@@ -449,7 +449,7 @@ namespace iqrf {
           osBuildStr = os.str();
         }
 
-        std::shared_ptr<IJsCacheService::Package> package = m_iJsCacheService->getPackage(
+        std::shared_ptr<const IJsCacheService::Package> package = m_iJsCacheService->getPackage(
           bondResult.getHwpId(),
           bondResult.getHwpIdVersion(),
           osBuildStr,
@@ -503,11 +503,11 @@ namespace iqrf {
         osRead(deviceEnumerateResult, m_enumerateDeviceParams.deviceAddress);
 
         // Obtains HwpId, which in turn is needed to get manufacturer and product
-        std::shared_ptr<IJsCacheService::Manufacturer> manufacturer = m_iJsCacheService->getManufacturer(deviceEnumerateResult.getHwpId());
+        std::shared_ptr<const IJsCacheService::Manufacturer> manufacturer = m_iJsCacheService->getManufacturer(deviceEnumerateResult.getHwpId());
         if (manufacturer != nullptr) {
           deviceEnumerateResult.setManufacturer(manufacturer->m_name);
         }
-        std::shared_ptr<IJsCacheService::Product> product = m_iJsCacheService->getProduct(deviceEnumerateResult.getHwpId());
+        std::shared_ptr<const IJsCacheService::Product> product = m_iJsCacheService->getProduct(deviceEnumerateResult.getHwpId());
         if (product != nullptr) {
           deviceEnumerateResult.setProduct(product->m_name);
         }
@@ -515,7 +515,7 @@ namespace iqrf {
         // Peripheral enumeration
         peripheralEnumeration(deviceEnumerateResult, m_enumerateDeviceParams.deviceAddress);
 
-        std::shared_ptr<IJsCacheService::Package> package = m_iJsCacheService->getPackage(deviceEnumerateResult.getHwpId(), deviceEnumerateResult.getHwpIdVer(), deviceEnumerateResult.getOsRead()->getOsBuildAsString(), deviceEnumerateResult.getPerEnum()->getDpaVerAsHexaString());
+        std::shared_ptr<const IJsCacheService::Package> package = m_iJsCacheService->getPackage(deviceEnumerateResult.getHwpId(), deviceEnumerateResult.getHwpIdVer(), deviceEnumerateResult.getOsRead()->getOsBuildAsString(), deviceEnumerateResult.getPerEnum()->getDpaVerAsHexaString());
         if (package != nullptr)
         {
           std::list<std::string> standards;
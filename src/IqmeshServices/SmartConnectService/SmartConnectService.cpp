@@ -419,13 +419,13 @@ namespace iqrf {
         // Read OS of new node
         osRead(smartConnectResult);
 
-        std::shared_ptr<IJsCacheService::Manufacturer> manufacturer = m_iJsCacheService->getManufacturer(smartConnectResult.getHwpId());
+        std::shared_ptr<const IJsCacheService::Manufacturer> manufacturer = m_iJsCacheService->getManufacturer(smartConnectResult.getHwpId());
         if (manufacturer != nullptr)
         {
           smartConnectResult.setManufacturer(manufacturer->m_name);
         }
 
-        std::shared_ptr<IJsCacheService::Product> product = m_iJsCacheService->getProduct(smartConnectResult.getHwpId());
+        std::shared_ptr<const IJsCacheService::Product> product = m_iJsCacheService->getProduct(smartConnectResult.getHwpId());
         if (product != nullptr)
         {
           smartConnectResult.setProduct(product->m_name);
@@ -439,7 +439,7 @@ namespace iqrf {
           osBuildStr = os.str();
         }
 
-        std::shared_ptr<IJsCacheService::Package> package = m_iJsCacheService->getPackage(
+        std::shared_ptr<const IJsCacheService::Package> package = m_iJsCacheService->getPackage(
           smartConnectResult.getHwpId(),
           smartConnectResult.getHwpIdVersion(),
           osBuildStr,
@@ -20,10 +20,12 @@
 #include "IDpaTransactionResult2.h"
 #include "IIqrfDb.h"
 #include "IqrfDbAux.h"
+#include "IqrfDbIndex.h"
 #include "JsDriverSensor.h"
 #include "Metadata.h"
 #include "MigrationManager.h"
 #include "Sensor.h"
+#include "SensorValueStore.h"
 #include "TraceMacros.h"
 
 #include "binary_output_repo.hpp"
@@ -35,7 +37,9 @@
 #include "product_repo.hpp"
 #include "sensor_repo.hpp"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <fstream>
 #include <iomanip>
@@ -73,13 +77,18 @@ namespace iqrf {
 
   void IqrfDb::resetDatabase() {
     TRC_FUNCTION_ENTER("");
-    std::ifstream dbFile(m_dbPath);
-    if (dbFile.is_open()) { // db file exists
-      if (std::remove(m_dbPath.c_str()) != 0) {
-        THROW_EXC_TRC_WAR(std::logic_error, "Failed to remove db file: " << strerror(errno));
-      };
+    {
+      // buffered sensor values belong to removed database
+      std::lock_guard<std::mutex> flushLock(m_sensorFlushMtx);
+      m_sensorStore.clear();
+      std::ifstream dbFile(m_dbPath);
+      if (dbFile.is_open()) { // db file exists
+        if (std::remove(m_dbPath.c_str()) != 0) {
+          THROW_EXC_TRC_WAR(std::logic_error, "Failed to remove db file: " << strerror(errno));
+        };
+      }
+      initializeDatabase();
     }
-    initializeDatabase();
     if (m_renderService != nullptr) {
       m_renderService->clearContexts();
     }
@@ -114,19 +123,20 @@ namespace iqrf {
   }
 
   void IqrfDb::reloadDrivers() {
-      TRC_FUNCTION_ENTER("");
-
-      if (m_renderService != nullptr) {
-        m_renderService->clearContexts();
-      }
-      loadCoordinatorDrivers();
-      loadProductDrivers();
-
-      TRC_FUNCTION_LEAVE("");
+    TRC_FUNCTION_ENTER("");
+    std::lock_guard<std::mutex> lock(m_driverLoadMtx);
+    // contexts are replaced one by one once compiled, contexts with unchanged code are kept
+    std::set<int> contextIds = loadCoordinatorDrivers();
+    std::map<int, int> addressContexts;
+    if (loadProductDrivers(true, &contextIds, &addressContexts) && m_renderService != nullptr) {
+      m_renderService->retainContexts(contextIds, addressContexts);
     }
+    TRC_FUNCTION_LEAVE("");
+  }
 
   void IqrfDb::reloadCoordinatorDrivers() {
     TRC_FUNCTION_ENTER("");
+    std::lock_guard<std::mutex> lock(m_driverLoadMtx);
     loadCoordinatorDrivers();
     TRC_FUNCTION_LEAVE("");
   }
@@ -135,25 +145,25 @@ namespace iqrf {
 
   std::unique_ptr<BinaryOutput> IqrfDb::getBinaryOutput(const uint32_t id) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::BinaryOutputRepository binoutRepo(m_db);
+    db::repos::BinaryOutputRepository binoutRepo(m_db, m_statementCache);
     return binoutRepo.get(id);
   }
 
   std::optional<BinaryOutput> IqrfDb::getBinaryOutputByDeviceId(const uint32_t deviceId) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::BinaryOutputRepository binoutRepo(m_db);
+    db::repos::BinaryOutputRepository binoutRepo(m_db, m_statementCache);
     return binoutRepo.getByDeviceId(deviceId);
   }
 
   std::set<uint8_t> IqrfDb::getBinaryOutputAddresses() {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::BinaryOutputRepository binoutRepo(m_db);
+    db::repos::BinaryOutputRepository binoutRepo(m_db, m_statementCache);
     return binoutRepo.getAddresses();
   }
 
   std::map<uint8_t, uint8_t> IqrfDb::getBinaryOutputCountMap(const std::vector<uint32_t>& deviceIds) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::BinaryOutputRepository binoutRepo(m_db);
+    db::repos::BinaryOutputRepository binoutRepo(m_db, m_statementCache);
     if (deviceIds.empty()) {
       return binoutRepo.getAddressCountMap();
     } else {
@@ -165,61 +175,60 @@ namespace iqrf {
 
   std::unique_ptr<Device> IqrfDb::getDeviceByAddress(const uint8_t address) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     return deviceRepo.getByAddress(address);
   }
 
   std::unique_ptr<Device> IqrfDb::getDeviceByMid(const uint32_t mid) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     return deviceRepo.getByMid(mid);
   }
 
   std::vector<Device> IqrfDb::getDevices(const std::vector<uint8_t>& requestedDevices) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     return deviceRepo.getDevices(requestedDevices);
   }
 
   void IqrfDb::updateDevice(Device &device) {
-    std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
-    deviceRepo.update(device);
+    {
+      std::lock_guard<std::mutex> lock(m_dbMtx);
+      db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
+      deviceRepo.update(device);
+    }
+    rebuildIndex();
   }
 
   std::set<uint8_t> IqrfDb::getDeviceAddresses() {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     return deviceRepo.getAddresses();
   }
 
   std::optional<uint32_t> IqrfDb::getDeviceMid(const uint8_t address) {
-    std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
-    return deviceRepo.getMidByAddress(address);
+    return getIndex()->getMid(address);
   }
 
   std::optional<uint16_t> IqrfDb::getDeviceHwpid(const uint8_t address) {
-    std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
-    return deviceRepo.getHwpidByAddress(address);
+    return getIndex()->getHwpid(address);
   }
 
   bool IqrfDb::deviceImplementsPeripheral(uint32_t id, int16_t peripheral) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     return deviceRepo.implementsPeripheral(id, peripheral);
   }
 
   std::shared_ptr<std::string> IqrfDb::getDeviceMetadata(const uint8_t address) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     return deviceRepo.getMetadataByAddress(address);
   }
 
   rapidjson::Document IqrfDb::getDeviceMetadataDoc(const uint8_t address) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     auto metadata = deviceRepo.getMetadataByAddress(address);
     rapidjson::Document doc;
     if (metadata) {
@@ -233,7 +242,7 @@ namespace iqrf {
 
   void IqrfDb::setDeviceMetadata(const uint8_t address, std::shared_ptr<std::string> metadata) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     auto device = deviceRepo.getByAddress(address);
     if (device == nullptr) {
       throw std::logic_error("Device at address " + std::to_string(address) + " does not exist.");
@@ -244,7 +253,7 @@ namespace iqrf {
 
   std::map<uint8_t, embed::node::NodeMidHwpid> IqrfDb::getNodeMidHwpidMap() {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     return deviceRepo.getNodeMidHwpidMap();
   }
 
@@ -252,13 +261,13 @@ namespace iqrf {
 
   bool IqrfDb::deviceHasSensors(const uint8_t address) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
+    db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
     return deviceSensorRepo.deviceHasSensors(address);
   }
 
   std::map<uint8_t, std::vector<std::pair<uint8_t, Sensor>>> IqrfDb::getDeviceAddressIndexSensorMap(const std::vector<uint8_t>& deviceAddrs) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
+    db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
     if (deviceAddrs.empty()) {
       return deviceSensorRepo.getDeviceAddressIndexSensorMap();
     }
@@ -266,81 +275,75 @@ namespace iqrf {
   }
 
   std::map<uint8_t, std::vector<std::pair<DeviceSensor, Sensor>>> IqrfDb::getDeviceAddressSensorMap() {
-    std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
-    return deviceSensorRepo.getDeviceAddressSensorMap();
+    std::map<uint8_t, std::vector<std::pair<DeviceSensor, Sensor>>> map;
+    {
+      std::lock_guard<std::mutex> lock(m_dbMtx);
+      db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
+      map = deviceSensorRepo.getDeviceAddressSensorMap();
+    }
+    if (m_sensorWriteBehind) {
+      // latest values may not be written to database yet
+      for (auto &[address, sensors] : map) {
+        for (auto &[deviceSensor, sensor] : sensors) {
+          m_sensorStore.apply(deviceSensor);
+        }
+      }
+    }
+    return map;
   }
 
   std::unordered_map<uint8_t, std::vector<std::pair<uint8_t, uint8_t>>> IqrfDb::getSensorTypeAddressIndexMap() {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
+    db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
     return deviceSensorRepo.getSensorTypeAddressIndexMap();
   }
 
   std::optional<uint8_t> IqrfDb::getGlobalSensorIndex(const uint8_t address, const uint8_t type, const uint8_t typeIndex) {
-    std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
-    return deviceSensorRepo.getGlobalSensorIndex(address, type, typeIndex);
+    return getIndex()->getGlobalSensorIndex(address, type, typeIndex);
   }
 
   std::map<uint16_t, std::set<uint8_t>> IqrfDb::getSensorDeviceHwpidAddressMap(const uint8_t type) {
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
+    db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
     return deviceSensorRepo.getHwpidAddressesMap(type);
   }
 
   void IqrfDb::setDeviceSensorValue(const uint8_t address, const uint8_t type, const uint8_t index,
     const double value, std::shared_ptr<std::string> updated, bool frc) {
-    std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
-    auto ds = deviceSensorRepo.getByAddressTypeIndex(address, type, index, frc);
-    if (ds == nullptr) {
+    std::vector<db::repos::DeviceSensorValue> missing;
+    if (m_sensorWriteBehind) {
+      missing = bufferSensorValues({{address, type, index, value}}, updated, frc);
+    } else {
+      std::lock_guard<std::mutex> lock(m_dbMtx);
+      db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
+      // record is updated by key, missing record is detected by update result
+      missing = deviceSensorRepo.updateValues({{address, type, index, value}}, updated, frc);
+    }
+    if (!missing.empty()) {
       throw std::logic_error("Device at address " + std::to_string(address)
         + " does not implement sensor of type " + std::to_string(type)
         + " at index " + std::to_string(index)
       );
     }
-    ds->setValue(value);
-    ds->setUpdated(updated);
-    deviceSensorRepo.update(*ds);
   }
 
   void IqrfDb::setDeviceSensorMetadata(const uint8_t address, const uint8_t type, const uint8_t index, json &metadata,
     std::shared_ptr<std::string> updated, bool frc) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
-    auto ds = deviceSensorRepo.getByAddressTypeIndex(address, type, index, frc);
-    if (ds == nullptr) {
-      throw std::logic_error("Device at address " + std::to_string(address)
-        + " does not implement sensor of type " + std::to_string(type)
-        + " at index " + std::to_string(index)
-      );
-    }
-    std::shared_ptr<std::string> current = ds->getMetadata();
-    if (current) {
-      json j = json::parse(*current.get());
-      if (j.count("datablock")) {
-        metadata["datablock"] = j["datablock"];
-      }
-    }
-    current = std::make_shared<std::string>(metadata.dump());
-    if (metadata.count("datablock")) {
-      ds->setUpdated(updated);
-    }
-    ds->setMetadata(current);
-    deviceSensorRepo.update(*ds);
+    db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
+    updateDeviceSensorMetadata(deviceSensorRepo, address, type, index, metadata, updated, frc);
   }
 
   ///// LIGHT API
 
   std::set<uint8_t> IqrfDb::getLightAddresses() {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::LightRepository lightRepo(m_db);
+    db::repos::LightRepository lightRepo(m_db, m_statementCache);
     return lightRepo.getAddresses();
   }
 
   std::unordered_set<uint8_t> IqrfDb::getLightAddressesByDeviceIds(const std::vector<uint32_t> deviceIds) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::LightRepository lightRepo(m_db);
+    db::repos::LightRepository lightRepo(m_db, m_statementCache);
     return lightRepo.getAddressesByDeviceIds(deviceIds);
   }
 
@@ -348,13 +351,13 @@ namespace iqrf {
 
   std::optional<Product> IqrfDb::getProduct(const uint32_t productId) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::ProductRepository productRepo(m_db);
+    db::repos::ProductRepository productRepo(m_db, m_statementCache);
     return productRepo.get(productId);
   }
 
   std::unordered_map<uint32_t, Product> IqrfDb::getProductsMap(const std::set<uint32_t>& ids) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::ProductRepository productRepo(m_db);
+    db::repos::ProductRepository productRepo(m_db, m_statementCache);
     return productRepo.getProductsMap(ids);
   }
 
@@ -363,19 +366,19 @@ namespace iqrf {
   std::unique_ptr<Sensor> IqrfDb::getSensorByAddressIndexType(const uint8_t address, const uint8_t index,
     const uint8_t type) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::SensorRepository sensorRepo(m_db);
+    db::repos::SensorRepository sensorRepo(m_db, m_statementCache);
     return sensorRepo.getByAddressIndexType(address, index, type);
   }
 
   std::map<uint8_t, Sensor> IqrfDb::getDeviceSensorsMapByAddress(const uint8_t address) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::SensorRepository sensorRepo(m_db);
+    db::repos::SensorRepository sensorRepo(m_db, m_statementCache);
     return sensorRepo.getDeviceSensorIndexMap(address);
   }
 
   std::map<uint8_t, uint32_t> IqrfDb::getDeviceSensorsIdMapByAddress(const uint8_t address) {
     std::lock_guard<std::mutex> lock(m_dbMtx);
-    db::repos::SensorRepository sensorRepo(m_db);
+    db::repos::SensorRepository sensorRepo(m_db, m_statementCache);
     return sensorRepo.getDeviceSensorIdIndexMap(address);
   }
 
@@ -383,8 +386,10 @@ namespace iqrf {
 
   void IqrfDb::updateSensorValues(const std::map<uint8_t, std::vector<sensor::item::Sensor>> &devices) {
     TRC_FUNCTION_ENTER("");
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     std::shared_ptr<std::string> timestamp = IqrfDbAux::getCurrentTimestamp();
+    std::vector<db::repos::DeviceSensorValue> values;
+    std::vector<SensorBlock> blocks;
     for (auto &[addr, sensors] : devices) {
       auto dbDevice = deviceRepo.getByAddress(addr);
       if (dbDevice == nullptr) {
@@ -394,25 +399,21 @@ namespace iqrf {
         if (!sensor.isValueSet()) {
           continue;
         }
-        try {
-          if (sensor.getType() == 192) {
-            auto &v = sensor.hasBreakdown() ? sensor.getBreakdownValueArray() : sensor.getValueArray();
-            json block = {{"datablock", json(v)}};
-            this->setDeviceSensorMetadata(addr, sensor.getType(), sensor.getIdx(), block, timestamp, false);
+        if (sensor.getType() == 192) {
+          auto &v = sensor.hasBreakdown() ? sensor.getBreakdownValueArray() : sensor.getValueArray();
+          blocks.push_back({addr, sensor.getType(), sensor.getIdx(), {{"datablock", json(v)}}});
+        } else {
+          double val;
+          if (sensor.hasBreakdown()) {
+            val = sensor.getBreakdownValue();
           } else {
-            double val;
-            if (sensor.hasBreakdown()) {
-              val = sensor.getBreakdownValue();
-            } else {
-              val = sensor.getValue();
-            }
-            this->setDeviceSensorValue(addr, sensor.getType(), sensor.getIdx(), val, timestamp, false);
+            val = sensor.getValue();
           }
-        } catch (const std::logic_error &e) {
-          TRC_WARNING(e.what());
+          values.push_back({addr, sensor.getType(), sensor.getIdx(), val});
         }
       }
     }
+    storeSensorValues(values, blocks, timestamp, false);
     TRC_FUNCTION_LEAVE("");
   }
 
@@ -420,6 +421,8 @@ namespace iqrf {
     TRC_FUNCTION_ENTER("");
     json j = json::parse(sensors);
     std::shared_ptr<std::string> timestamp = IqrfDbAux::getCurrentTimestamp();
+    std::vector<db::repos::DeviceSensorValue> values;
+    std::vector<SensorBlock> blocks;
     for (uint8_t i = 0, n = j["sensors"].size(); i < n; ++i) {
       json item = j["sensors"][i];
       double val;
@@ -428,11 +431,7 @@ namespace iqrf {
           continue;
         }
         if (item["type"] == 192) {
-          if (item["value"].is_null()) {
-            continue;
-          }
-          json block = {{"datablock", item["value"]}};
-          this->setDeviceSensorMetadata(address, item["type"], i, block, timestamp, false);
+          blocks.push_back({address, item["type"], i, {{"datablock", item["value"]}}});
           continue;
         }
         val = item["value"];
@@ -441,11 +440,12 @@ namespace iqrf {
             val = item["breakdown"][0]["value"];
           }
         }
-        this->setDeviceSensorValue(address, item["type"], i, val, timestamp, false);
+        values.push_back({address, item["type"], i, val});
       } catch (const std::logic_error &e) {
         TRC_WARNING(e.what());
       }
     }
+    storeSensorValues(values, blocks, timestamp, false);
     TRC_FUNCTION_LEAVE("");
   }
 
@@ -453,56 +453,41 @@ namespace iqrf {
     TRC_FUNCTION_ENTER("");
     json j = json::parse(sensors);
     std::shared_ptr<std::string> timestamp = IqrfDbAux::getCurrentTimestamp();
+    std::vector<db::repos::DeviceSensorValue> values;
+    std::vector<SensorBlock> blocks;
+    auto addValue = [&](uint8_t addr, json &item) {
+      if (item["value"].is_null()) {
+        return;
+      }
+      if (type == 192) {
+        blocks.push_back({addr, type, index, {{"datablock", item["value"]}}});
+        return;
+      }
+      try {
+        double val = item["value"];
+        if (item["type"] == 129 || item["type"] == 160) {
+          if (!item["breakdown"][0]["value"].is_null()) {
+            val = item["breakdown"][0]["value"];
+          }
+        }
+        values.push_back({addr, type, index, val});
+      } catch (const std::logic_error &e) {
+        TRC_WARNING(e.what());
+      }
+    };
     if (selectedNodes.size() == 0) {
       for (uint8_t i = 0, n = j["sensors"].size(); i < n; ++i) {
         json item = j["sensors"][i];
-        if (item["value"].is_null()) {
-          continue;
-        }
-        if (type == 192) {
-          json block = {{"datablock", item["value"]}};
-          this->setDeviceSensorMetadata(i, type, index, block, timestamp, true);
-          continue;
-        }
-        double val;
-        try {
-          val = item["value"];
-          if (item["type"] == 129 || item["type"] == 160) {
-            if (!item["breakdown"][0]["value"].is_null()) {
-              val = item["breakdown"][0]["value"];
-            }
-          }
-          this->setDeviceSensorValue(i, type, index, val, timestamp, true);
-        } catch (const std::logic_error &e) {
-          TRC_WARNING(e.what());
-        }
+        addValue(i, item);
       }
     } else {
       uint8_t i = 1;
       for (auto it = selectedNodes.begin(); it != selectedNodes.end(); ++it, ++i) {
         json item = j["sensors"][i];
-        if (item["value"].is_null()) {
-          continue;
-        }
-        if (type == 192) {
-          json block = {{"datablock", item["value"]}};
-          this->setDeviceSensorMetadata(i, type, index, block, timestamp, true);
-          continue;
-        }
-        double val;
-        try {
-          val = item["value"];
-          if (item["type"] == 129 || item["type"] == 160) {
-            if (!item["breakdown"][0]["value"].is_null()) {
-              val = item["breakdown"][0]["value"];
-            }
-          }
-          this->setDeviceSensorValue(i, type, index, val, timestamp, true);
-        } catch (const std::logic_error &e) {
-          TRC_WARNING(e.what());
-        }
+        addValue(i, item);
       }
     }
+    storeSensorValues(values, blocks, timestamp, true);
     TRC_FUNCTION_LEAVE("");
   }
 
@@ -526,9 +511,28 @@ namespace iqrf {
     m_enumHandlers.erase(clientId);
   }
 
+  IIqrfDb::SensorStoreStats IqrfDb::getSensorStoreStats() {
+    SensorStoreStats stats;
+    {
+      std::lock_guard<std::mutex> lock(m_sensorStatsMtx);
+      stats = m_sensorFlushStats;
+    }
+    stats.writeBehind = m_sensorWriteBehind;
+    stats.dirtyValues = m_sensorStore.getDirtyCount();
+    auto oldest = m_sensorStore.getOldestDirty();
+    if (oldest.has_value()) {
+      stats.pendingAgeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        SensorValueStore::Clock::now() - oldest.value()
+      ).count();
+    }
+    return stats;
+  }
+
   ///// Private methods /////
 
   void IqrfDb::initializeDatabase() {
+    // cached statements keep previous connection open
+    m_statementCache = nullptr;
     m_db = std::make_shared<SQLite::Database>(
       SQLite::Database(
         m_dbPath,
@@ -542,11 +546,206 @@ namespace iqrf {
     } catch (const std::exception &e) {
       THROW_EXC_TRC_WAR(std::logic_error, "[IqrfDb] Failed to migrate database to latest version: " << e.what());
     }
+    m_statementCache = std::make_shared<db::repos::StatementCache>(m_db);
+    rebuildIndex();
+  }
+
+  void IqrfDb::rebuildIndex() {
+    TRC_FUNCTION_ENTER("");
+    std::shared_ptr<const IqrfDbIndex> index;
+    {
+      std::lock_guard<std::mutex> lock(m_dbMtx);
+      db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
+      db::repos::ProductRepository productRepo(m_db, m_statementCache);
+      db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
+      index = std::make_shared<const IqrfDbIndex>(
+        deviceRepo.getAll(),
+        productRepo.getProductsMap({}),
+        deviceSensorRepo.getAll()
+      );
+    }
+    std::atomic_store(&m_index, index);
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  std::shared_ptr<const IqrfDbIndex> IqrfDb::getIndex() const {
+    return std::atomic_load(&m_index);
+  }
+
+  void IqrfDb::updateDeviceSensorMetadata(db::repos::DeviceSensorRepository &deviceSensorRepo, const uint8_t address,
+    const uint8_t type, const uint8_t index, json &metadata, std::shared_ptr<std::string> updated, bool frc) {
+    auto ds = deviceSensorRepo.getByAddressTypeIndex(address, type, index, frc);
+    if (ds == nullptr) {
+      throw std::logic_error("Device at address " + std::to_string(address)
+        + " does not implement sensor of type " + std::to_string(type)
+        + " at index " + std::to_string(index)
+      );
+    }
+    std::shared_ptr<std::string> current = ds->getMetadata();
+    if (current) {
+      json j = json::parse(*current.get());
+      if (j.count("datablock")) {
+        metadata["datablock"] = j["datablock"];
+      }
+    }
+    current = std::make_shared<std::string>(metadata.dump());
+    // value column is not rewritten, value of the same sensor may be pending in write-behind store
+    bool datablock = metadata.count("datablock") > 0;
+    if (datablock) {
+      ds->setUpdated(updated);
+    }
+    ds->setMetadata(current);
+    deviceSensorRepo.updateMetadata(*ds, datablock);
+  }
+
+  void IqrfDb::storeSensorValues(const std::vector<db::repos::DeviceSensorValue> &values, std::vector<SensorBlock> &blocks,
+    std::shared_ptr<std::string> updated, bool frc) {
+    std::vector<db::repos::DeviceSensorValue> missing;
+    if (m_sensorWriteBehind) {
+      // values are written by flush thread, data blocks are stored right away
+      missing = bufferSensorValues(values, updated, frc);
+    }
+    if (!blocks.empty() || (!m_sensorWriteBehind && !values.empty())) {
+      std::lock_guard<std::mutex> lock(m_dbMtx);
+      db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
+      // single transaction, values of whole sweep are synced to disk once
+      SQLite::Transaction transaction(*m_db);
+      for (auto &block : blocks) {
+        try {
+          updateDeviceSensorMetadata(deviceSensorRepo, block.address, block.type, block.index, block.metadata, updated, frc);
+        } catch (const std::logic_error &e) {
+          TRC_WARNING(e.what());
+        }
+      }
+      if (!m_sensorWriteBehind) {
+        missing = deviceSensorRepo.updateValues(values, updated, frc);
+      }
+      transaction.commit();
+    }
+    for (const auto &item : missing) {
+      TRC_WARNING("Device at address " << std::to_string(item.address)
+        << " does not implement sensor of type " << std::to_string(item.type)
+        << " at index " << std::to_string(item.index)
+      );
+    }
+  }
+
+  std::vector<db::repos::DeviceSensorValue> IqrfDb::bufferSensorValues(const std::vector<db::repos::DeviceSensorValue> &values,
+    std::shared_ptr<std::string> updated, bool frc) {
+    std::vector<db::repos::DeviceSensorValue> missing;
+    auto index = getIndex();
+    for (const auto &item : values) {
+      // values are stored by global index, FRC values are indexed by type index
+      std::optional<uint8_t> globalIndex = item.index;
+      if (frc) {
+        globalIndex = index->getGlobalSensorIndex(item.address, item.type, item.index);
+      } else if (!index->hasSensor(item.address, item.type, item.index)) {
+        globalIndex = std::nullopt;
+      }
+      if (!globalIndex.has_value()) {
+        missing.push_back(item);
+        continue;
+      }
+      m_sensorStore.set(item.address, item.type, globalIndex.value(), item.value, updated);
+    }
+    return missing;
+  }
+
+  void IqrfDb::flushSensorValues() {
+    TRC_FUNCTION_ENTER("");
+    std::lock_guard<std::mutex> flushLock(m_sensorFlushMtx);
+    auto dirty = m_sensorStore.takeDirty();
+    if (dirty.empty()) {
+      TRC_FUNCTION_LEAVE("");
+      return;
+    }
+    auto start = SensorValueStore::Clock::now();
+    auto oldest = start;
+    // values of one measurement share timestamp and are written by one statement
+    std::map<std::shared_ptr<std::string>, std::vector<db::repos::DeviceSensorValue>> measurements;
+    for (const auto &item : dirty) {
+      measurements[item.updated].push_back({item.address, item.type, item.globalIndex, item.value});
+      oldest = std::min(oldest, item.since);
+    }
+    std::size_t missing = 0;
+    try {
+      std::lock_guard<std::mutex> lock(m_dbMtx);
+      db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
+      SQLite::Transaction transaction(*m_db);
+      for (const auto &[updated, values] : measurements) {
+        missing += deviceSensorRepo.updateValues(values, updated, false).size();
+      }
+      transaction.commit();
+    } catch (const std::exception &e) {
+      m_sensorStore.restoreDirty(dirty);
+      {
+        std::lock_guard<std::mutex> lock(m_sensorStatsMtx);
+        ++m_sensorFlushStats.failedFlushes;
+      }
+      CATCH_EXC_TRC_WAR(std::exception, e, "Failed to flush sensor values: " << e.what());
+      TRC_FUNCTION_LEAVE("");
+      return;
+    }
+    auto end = SensorValueStore::Clock::now();
+    uint64_t duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    uint64_t latency = std::chrono::duration_cast<std::chrono::milliseconds>(end - oldest).count();
+    {
+      std::lock_guard<std::mutex> lock(m_sensorStatsMtx);
+      auto &stats = m_sensorFlushStats;
+      ++stats.flushes;
+      stats.flushedValues += dirty.size() - missing;
+      stats.lastFlushDurationUs = duration;
+      stats.maxFlushDurationUs = std::max(stats.maxFlushDurationUs, duration);
+      stats.lastFlushLatencyMs = latency;
+      stats.maxFlushLatencyMs = std::max(stats.maxFlushLatencyMs, latency);
+    }
+    if (missing > 0) {
+      TRC_WARNING("Dropped " << missing << " sensor values of device sensors removed before flush.");
+    }
+    TRC_DEBUG("Flushed sensor values: " << PAR(dirty.size()) << PAR(duration) << PAR(latency));
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  void IqrfDb::startSensorFlushThread() {
+    TRC_FUNCTION_ENTER("");
+    m_flushThreadRun = true;
+    m_flushThread = std::thread([&]() {
+      runSensorFlush();
+    });
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  void IqrfDb::stopSensorFlushThread() {
+    TRC_FUNCTION_ENTER("");
+    {
+      std::lock_guard<std::mutex> lock(m_flushMutex);
+      m_flushThreadRun = false;
+    }
+    m_flushCv.notify_all();
+    if (m_flushThread.joinable()) {
+      m_flushThread.join();
+    }
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  void IqrfDb::runSensorFlush() {
+    TRC_FUNCTION_ENTER("");
+    std::unique_lock<std::mutex> lock(m_flushMutex);
+    while (true) {
+      m_flushCv.wait_for(lock, std::chrono::seconds(m_sensorFlushPeriod), [&] { return !m_flushThreadRun; });
+      if (!m_flushThreadRun) {
+        break;
+      }
+      lock.unlock();
+      flushSensorValues();
+      lock.lock();
+    }
+    TRC_FUNCTION_LEAVE("");
   }
 
   void IqrfDb::updateDbProductNames() {
     TRC_FUNCTION_ENTER("");
-    db::repos::ProductRepository productRepo(m_db);
+    db::repos::ProductRepository productRepo(m_db, m_statementCache);
     for (auto dbProduct : productRepo.getAllWithIncompleteProductInfo()) {
       if (dbProduct.getName().has_value() && dbProduct.getManufacturer().has_value()) {
         continue;
@@ -564,7 +763,7 @@ namespace iqrf {
 
   void IqrfDb::updateDbDrivers() {
     TRC_FUNCTION_ENTER("");
-    db::repos::DriverRepository driverRepo(m_db);
+    db::repos::DriverRepository driverRepo(m_db, m_statementCache);
     for (auto &dbDriver : driverRepo.getAll()) {
       auto driver = m_cacheService->getDriver(dbDriver.getPeripheralNumber(), dbDriver.getVersion());
       if (driver == nullptr) {
@@ -609,6 +808,60 @@ namespace iqrf {
     TRC_FUNCTION_LEAVE("");
   }
 
+  void IqrfDb::requestDriversReload() {
+    TRC_FUNCTION_ENTER("");
+    {
+      std::lock_guard<std::mutex> lock(m_reloadMutex);
+      m_reloadRequested = true;
+    }
+    m_reloadCv.notify_all();
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  void IqrfDb::startDriversReloadThread() {
+    TRC_FUNCTION_ENTER("");
+    m_reloadThreadRun = true;
+    m_reloadThread = std::thread([&]() {
+      runDriversReload();
+    });
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  void IqrfDb::stopDriversReloadThread() {
+    TRC_FUNCTION_ENTER("");
+    {
+      std::lock_guard<std::mutex> lock(m_reloadMutex);
+      m_reloadThreadRun = false;
+    }
+    m_reloadCv.notify_all();
+    if (m_reloadThread.joinable()) {
+      m_reloadThread.join();
+    }
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  void IqrfDb::runDriversReload() {
+    TRC_FUNCTION_ENTER("");
+    std::unique_lock<std::mutex> lock(m_reloadMutex);
+    while (true) {
+      m_reloadCv.wait(lock, [&] { return m_reloadRequested || !m_reloadThreadRun; });
+      if (!m_reloadThreadRun) {
+        break;
+      }
+      // requests arriving during reload are served by one more reload
+      m_reloadRequested = false;
+      lock.unlock();
+      try {
+        updateDbDrivers();
+        reloadDrivers();
+      } catch (const std::exception &e) {
+        CATCH_EXC_TRC_WAR(std::exception, e, "Failed to reload drivers: " << e.what());
+      }
+      lock.lock();
+    }
+    TRC_FUNCTION_LEAVE("");
+  }
+
   void IqrfDb::analyzeDpaMessage(const DpaMessage &message) {
     auto direction = message.MessageDirection();
     // not a response
@@ -653,6 +906,11 @@ namespace iqrf {
         if (!m_dpaService->hasExclusiveAccess()) {
           waitForExclusiveAccess();
           TRC_INFORMATION("Running enumeration with: " << PAR(m_params.reenumerate) << PAR(m_params.standards));
+          if (m_sensorWriteBehind) {
+            // enumeration may replace device sensors, buffered values are written to current records first
+            flushSensorValues();
+            m_sensorStore.evictClean();
+          }
           sendEnumerationResponse(EnumerationProgress(EnumerationProgress::Steps::Start));
           checkNetwork(m_params.reenumerate);
           sendEnumerationResponse(EnumerationProgress(EnumerationProgress::Steps::NetworkDone));
@@ -664,7 +922,10 @@ namespace iqrf {
           sendEnumerationResponse(EnumerationProgress(EnumerationProgress::Steps::Products));
           productPackageEnumeration();
           updateDatabaseProducts();
-          loadProductDrivers();
+          {
+            std::lock_guard<std::mutex> lock(m_driverLoadMtx);
+            loadProductDrivers();
+          }
           sendEnumerationResponse(EnumerationProgress(EnumerationProgress::Steps::ProductsDone));
 
           if (m_params.standards || m_params.reenumerate) {
@@ -672,6 +933,7 @@ namespace iqrf {
             standardEnumeration();
             sendEnumerationResponse(EnumerationProgress(EnumerationProgress::Steps::StandardsDone));
           }
+          rebuildIndex();
           sendEnumerationResponse(EnumerationProgress(EnumerationProgress::Steps::Finish));
           resetExclusiveAccess();
           m_enumRepeat = false;
@@ -710,7 +972,7 @@ namespace iqrf {
       THROW_EXC(std::logic_error, e.what());
     }
 
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
 
     for (const auto &device : deviceRepo.getAll()) {
       uint8_t addr = device.getAddress();
@@ -1290,9 +1552,9 @@ namespace iqrf {
 
   void IqrfDb::productPackageEnumeration() {
     TRC_FUNCTION_ENTER("");
-    db::repos::DriverRepository driverRepo(m_db);
-    db::repos::ProductRepository productRepo(m_db);
-    db::repos::ProductDriverRepository productDriverRepo(m_db);
+    db::repos::DriverRepository driverRepo(m_db, m_statementCache);
+    db::repos::ProductRepository productRepo(m_db, m_statementCache);
+    db::repos::ProductDriverRepository productDriverRepo(m_db, m_statementCache);
     if (m_deviceProductMap.count(0) != 0) {
       m_toEnumerate.insert(0);
     }
@@ -1310,12 +1572,12 @@ namespace iqrf {
       uint16_t hwpidVersion = product->getHwpidVersion();
       uint16_t osBuild = product->getOsBuild();
       uint16_t dpaVersion = product->getDpaVersion();
-      std::shared_ptr<IJsCacheService::Product> cacheProduct = m_cacheService->getProduct(hwpid);
+      std::shared_ptr<const IJsCacheService::Product> cacheProduct = m_cacheService->getProduct(hwpid);
       if (cacheProduct != nullptr) {
         product->setManufacturer(cacheProduct->m_companyName);
         product->setName(cacheProduct->m_name);
       }
-      std::shared_ptr<IJsCacheService::Package> package = m_cacheService->getPackage(
+      std::shared_ptr<const IJsCacheService::Package> package = m_cacheService->getPackage(
         hwpid,
         hwpidVersion,
         osBuild,
@@ -1368,8 +1630,8 @@ namespace iqrf {
       if (package->m_handlerHash.length() != 0) {
         product->setHandlerHash(package->m_handlerHash);
       }
-      if (package->m_driver.length() != 0) {
-        product->setCustomDriver(package->m_driver);
+      if (package->m_driver->length() != 0) {
+        product->setCustomDriver(*package->m_driver);
       }
       product->setPackageId(package->m_packageId);
       for (auto &item : package->m_stdDriverVect) {
@@ -1396,9 +1658,9 @@ namespace iqrf {
   }
 
   void IqrfDb::enumerateNoncertifiedProduct(const uint8_t &addr) {
-    db::repos::DriverRepository driverRepo(m_db);
-    db::repos::ProductRepository productRepo(m_db);
-    db::repos::ProductDriverRepository productDriverRepo(m_db);
+    db::repos::DriverRepository driverRepo(m_db, m_statementCache);
+    db::repos::ProductRepository productRepo(m_db, m_statementCache);
+    db::repos::ProductDriverRepository productDriverRepo(m_db, m_statementCache);
     auto &product = m_deviceProductMap[addr];
     auto dbProductId = productRepo.getNoncertifiedProductId(
       product->getHwpid(),
@@ -1444,9 +1706,9 @@ namespace iqrf {
   void IqrfDb::updateDatabaseProducts() {
     TRC_FUNCTION_ENTER("");
     SQLite::Transaction transaction(*m_db);
-    db::repos::DeviceRepository deviceRepo(m_db);
-    db::repos::ProductDriverRepository productDriverRepo(m_db);
-    db::repos::ProductRepository productRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
+    db::repos::ProductDriverRepository productDriverRepo(m_db, m_statementCache);
+    db::repos::ProductRepository productRepo(m_db, m_statementCache);
     for (auto &deviceId : m_toDelete) {
       deviceRepo.remove(deviceId);
     }
@@ -1538,7 +1800,7 @@ namespace iqrf {
 
   void IqrfDb::standardEnumeration() {
     TRC_FUNCTION_ENTER("");
-    db::repos::DeviceRepository deviceRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
     // select devices to enumerate
     std::map<uint32_t, uint8_t> devices;
     for (auto &device : deviceRepo.getAll()) {
@@ -1583,7 +1845,7 @@ namespace iqrf {
   void IqrfDb::enumerateBinaryOutputFromMetadata(uint32_t deviceId, uint8_t count) {
     TRC_FUNCTION_ENTER(PAR(deviceId) << PAR(count));
 
-    db::repos::BinaryOutputRepository binaryOutputRepo(m_db);
+    db::repos::BinaryOutputRepository binaryOutputRepo(m_db, m_statementCache);
     if (count == 0) {
       // no binouts, remove record if exists
       binaryOutputRepo.removeByDeviceId(deviceId);
@@ -1608,7 +1870,7 @@ namespace iqrf {
   void IqrfDb::enumerateBinaryOutputFromNetwork(uint32_t deviceId, uint8_t address) {
     TRC_FUNCTION_ENTER(PAR(deviceId) << PAR(address));
 
-    db::repos::BinaryOutputRepository binaryOutputRepo(m_db);
+    db::repos::BinaryOutputRepository binaryOutputRepo(m_db, m_statementCache);
     if (!this->deviceImplementsPeripheral(deviceId, PERIPHERAL_BINOUT)) {
       // no binouts, remove record if exists
       binaryOutputRepo.removeByDeviceId(deviceId);
@@ -1646,7 +1908,7 @@ namespace iqrf {
   void IqrfDb::enumerateLightFromMetadata(uint32_t deviceId, const std::optional<metadata::Light>& light) {
     TRC_FUNCTION_ENTER(PAR(deviceId));
 
-    db::repos::LightRepository lightRepo(m_db);
+    db::repos::LightRepository lightRepo(m_db, m_statementCache);
     if (!light.has_value()) {
       // no light, remove record if exists
       lightRepo.removeByDeviceId(deviceId);
@@ -1666,7 +1928,7 @@ namespace iqrf {
   void IqrfDb::enumerateLightFromNetwork(uint32_t deviceId) {
     TRC_FUNCTION_ENTER(PAR(deviceId));
 
-    db::repos::LightRepository lightRepo(m_db);
+    db::repos::LightRepository lightRepo(m_db, m_statementCache);
     if (!this->deviceImplementsPeripheral(deviceId, PERIPHERAL_LIGHT)) {
       // no light, remove record if exists
       lightRepo.removeByDeviceId(deviceId);
@@ -1684,7 +1946,7 @@ namespace iqrf {
   void IqrfDb::enumerateSensorFromMetadata(uint8_t address, uint16_t hwpid, const std::vector<uint8_t>& sensorTypes) {
     TRC_FUNCTION_ENTER(PAR(address) << PAR(hwpid));
 
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
+    db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
     if (sensorTypes.empty()) {
       // no sensors, remove records if exist
       deviceSensorRepo.removeMultipleByAddress(address);
@@ -1720,7 +1982,7 @@ namespace iqrf {
     );
     json data = json::parse(response);
 
-    db::repos::SensorRepository sensorRepo(m_db);
+    db::repos::SensorRepository sensorRepo(m_db, m_statementCache);
     auto oldSensors = deviceSensorRepo.getGlobalIndexSensorIdMap(address);
     uint8_t cnt[255] = {0};
     uint8_t idx = 0;
@@ -1780,14 +2042,14 @@ namespace iqrf {
   void IqrfDb::enumerateSensorFromNetwork(uint32_t deviceId, uint8_t address) {
     TRC_FUNCTION_ENTER(PAR(deviceId) << PAR(address));
 
-    db::repos::DeviceSensorRepository deviceSensorRepo(m_db);
+    db::repos::DeviceSensorRepository deviceSensorRepo(m_db, m_statementCache);
     if (!this->deviceImplementsPeripheral(deviceId, PERIPHERAL_SENSOR)) {
       // no sensors, remove records if exist
       deviceSensorRepo.removeMultipleByAddress(address);
       return;
     }
 
-    db::repos::SensorRepository sensorRepo(m_db);
+    db::repos::SensorRepository sensorRepo(m_db, m_statementCache);
     std::unique_ptr<IDpaTransactionResult2> result;
     sensor::jsdriver::Enumerate sensorEnum(m_renderService, address);
     m_dpaService->executeDpaTransactionRepeat(sensorEnum.getRequest(), result, 1);
@@ -1847,8 +2109,9 @@ namespace iqrf {
     TRC_FUNCTION_LEAVE("");
   }
 
-  void IqrfDb::loadCoordinatorDrivers() {
+  std::set<int> IqrfDb::loadCoordinatorDrivers() {
     TRC_FUNCTION_ENTER("");
+    std::set<int> contextIds = {IJsRenderService::HWPID_DEFAULT_MAPPING};
     std::string wrapper = loadWrapper();
     m_coordinatorParams = m_dpaService->getCoordinatorParameters();
     uint16_t osBuild = m_coordinatorParams.osBuildWord;
@@ -1911,6 +2174,7 @@ namespace iqrf {
 
     std::stringstream ss;
     std::set<uint32_t> driversToLoad;
+    std::set<std::string> driverHashes;
 
     for (auto &[driverId, versionMap] : drivers) {
       double driverVersion = 0;
@@ -1923,9 +2187,10 @@ namespace iqrf {
         TRC_WARNING("No driver version found for driver ID: " << driverId);
       }
 
-      std::shared_ptr<IJsCacheService::StdDriver> cacheDriver = m_cacheService->getDriver(driverId, driverVersion);
+      std::shared_ptr<const IJsCacheService::StdDriver> cacheDriver = m_cacheService->getDriver(driverId, driverVersion);
       if (cacheDriver != nullptr) {
         ss << *cacheDriver->getDriver();
+        driverHashes.insert(generateDriverHash(*cacheDriver->getDriver()));
         TRC_DEBUG("[C] Loading driver ID " << driverId << ", version " << driverVersion);
       } else {
         TRC_WARNING("[C] No driver found in cache for ID: " << driverId << ", version: " << driverVersion);
@@ -1935,12 +2200,14 @@ namespace iqrf {
           cacheDriver = m_cacheService->getDriver(driverId, 0);
           if (cacheDriver != nullptr) {
             ss << *cacheDriver->getDriver();
+            driverHashes.insert(generateDriverHash(*cacheDriver->getDriver()));
             TRC_INFORMATION("Loading deprecated DALI driver for LIGHT backward compatibility.");
           }
         } else {
           cacheDriver = m_cacheService->getDriver(driverId, 1);
           if (cacheDriver != nullptr) {
             ss << *cacheDriver->getDriver();
+            driverHashes.insert(generateDriverHash(*cacheDriver->getDriver()));
             TRC_INFORMATION("Loading LIGHT driver for DALI forward compatibility.")
           }
         }
@@ -1949,25 +2216,32 @@ namespace iqrf {
 
     ss << wrapper;
 
-    m_renderService->loadContextCode(IJsRenderService::HWPID_DEFAULT_MAPPING, ss.str(), driversToLoad);
+    std::string defaultCode = ss.str();
+    if (m_renderService->loadContextCode(IJsRenderService::HWPID_DEFAULT_MAPPING, defaultCode, driversToLoad, generateDriverHash(defaultCode))) {
+      driverHashes.insert(generateDriverHash(wrapper));
+      m_renderService->setContextDriverHashes(IJsRenderService::HWPID_DEFAULT_MAPPING, driverHashes);
+    }
 
     auto customDrivers = m_cacheService->getCustomDrivers(m_coordinatorParams.osBuild, m_coordinatorParams.dpaVerWordAsStr);
 
     for (auto &driver : customDrivers) {
-      std::string customDriverToLoad = ss.str();
+      std::string customDriverToLoad = defaultCode;
       customDriverToLoad += driver.second.rbegin()->second;
-      m_renderService->loadContextCode(IJsRenderService::HWPID_MAPPING_SPACE - driver.first, customDriverToLoad, driversToLoad);
+      m_renderService->loadContextCode(IJsRenderService::HWPID_MAPPING_SPACE - driver.first, customDriverToLoad, driversToLoad, generateDriverHash(customDriverToLoad));
+      contextIds.insert(IJsRenderService::HWPID_MAPPING_SPACE - driver.first);
     }
     TRC_FUNCTION_LEAVE("");
+    return contextIds;
   }
 
-  void IqrfDb::loadProductDrivers() {
+  bool IqrfDb::loadProductDrivers(bool reloadAll, std::set<int> *contextIds, std::map<int, int> *addressContexts) {
     TRC_FUNCTION_ENTER("");
-    db::repos::DeviceRepository deviceRepo(m_db);
-    db::repos::DriverRepository driverRepo(m_db);
-    db::repos::ProductDriverRepository productDriverRepo(m_db);
-    db::repos::ProductRepository productRepo(m_db);
+    db::repos::DeviceRepository deviceRepo(m_db, m_statementCache);
+    db::repos::DriverRepository driverRepo(m_db, m_statementCache);
+    db::repos::ProductDriverRepository productDriverRepo(m_db, m_statementCache);
+    db::repos::ProductRepository productRepo(m_db, m_statementCache);
     std::string wrapper = loadWrapper();
+    std::string wrapperHash = generateDriverHash(wrapper);
 
     try {
 
@@ -1978,6 +2252,17 @@ namespace iqrf {
 
       auto deviceAddrProductIdMap = deviceRepo.getAddressProductIdMap();
       for (auto &[addr, productId] : deviceAddrProductIdMap) {
+        if (contextIds != nullptr) {
+          contextIds->insert(static_cast<int>(productId));
+        }
+        if (addressContexts != nullptr) {
+          addressContexts->insert(std::make_pair(static_cast<int>(addr), static_cast<int>(productId)));
+        }
+        if (reloadAll) {
+          // code of unchanged contexts is not compiled again
+          productsToLoad.insert(productId);
+          continue;
+        }
         if (productsToLoad.count(productId)) {
           continue;
         }
@@ -2008,8 +2293,10 @@ namespace iqrf {
         std::ostringstream drv, adr;
         std::stringstream ss;
         std::set<uint32_t> driverSet;
+        std::set<std::string> driverHashes;
         for (auto driver : drivers) {
           driverSet.insert(driver.getId());
+          driverHashes.insert(driver.getDriverHash());
           ss << driver.getDriver() << std::endl;
           drv << '[' << driver.getPeripheralNumber() << ',' << std::fixed << std::setprecision(2) << driver.getVersion() << ']';
         }
@@ -2018,7 +2305,8 @@ namespace iqrf {
           ss << customDriver.value() << std::endl;
         }
         ss << wrapper << std::endl;
-        bool success = m_renderService->loadContextCode(productId, ss.str(), driverSet);
+        std::string code = ss.str();
+        bool success = m_renderService->loadContextCode(productId, code, driverSet, generateDriverHash(code));
 
         if (!success) {
           TRC_WARNING_CHN(
@@ -2028,6 +2316,11 @@ namespace iqrf {
           );
           continue;
         }
+        // native driver functions replace known driver code only, custom driver may override it
+        if (!customDriver.has_value()) {
+          driverHashes.insert(wrapperHash);
+          m_renderService->setContextDriverHashes(productId, driverHashes);
+        }
 
         auto addresses = deviceRepo.getProductAddresses(productId);
 
@@ -2042,11 +2335,21 @@ namespace iqrf {
           << std::endl
         );
       }
+      auto heapStats = m_renderService->getHeapStats();
+      TRC_INFORMATION_CHN(33, "iqrf::JsCache", "Driver contexts: " << heapStats.contextCount
+        << ", heaps: " << heapStats.heapCount
+        << ", heap memory: " << heapStats.heapBytes << " B"
+        << ", saved by shared heaps: " << heapStats.savedBytes << " B"
+        << std::endl
+      );
     } catch (std::exception &e) {
       CATCH_EXC_TRC_WAR(std::exception, e, "Failed to load drivers: " << e.what());
+      TRC_FUNCTION_LEAVE("");
+      return false;
     }
 
     TRC_FUNCTION_LEAVE("");
+    return true;
   }
 
   ///// Auxiliary functions /////
@@ -2138,8 +2441,7 @@ namespace iqrf {
     );
     modify(props);
     m_cacheService->registerCacheReloadedHandler(m_instance, [&]() {
-      updateDbDrivers();
-      reloadDrivers();
+      requestDriversReload();
     });
     m_dpaService->registerAnyMessageHandler(m_instance, [&](const DpaMessage &msg) {
       analyzeDpaMessage(msg);
@@ -2148,6 +2450,10 @@ namespace iqrf {
     updateDbProductNames();
     updateDbDrivers();
     reloadDrivers();
+    startDriversReloadThread();
+    if (m_sensorWriteBehind) {
+      startSensorFlushThread();
+    }
 
     m_enumRun = false;
     m_enumRepeat = false;
@@ -2175,6 +2481,14 @@ namespace iqrf {
     m_autoEnumerateBeforeInvoked = Pointer("/autoEnumerateBeforeInvoked").Get(doc)->GetBool();
     m_enumerateOnLaunch = Pointer("/enumerateOnLaunch").Get(doc)->GetBool();
     m_metadataToMessages = Pointer("/metadataToMessages").Get(doc)->GetBool();
+    const Value *val = Pointer("/sensorWriteBehind").Get(doc);
+    if (val && val->IsBool()) {
+      m_sensorWriteBehind = val->GetBool();
+    }
+    val = Pointer("/sensorFlushPeriod").Get(doc);
+    if (val && val->IsUint() && val->GetUint() > 0) {
+      m_sensorFlushPeriod = val->GetUint();
+    }
     TRC_FUNCTION_LEAVE("");
   }
 
@@ -2187,8 +2501,13 @@ namespace iqrf {
     );
     stopEnumerationThread();
     m_cacheService->unregisterCacheReloadedHandler(m_instance);
+    stopDriversReloadThread();
     m_dpaService->unregisterAnyMessageHandler(m_instance);
+    stopSensorFlushThread();
+    // buffered values are written before the database is closed
+    flushSensorValues();
     clearAuxBuffers();
+    m_statementCache = nullptr;
     TRC_FUNCTION_LEAVE("");
   }
 
@@ -27,6 +27,8 @@
 #include <vector>
 
 #include "IIqrfDb.h"
+#include "IqrfDbIndex.h"
+#include "SensorValueStore.h"
 
 #include "IIqrfDpaService.h"
 #include "IJsCacheService.h"
@@ -40,6 +42,8 @@
 #include <nlohmann/json.hpp>
 #include "rapidjson/document.h"
 #include <SQLiteCpp/SQLiteCpp.h>
+#include "device_sensor_repo.hpp"
+#include "statement_cache.hpp"
 
 using namespace iqrf::db::models;
 
@@ -91,6 +95,8 @@ namespace iqrf {
 
     /**
      * Reloads all drivers
+     *
+     * Contexts with unchanged code are kept, running driver calls are not interrupted.
      */
     void reloadDrivers() override;
 
@@ -383,6 +389,12 @@ namespace iqrf {
      */
     void unregisterEnumerationHandler(const std::string &clientId) override;
 
+    /**
+     * Returns statistics of write-behind sensor value store
+     * @return Sensor value store statistics
+     */
+    SensorStoreStats getSensorStoreStats() override;
+
     /**
      * Component instance lifecycle activate step
      * @param props Component instance properties
@@ -468,6 +480,82 @@ namespace iqrf {
      */
     void initializeDatabase();
 
+    /**
+     * Builds index of device attributes and sensor indexes from database and publishes it
+     */
+    void rebuildIndex();
+
+    /**
+     * Returns current index of device attributes and sensor indexes
+     * @return Index
+     */
+    std::shared_ptr<const IqrfDbIndex> getIndex() const;
+
+    /// Sensor data block to store as device sensor metadata
+    struct SensorBlock {
+      /// Device address
+      uint8_t address;
+      /// Sensor type
+      uint8_t type;
+      /// Sensor index
+      uint8_t index;
+      /// Sensor metadata
+      nlohmann::json metadata;
+    };
+
+    /**
+     * Stores sensor value as metadata, caller holds database lock
+     * @param deviceSensorRepo Device sensor repository
+     * @param address Device address
+     * @param type Sensor type
+     * @param index Sensor index
+     * @param metadata Last measured value
+     * @param updated Last updated
+     * @param frc Data from FRC response
+     */
+    void updateDeviceSensorMetadata(db::repos::DeviceSensorRepository &deviceSensorRepo, const uint8_t address,
+      const uint8_t type, const uint8_t index, nlohmann::json &metadata, std::shared_ptr<std::string> updated, bool frc);
+
+    /**
+     * Stores sensor values and data blocks of single measurement in one transaction
+     * @param values Sensor values
+     * @param blocks Sensor data blocks
+     * @param updated Measurement timestamp shared by all values
+     * @param frc Data from FRC response
+     */
+    void storeSensorValues(const std::vector<db::repos::DeviceSensorValue> &values, std::vector<SensorBlock> &blocks,
+      std::shared_ptr<std::string> updated, bool frc);
+
+    /**
+     * Keeps sensor values in write-behind store, values of sensors not implemented by devices are dropped
+     * @param values Sensor values
+     * @param updated Measurement timestamp shared by all values
+     * @param frc Data from FRC response
+     * @return Values of sensors not implemented by devices
+     */
+    std::vector<db::repos::DeviceSensorValue> bufferSensorValues(const std::vector<db::repos::DeviceSensorValue> &values,
+      std::shared_ptr<std::string> updated, bool frc);
+
+    /**
+     * Writes dirty values of write-behind store to database in one transaction
+     */
+    void flushSensorValues();
+
+    /**
+     * Starts thread flushing write-behind store periodically
+     */
+    void startSensorFlushThread();
+
+    /**
+     * Stops thread flushing write-behind store
+     */
+    void stopSensorFlushThread();
+
+    /**
+     * Sensor flush thread loop
+     */
+    void runSensorFlush();
+
     /**
      * Assign product names if product doesn't have a name and is available in cache
      */
@@ -489,6 +577,26 @@ namespace iqrf {
      */
     void stopEnumerationThread();
 
+    /**
+     * Requests reload of drivers in driver reload thread, returns immediately
+     */
+    void requestDriversReload();
+
+    /**
+     * Starts driver reload thread
+     */
+    void startDriversReloadThread();
+
+    /**
+     * Stops driver reload thread
+     */
+    void stopDriversReloadThread();
+
+    /**
+     * Reloads drivers on request until the driver reload thread is stopped
+     */
+    void runDriversReload();
+
     /**
      * Analyzes DPA responses and triggers enumeration if network altering action has been performed.
      * @param message DPA response
@@ -690,13 +798,18 @@ namespace iqrf {
 
     /**
      * Loads default drivers based on coordinator information
+     * @return IDs of default and custom driver contexts
      */
-    void loadCoordinatorDrivers();
+    std::set<int> loadCoordinatorDrivers();
 
     /**
      * Loads drivers coresponding to the products
+     * @param reloadAll Load drivers of all products, contexts with unchanged code are kept
+     * @param contextIds IDs of product contexts are added if not nullptr
+     * @param addressContexts Product context IDs by device address are added if not nullptr
+     * @return true if drivers were loaded, false on failure
      */
-    void loadProductDrivers();
+    bool loadProductDrivers(bool reloadAll = false, std::set<int> *contextIds = nullptr, std::map<int, int> *addressContexts = nullptr);
 
     /**
      * Generate driver hash
@@ -737,6 +850,10 @@ namespace iqrf {
     std::mutex m_dbMtx;
     /// Database accessor
     std::shared_ptr<SQLite::Database> m_db = nullptr;
+    /// Prepared statement cache of database connection, released before the connection
+    std::shared_ptr<db::repos::StatementCache> m_statementCache = nullptr;
+    /// Index of device attributes and sensor indexes, accessed by atomic_load and atomic_store
+    std::shared_ptr<const IqrfDbIndex> m_index = std::make_shared<const IqrfDbIndex>();
     /// DPA service
     IIqrfDpaService *m_dpaService = nullptr;
     /// Enumeration condition variable
@@ -775,6 +892,18 @@ namespace iqrf {
     bool m_enumerateOnLaunch = false;
     /// Include device metadata in responses
     bool m_metadataToMessages = false;
+    /// Keep sensor values in memory and write them to database periodically
+    bool m_sensorWriteBehind = false;
+    /// Period of writing sensor values to database in seconds
+    uint32_t m_sensorFlushPeriod = 60;
+    /// Latest sensor values not written to database yet
+    SensorValueStore m_sensorStore;
+    /// Sensor flush mutex, serializes flushes
+    std::mutex m_sensorFlushMtx;
+    /// Sensor flush statistics mutex
+    std::mutex m_sensorStatsMtx;
+    /// Sensor flush statistics
+    SensorStoreStats m_sensorFlushStats;
     /// Controls whether enumeration should run or stop
     std::atomic_bool m_enumRun;
     /// Repeat enumeration in case of a failure
@@ -791,5 +920,25 @@ namespace iqrf {
     std::map<std::string, EnumerationHandler> m_enumHandlers;
     /// Enumeration parameters
     EnumParams m_params;
+    /// Driver loading mutex, serializes loading of driver contexts
+    std::mutex m_driverLoadMtx;
+    /// Run driver reload thread
+    bool m_reloadThreadRun = false;
+    /// Driver reload requested
+    bool m_reloadRequested = false;
+    /// Driver reload condition variable
+    std::condition_variable m_reloadCv;
+    /// Driver reload mutex
+    std::mutex m_reloadMutex;
+    /// Driver reload thread
+    std::thread m_reloadThread;
+    /// Run sensor flush thread
+    bool m_flushThreadRun = false;
+    /// Sensor flush condition variable
+    std::condition_variable m_flushCv;
+    /// Sensor flush thread mutex
+    std::mutex m_flushMutex;
+    /// Sensor flush thread
+    std::thread m_flushThread;
   };
 }
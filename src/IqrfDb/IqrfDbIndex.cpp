@@ -0,0 +1,97 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IqrfDbIndex.h"
+
+namespace iqrf {
+
+  IqrfDbIndex::IqrfDbIndex(const std::vector<db::models::Device> &devices,
+    const std::unordered_map<uint32_t, db::models::Product> &products,
+    const std::vector<db::models::DeviceSensor> &sensors) {
+    for (const auto &device : devices) {
+      uint8_t addr = device.getAddress();
+      if (addr >= ADDRESS_COUNT) {
+        continue;
+      }
+      m_devices[addr] = true;
+      m_mids[addr] = device.getMid();
+      auto product = products.find(device.getProductId());
+      if (product != products.end()) {
+        m_hasHwpid[addr] = true;
+        m_hwpids[addr] = product->second.getHwpid();
+      }
+    }
+
+    // sensors are grouped by address, counts are turned into offsets
+    std::array<uint32_t, ADDRESS_COUNT + 1> counts{};
+    for (const auto &sensor : sensors) {
+      if (sensor.getAddress() < ADDRESS_COUNT) {
+        ++counts[sensor.getAddress() + 1];
+      }
+    }
+    for (std::size_t i = 1; i <= ADDRESS_COUNT; ++i) {
+      m_sensorOffsets[i] = m_sensorOffsets[i - 1] + counts[i];
+    }
+    m_sensors.resize(m_sensorOffsets[ADDRESS_COUNT]);
+    auto next = m_sensorOffsets;
+    for (const auto &sensor : sensors) {
+      if (sensor.getAddress() < ADDRESS_COUNT) {
+        m_sensors[next[sensor.getAddress()]++] = SensorEntry{sensor.getType(), sensor.getTypeIndex(), sensor.getGlobalIndex()};
+      }
+    }
+  }
+
+  std::optional<uint32_t> IqrfDbIndex::getMid(uint8_t address) const {
+    if (!hasDevice(address)) {
+      return std::nullopt;
+    }
+    return m_mids[address];
+  }
+
+  std::optional<uint16_t> IqrfDbIndex::getHwpid(uint8_t address) const {
+    if (!hasDevice(address) || !m_hasHwpid[address]) {
+      return std::nullopt;
+    }
+    return m_hwpids[address];
+  }
+
+  std::optional<uint8_t> IqrfDbIndex::getGlobalSensorIndex(uint8_t address, uint8_t type, uint8_t typeIndex) const {
+    if (address >= ADDRESS_COUNT) {
+      return std::nullopt;
+    }
+    for (uint32_t i = m_sensorOffsets[address]; i < m_sensorOffsets[address + 1]; ++i) {
+      const auto &entry = m_sensors[i];
+      if (entry.type == type && entry.typeIndex == typeIndex) {
+        return entry.globalIndex;
+      }
+    }
+    return std::nullopt;
+  }
+
+  bool IqrfDbIndex::hasSensor(uint8_t address, uint8_t type, uint8_t globalIndex) const {
+    if (address >= ADDRESS_COUNT) {
+      return false;
+    }
+    for (uint32_t i = m_sensorOffsets[address]; i < m_sensorOffsets[address + 1]; ++i) {
+      const auto &entry = m_sensors[i];
+      if (entry.type == type && entry.globalIndex == globalIndex) {
+        return true;
+      }
+    }
+    return false;
+  }
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <models/device.hpp>
+#include <models/device_sensor.hpp>
+#include <models/product.hpp>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace iqrf {
+
+  /**
+   * Read-only index of device attributes and sensor indexes rarely changed outside of enumeration
+   *
+   * Index is built from database contents and never modified, new index is built and published
+   * instead, so that it can be read by any number of threads without locking.
+   */
+  class IqrfDbIndex {
+  public:
+    /// Number of device addresses
+    static constexpr std::size_t ADDRESS_COUNT = 240;
+
+    /**
+     * Constructs empty index
+     */
+    IqrfDbIndex() = default;
+
+    /**
+     * Constructs index from database records
+     * @param devices Devices
+     * @param products Products by ID
+     * @param sensors Device sensors
+     */
+    IqrfDbIndex(const std::vector<db::models::Device> &devices,
+      const std::unordered_map<uint32_t, db::models::Product> &products,
+      const std::vector<db::models::DeviceSensor> &sensors);
+
+    /**
+     * Checks if device exists
+     * @param address Device address
+     * @return true if device exists, false otherwise
+     */
+    bool hasDevice(uint8_t address) const {
+      return address < ADDRESS_COUNT && m_devices[address];
+    }
+
+    /**
+     * Returns device MID
+     * @param address Device address
+     * @return MID if device exists, std::nullopt otherwise
+     */
+    std::optional<uint32_t> getMid(uint8_t address) const;
+
+    /**
+     * Returns device HWPID
+     * @param address Device address
+     * @return HWPID if device exists and has product, std::nullopt otherwise
+     */
+    std::optional<uint16_t> getHwpid(uint8_t address) const;
+
+    /**
+     * Returns global index of device sensor
+     * @param address Device address
+     * @param type Sensor type
+     * @param typeIndex Sensor type index
+     * @return Global index if device implements sensor, std::nullopt otherwise
+     */
+    std::optional<uint8_t> getGlobalSensorIndex(uint8_t address, uint8_t type, uint8_t typeIndex) const;
+
+    /**
+     * Checks if device implements sensor
+     * @param address Device address
+     * @param type Sensor type
+     * @param globalIndex Global sensor index
+     * @return true if device implements sensor of type at global index, false otherwise
+     */
+    bool hasSensor(uint8_t address, uint8_t type, uint8_t globalIndex) const;
+
+  private:
+    /// Device sensor entry
+    struct SensorEntry {
+      uint8_t type;
+      uint8_t typeIndex;
+      uint8_t globalIndex;
+    };
+
+    /// Device exists flags
+    std::array<bool, ADDRESS_COUNT> m_devices{};
+    /// Device has product flags
+    std::array<bool, ADDRESS_COUNT> m_hasHwpid{};
+    /// Device MIDs
+    std::array<uint32_t, ADDRESS_COUNT> m_mids{};
+    /// Device HWPIDs
+    std::array<uint16_t, ADDRESS_COUNT> m_hwpids{};
+    /// Offsets of device sensors in sensor table, sensors of address A are [offset[A], offset[A + 1])
+    std::array<uint32_t, ADDRESS_COUNT + 1> m_sensorOffsets{};
+    /// Sensors of all devices ordered by address
+    std::vector<SensorEntry> m_sensors;
+  };
+}
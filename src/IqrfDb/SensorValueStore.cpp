@@ -0,0 +1,123 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValueStore.h"
+
+#include <algorithm>
+
+namespace iqrf {
+
+  void SensorValueStore::set(uint8_t address, uint8_t type, uint8_t globalIndex, double value,
+    std::shared_ptr<std::string> updated) {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto &entry = m_entries[key(address, type, globalIndex)];
+    if (!entry.dirty) {
+      entry.dirty = true;
+      entry.since = Clock::now();
+      ++m_dirty;
+    }
+    entry.value = value;
+    entry.updated = std::move(updated);
+    entry.version = ++m_version;
+  }
+
+  bool SensorValueStore::apply(db::models::DeviceSensor &deviceSensor) const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    auto itr = m_entries.find(key(deviceSensor.getAddress(), deviceSensor.getType(), deviceSensor.getGlobalIndex()));
+    if (itr == m_entries.end()) {
+      return false;
+    }
+    deviceSensor.setValue(itr->second.value);
+    deviceSensor.setUpdated(itr->second.updated);
+    return true;
+  }
+
+  std::vector<SensorValueStore::DirtyValue> SensorValueStore::takeDirty() {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::vector<DirtyValue> values;
+    values.reserve(m_dirty);
+    for (auto &[k, entry] : m_entries) {
+      if (!entry.dirty) {
+        continue;
+      }
+      values.push_back({
+        static_cast<uint8_t>(k >> 16),
+        static_cast<uint8_t>(k >> 8),
+        static_cast<uint8_t>(k),
+        entry.value,
+        entry.updated,
+        entry.since,
+        entry.version
+      });
+      entry.dirty = false;
+    }
+    m_dirty = 0;
+    return values;
+  }
+
+  void SensorValueStore::restoreDirty(const std::vector<DirtyValue> &values) {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (const auto &item : values) {
+      auto itr = m_entries.find(key(item.address, item.type, item.globalIndex));
+      if (itr == m_entries.end()) {
+        continue;
+      }
+      auto &entry = itr->second;
+      if (entry.dirty) {
+        // overwritten by newer value, keep the time older value waits since
+        entry.since = std::min(entry.since, item.since);
+      } else if (entry.version == item.version) {
+        entry.dirty = true;
+        entry.since = item.since;
+        ++m_dirty;
+      }
+    }
+  }
+
+  void SensorValueStore::evictClean() {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    for (auto itr = m_entries.begin(); itr != m_entries.end();) {
+      if (itr->second.dirty) {
+        ++itr;
+      } else {
+        itr = m_entries.erase(itr);
+      }
+    }
+  }
+
+  void SensorValueStore::clear() {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    m_entries.clear();
+    m_dirty = 0;
+  }
+
+  std::size_t SensorValueStore::getDirtyCount() const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    return m_dirty;
+  }
+
+  std::optional<SensorValueStore::Clock::time_point> SensorValueStore::getOldestDirty() const {
+    std::lock_guard<std::mutex> lock(m_mtx);
+    std::optional<Clock::time_point> oldest;
+    for (const auto &[k, entry] : m_entries) {
+      if (entry.dirty && (!oldest || entry.since < *oldest)) {
+        oldest = entry.since;
+      }
+    }
+    return oldest;
+  }
+}
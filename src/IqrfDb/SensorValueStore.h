@@ -0,0 +1,148 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <models/device_sensor.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace iqrf {
+
+  /**
+   * Latest device sensor values kept in memory until they are written to database
+   *
+   * Values are identified by device address, sensor type and global sensor index. Value is dirty
+   * from the moment it is set until it is taken for writing, values taken by failed write are
+   * returned unless they were overwritten in the meantime.
+   */
+  class SensorValueStore {
+  public:
+    /// Clock measuring how long values wait for writing
+    using Clock = std::chrono::steady_clock;
+
+    /// Sensor value taken for writing
+    struct DirtyValue {
+      /// Device address
+      uint8_t address;
+      /// Sensor type
+      uint8_t type;
+      /// Global sensor index
+      uint8_t globalIndex;
+      /// Sensor value
+      double value;
+      /// Measurement timestamp
+      std::shared_ptr<std::string> updated;
+      /// Time the value became dirty
+      Clock::time_point since;
+      /// Value version, detects values overwritten while written
+      uint64_t version;
+    };
+
+    /**
+     * Sets latest sensor value and marks it dirty
+     * @param address Device address
+     * @param type Sensor type
+     * @param globalIndex Global sensor index
+     * @param value Sensor value
+     * @param updated Measurement timestamp
+     */
+    void set(uint8_t address, uint8_t type, uint8_t globalIndex, double value, std::shared_ptr<std::string> updated);
+
+    /**
+     * Applies stored value and timestamp to device sensor record
+     * @param deviceSensor Device sensor
+     * @return true if value is stored, false otherwise
+     */
+    bool apply(db::models::DeviceSensor &deviceSensor) const;
+
+    /**
+     * Takes dirty values for writing and marks them clean
+     * @return Dirty values
+     */
+    std::vector<DirtyValue> takeDirty();
+
+    /**
+     * Marks values of failed write dirty again, values set after they were taken are kept
+     * @param values Values returned by takeDirty
+     */
+    void restoreDirty(const std::vector<DirtyValue> &values);
+
+    /**
+     * Removes values that are not dirty, database becomes the only source of their values
+     */
+    void evictClean();
+
+    /**
+     * Removes all values
+     */
+    void clear();
+
+    /**
+     * Returns number of dirty values
+     * @return Number of dirty values
+     */
+    std::size_t getDirtyCount() const;
+
+    /**
+     * Returns time the oldest dirty value became dirty
+     * @return Time of oldest dirty value, std::nullopt if no value is dirty
+     */
+    std::optional<Clock::time_point> getOldestDirty() const;
+
+  private:
+    /// Stored sensor value
+    struct Entry {
+      /// Sensor value
+      double value;
+      /// Measurement timestamp
+      std::shared_ptr<std::string> updated;
+      /// Value is not written to database
+      bool dirty;
+      /// Time the value became dirty
+      Clock::time_point since;
+      /// Value version
+      uint64_t version;
+    };
+
+    /**
+     * Builds key of device sensor
+     * @param address Device address
+     * @param type Sensor type
+     * @param globalIndex Global sensor index
+     * @return Key
+     */
+    static uint32_t key(uint8_t address, uint8_t type, uint8_t globalIndex) {
+      return static_cast<uint32_t>(address) << 16 | static_cast<uint32_t>(type) << 8 | globalIndex;
+    }
+
+    /// Values mutex
+    mutable std::mutex m_mtx;
+    /// Values by device sensor key
+    std::unordered_map<uint32_t, Entry> m_entries;
+    /// Number of dirty values
+    std::size_t m_dirty = 0;
+    /// Last assigned value version
+    uint64_t m_version = 0;
+  };
+}
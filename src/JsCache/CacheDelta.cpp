@@ -0,0 +1,119 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CacheDelta.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace iqrf {
+
+  namespace {
+    /**
+     * Compares file contents
+     * @param lhs First file
+     * @param rhs Second file
+     * @return true if both files exist and have the same content, false otherwise
+     */
+    bool sameContent(const fs::path &lhs, const fs::path &rhs) {
+      std::error_code ec;
+      auto size = fs::file_size(lhs, ec);
+      if (ec || size != fs::file_size(rhs, ec) || ec) {
+        return false;
+      }
+      std::ifstream lhsFile(lhs, std::ios::binary);
+      std::ifstream rhsFile(rhs, std::ios::binary);
+      if (!lhsFile.is_open() || !rhsFile.is_open()) {
+        return false;
+      }
+      constexpr std::streamsize BUF_SIZE = 65536;
+      std::vector<char> lhsBuf(BUF_SIZE);
+      std::vector<char> rhsBuf(BUF_SIZE);
+      while (lhsFile && rhsFile) {
+        lhsFile.read(lhsBuf.data(), BUF_SIZE);
+        rhsFile.read(rhsBuf.data(), BUF_SIZE);
+        if (lhsFile.gcount() != rhsFile.gcount() || !std::equal(lhsBuf.begin(), lhsBuf.begin() + lhsFile.gcount(), rhsBuf.begin())) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
+  CacheDelta CacheDelta::compare(const std::string &downloadedDir, const std::string &installedDir, bool full) {
+    CacheDelta delta;
+    const fs::path downloadedRoot(downloadedDir);
+    const fs::path installedRoot(installedDir);
+    delta.m_full = full || !fs::is_directory(installedRoot);
+
+    std::set<std::string> downloaded;
+    for (const auto &entry : fs::recursive_directory_iterator(downloadedRoot)) {
+      if (!entry.is_regular_file()) {
+        continue;
+      }
+      std::string path = entry.path().lexically_relative(downloadedRoot).generic_string();
+      if (delta.m_full || !sameContent(entry.path(), installedRoot / path)) {
+        delta.addFile(path);
+      }
+      downloaded.insert(std::move(path));
+    }
+
+    if (fs::is_directory(installedRoot)) {
+      for (const auto &entry : fs::recursive_directory_iterator(installedRoot)) {
+        if (!entry.is_regular_file()) {
+          continue;
+        }
+        std::string path = entry.path().lexically_relative(installedRoot).generic_string();
+        if (downloaded.count(path) == 0) {
+          delta.addFile(path, true);
+        }
+      }
+    }
+    return delta;
+  }
+
+  void CacheDelta::addFile(const std::string &path, bool removed) {
+    (removed ? m_removedFiles : m_changedFiles).insert(path);
+
+    std::vector<std::string> parts;
+    for (const auto &part : fs::path(path)) {
+      parts.emplace_back(part.string());
+    }
+    if (parts.empty()) {
+      return;
+    }
+    // standards/<id>/... and packages/id/<id>/... belong to single standard or package
+    try {
+      if (parts[0] == "standards" && parts.size() > 2) {
+        m_standards.insert(std::stoi(parts[1]));
+        return;
+      }
+      if (parts[0] == "packages" && parts.size() > 3 && parts[1] == "id") {
+        m_packages.insert(static_cast<unsigned int>(std::stoul(parts[2])));
+        return;
+      }
+    } catch (const std::logic_error &) {
+      // unexpected directory name, whole entity is considered changed
+    }
+    m_entities.insert(parts[0]);
+  }
+}
@@ -0,0 +1,119 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <set>
+#include <string>
+
+namespace iqrf {
+
+  /**
+   * Changes between downloaded and installed repository cache
+   *
+   * Files are compared by content, paths are relative to cache root directory. Changed files are grouped
+   * by cache entities, standards and packages per ID, other entities (companies, products, ...) by their
+   * directory name. Full delta treats every entity as changed.
+   */
+  class CacheDelta {
+  public:
+    /**
+     * Compares downloaded cache with installed cache
+     * @param downloadedDir Downloaded cache root directory
+     * @param installedDir Installed cache root directory
+     * @param full Treat all downloaded files as changed
+     * @return CacheDelta Cache delta, full if installed cache does not exist
+     */
+    static CacheDelta compare(const std::string &downloadedDir, const std::string &installedDir, bool full = false);
+
+    /**
+     * Registers changed or removed file
+     * @param path File path relative to cache root
+     * @param removed File was removed from repository
+     */
+    void addFile(const std::string &path, bool removed = false);
+
+    /**
+     * Checks if delta replaces whole cache
+     * @return true if whole cache is replaced, false otherwise
+     */
+    bool isFull() const { return m_full; }
+
+    /**
+     * Checks if there are no changes
+     * @return true if no file changed, false otherwise
+     */
+    bool empty() const { return m_changedFiles.empty() && m_removedFiles.empty(); }
+
+    /**
+     * Checks if entity stored in single directory changed
+     * @param entity Entity directory name (companies, products, standards list, ...)
+     * @return true if entity changed, false otherwise
+     */
+    bool hasEntity(const std::string &entity) const { return m_full || m_entities.count(entity) > 0; }
+
+    /**
+     * Checks if standard changed or was removed
+     * @param id Standard ID
+     * @return true if standard changed, false otherwise
+     */
+    bool hasStandard(int id) const { return m_full || m_standards.count(id) > 0; }
+
+    /**
+     * Checks if package changed or was removed
+     * @param id Package ID
+     * @return true if package changed, false otherwise
+     */
+    bool hasPackage(unsigned int id) const { return m_full || m_packages.count(id) > 0; }
+
+    /**
+     * Returns changed or removed standards
+     * @return const std::set<int>& Standard IDs
+     */
+    const std::set<int> &getStandards() const { return m_standards; }
+
+    /**
+     * Returns changed or removed packages
+     * @return const std::set<unsigned int>& Package IDs
+     */
+    const std::set<unsigned int> &getPackages() const { return m_packages; }
+
+    /**
+     * Returns changed and added files
+     * @return const std::set<std::string>& Paths relative to cache root
+     */
+    const std::set<std::string> &getChangedFiles() const { return m_changedFiles; }
+
+    /**
+     * Returns files removed from repository
+     * @return const std::set<std::string>& Paths relative to cache root
+     */
+    const std::set<std::string> &getRemovedFiles() const { return m_removedFiles; }
+  private:
+    /// Whole cache is replaced
+    bool m_full = false;
+    /// Changed and added files
+    std::set<std::string> m_changedFiles;
+    /// Removed files
+    std::set<std::string> m_removedFiles;
+    /// Changed single directory entities
+    std::set<std::string> m_entities;
+    /// Changed standards
+    std::set<int> m_standards;
+    /// Changed packages
+    std::set<unsigned int> m_packages;
+  };
+}
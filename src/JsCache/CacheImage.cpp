@@ -0,0 +1,295 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CacheImage.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace iqrf {
+
+  namespace {
+    /// Image file header
+    struct ImageHeader {
+      /// File magic
+      char magic[8];
+      /// Image content version
+      uint32_t version;
+      /// Byte order mark, images are not portable between platforms of different byte order
+      uint32_t byteOrder;
+      /// Number of tables
+      uint32_t tableCount;
+      /// Reserved, zero
+      uint32_t reserved;
+      /// Offset of string area
+      uint64_t stringsOffset;
+      /// Image size
+      uint64_t size;
+      /// Checksum of image following the header
+      uint64_t checksum;
+    };
+
+    /// Table directory entry
+    struct ImageTableEntry {
+      /// Table ID
+      uint32_t id;
+      /// Number of fields in row
+      uint32_t fieldCount;
+      /// Number of rows
+      uint64_t rowCount;
+      /// Offset of table data
+      uint64_t offset;
+    };
+
+    const char IMAGE_MAGIC[8] = {'I', 'Q', 'R', 'F', 'J', 'S', 'C', 'I'};
+    const uint32_t IMAGE_BYTE_ORDER = 0x01020304;
+  }
+
+  ////////////////////////////////////////
+  // CacheImageWriter
+  ////////////////////////////////////////
+
+  void CacheImageWriter::beginTable(uint32_t id, uint32_t fieldCount) {
+    if (fieldCount == 0) {
+      throw std::logic_error("Table " + std::to_string(id) + " has no fields.");
+    }
+    for (const auto &table : m_tables) {
+      if (table.id == id) {
+        throw std::logic_error("Table " + std::to_string(id) + " already exists.");
+      }
+    }
+    m_tables.push_back(Table{id, fieldCount, {}});
+  }
+
+  void CacheImageWriter::addUint(uint64_t value) {
+    if (m_tables.empty()) {
+      throw std::logic_error("No table started.");
+    }
+    m_tables.back().fields.push_back(value);
+  }
+
+  void CacheImageWriter::addInt(int64_t value) {
+    addUint(static_cast<uint64_t>(value));
+  }
+
+  void CacheImageWriter::addDouble(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    addUint(bits);
+  }
+
+  void CacheImageWriter::addString(std::string_view value) {
+    // identical strings (e.g. driver sources shared by packages) are stored once
+    size_t hash = std::hash<std::string_view>()(value);
+    auto range = m_stringRefs.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      const auto &ref = it->second;
+      if (std::string_view(m_strings).substr(ref.first, ref.second) == value) {
+        addUint(ref.first);
+        addUint(ref.second);
+        return;
+      }
+    }
+    uint64_t offset = m_strings.size();
+    m_strings.append(value.data(), value.size());
+    m_stringRefs.emplace(hash, std::make_pair(offset, static_cast<uint64_t>(value.size())));
+    addUint(offset);
+    addUint(value.size());
+  }
+
+  void CacheImageWriter::write(const std::string &fileName, uint32_t version) const {
+    std::vector<ImageTableEntry> directory;
+    uint64_t offset = sizeof(ImageHeader) + m_tables.size() * sizeof(ImageTableEntry);
+    for (const auto &table : m_tables) {
+      if (table.fields.size() % table.fieldCount != 0) {
+        throw std::logic_error("Table " + std::to_string(table.id) + " has incomplete row.");
+      }
+      directory.push_back(ImageTableEntry{table.id, table.fieldCount, table.fields.size() / table.fieldCount, offset});
+      offset += table.fields.size() * sizeof(uint64_t);
+    }
+
+    ImageHeader header;
+    std::copy(std::begin(IMAGE_MAGIC), std::end(IMAGE_MAGIC), header.magic);
+    header.version = version;
+    header.byteOrder = IMAGE_BYTE_ORDER;
+    header.tableCount = static_cast<uint32_t>(m_tables.size());
+    header.reserved = 0;
+    header.stringsOffset = offset;
+    header.size = offset + m_strings.size();
+
+    // checksum is computed in the same order the content is written
+    std::string content;
+    content.reserve(header.size - sizeof(ImageHeader));
+    content.append(reinterpret_cast<const char *>(directory.data()), directory.size() * sizeof(ImageTableEntry));
+    for (const auto &table : m_tables) {
+      content.append(reinterpret_cast<const char *>(table.fields.data()), table.fields.size() * sizeof(uint64_t));
+    }
+    content.append(m_strings);
+    header.checksum = CacheImageReader::checksum(content.data(), content.size());
+
+    // write to temporary file first, so that readers never map partially written image
+    std::string tmpPath = fileName + ".tmp";
+    {
+      std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+      if (!file.is_open()) {
+        throw std::runtime_error("Failed to open image file " + tmpPath);
+      }
+      file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+      file.write(content.data(), content.size());
+      if (!file) {
+        file.close();
+        std::error_code ec;
+        std::filesystem::remove(tmpPath, ec);
+        throw std::runtime_error("Failed to write image file " + tmpPath);
+      }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, fileName, ec);
+    if (ec) {
+      std::filesystem::remove(tmpPath, ec);
+      throw std::runtime_error("Failed to replace image file " + fileName + ": " + ec.message());
+    }
+  }
+
+  ////////////////////////////////////////
+  // CacheImageReader
+  ////////////////////////////////////////
+
+  CacheImageReader::CacheImageReader(const std::string &fileName, uint32_t version) {
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("Failed to open image file " + fileName + ": " + std::strerror(errno));
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(ImageHeader))) {
+      ::close(fd);
+      throw std::runtime_error("Image file " + fileName + " is truncated.");
+    }
+    m_size = static_cast<size_t>(st.st_size);
+    void *data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    int mapErrno = errno;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+      throw std::runtime_error("Failed to map image file " + fileName + ": " + std::strerror(mapErrno));
+    }
+    m_data = static_cast<const char *>(data);
+
+    try {
+      const auto *header = reinterpret_cast<const ImageHeader *>(m_data);
+      if (!std::equal(std::begin(IMAGE_MAGIC), std::end(IMAGE_MAGIC), header->magic)
+        || header->byteOrder != IMAGE_BYTE_ORDER) {
+        throw std::runtime_error("Image file " + fileName + " has unknown format.");
+      }
+      if (header->version != version) {
+        throw std::runtime_error("Image file " + fileName + " has version " + std::to_string(header->version)
+          + ", expected " + std::to_string(version) + ".");
+      }
+      uint64_t directoryEnd = sizeof(ImageHeader) + static_cast<uint64_t>(header->tableCount) * sizeof(ImageTableEntry);
+      if (header->size != m_size || header->stringsOffset < directoryEnd || header->stringsOffset > m_size) {
+        throw std::runtime_error("Image file " + fileName + " is truncated.");
+      }
+      if (checksum(m_data + sizeof(ImageHeader), m_size - sizeof(ImageHeader)) != header->checksum) {
+        throw std::runtime_error("Image file " + fileName + " has invalid checksum.");
+      }
+
+      const auto *directory = reinterpret_cast<const ImageTableEntry *>(m_data + sizeof(ImageHeader));
+      for (uint32_t i = 0; i < header->tableCount; ++i) {
+        const auto &entry = directory[i];
+        if (entry.fieldCount == 0 || entry.offset < directoryEnd || entry.offset % sizeof(uint64_t) != 0
+          || entry.offset > header->stringsOffset
+          || entry.rowCount > (header->stringsOffset - entry.offset) / sizeof(uint64_t) / entry.fieldCount) {
+          throw std::runtime_error("Image file " + fileName + " has invalid table " + std::to_string(entry.id) + ".");
+        }
+        Table table;
+        table.m_data = reinterpret_cast<const uint64_t *>(m_data + entry.offset);
+        table.m_rows = entry.rowCount;
+        table.m_fieldCount = entry.fieldCount;
+        table.m_strings = m_data + header->stringsOffset;
+        table.m_stringsSize = m_size - header->stringsOffset;
+        m_tables[entry.id] = table;
+      }
+    } catch (...) {
+      ::munmap(const_cast<char *>(m_data), m_size);
+      throw;
+    }
+  }
+
+  CacheImageReader::~CacheImageReader() {
+    ::munmap(const_cast<char *>(m_data), m_size);
+  }
+
+  CacheImageReader::Table CacheImageReader::getTable(uint32_t id, uint32_t fieldCount) const {
+    auto it = m_tables.find(id);
+    if (it == m_tables.end()) {
+      throw std::runtime_error("Image table " + std::to_string(id) + " does not exist.");
+    }
+    if (it->second.m_fieldCount != fieldCount) {
+      throw std::runtime_error("Image table " + std::to_string(id) + " has " + std::to_string(it->second.m_fieldCount)
+        + " fields, expected " + std::to_string(fieldCount) + ".");
+    }
+    return it->second;
+  }
+
+  uint64_t CacheImageReader::checksum(const char *data, size_t size) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+      hash ^= static_cast<unsigned char>(data[i]);
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+  ////////////////////////////////////////
+  // CacheImageReader::Table
+  ////////////////////////////////////////
+
+  uint64_t CacheImageReader::Table::getUint(size_t row, uint32_t field) const {
+    if (row >= m_rows || field >= m_fieldCount) {
+      throw std::out_of_range("Image field out of range.");
+    }
+    return m_data[row * m_fieldCount + field];
+  }
+
+  int64_t CacheImageReader::Table::getInt(size_t row, uint32_t field) const {
+    return static_cast<int64_t>(getUint(row, field));
+  }
+
+  double CacheImageReader::Table::getDouble(size_t row, uint32_t field) const {
+    uint64_t bits = getUint(row, field);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string_view CacheImageReader::Table::getString(size_t row, uint32_t field) const {
+    uint64_t offset = getUint(row, field);
+    uint64_t length = getUint(row, field + 1);
+    if (offset > m_stringsSize || length > m_stringsSize - offset) {
+      throw std::out_of_range("Image string out of range.");
+    }
+    return std::string_view(m_strings + offset, length);
+  }
+}
@@ -0,0 +1,197 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace iqrf {
+
+  /**
+   * Writer of binary cache image
+   *
+   * Image is a flat file of tables with fixed size rows of 64-bit fields, followed by string area.
+   * Strings are stored once and referenced by two fields (offset and length), so readers access them
+   * in place. Image is versioned and protected by checksum of everything following the header.
+   */
+  class CacheImageWriter {
+  public:
+    /**
+     * Starts table, following values are appended to its rows
+     * @param id Table ID
+     * @param fieldCount Number of fields in row, string takes two fields
+     */
+    void beginTable(uint32_t id, uint32_t fieldCount);
+
+    /**
+     * Appends unsigned number to current table
+     * @param value Value
+     */
+    void addUint(uint64_t value);
+
+    /**
+     * Appends signed number to current table
+     * @param value Value
+     */
+    void addInt(int64_t value);
+
+    /**
+     * Appends floating point number to current table
+     * @param value Value
+     */
+    void addDouble(double value);
+
+    /**
+     * Appends string to current table
+     * @param value Value
+     */
+    void addString(std::string_view value);
+
+    /**
+     * Writes image file, the file is replaced only when it is completely written
+     * @param fileName Image file
+     * @param version Image content version
+     */
+    void write(const std::string &fileName, uint32_t version) const;
+  private:
+    /// Table of image
+    struct Table {
+      /// Table ID
+      uint32_t id;
+      /// Number of fields in row
+      uint32_t fieldCount;
+      /// Fields of all rows
+      std::vector<uint64_t> fields;
+    };
+
+    /// Tables
+    std::vector<Table> m_tables;
+    /// String area
+    std::string m_strings;
+    /// Stored strings (offset and length) by string hash
+    std::unordered_multimap<size_t, std::pair<uint64_t, uint64_t>> m_stringRefs;
+  };
+
+  /**
+   * Reader of binary cache image
+   *
+   * Image file is memory mapped, header, table bounds and checksum are validated when it is opened.
+   */
+  class CacheImageReader {
+  public:
+    /**
+     * Table of image
+     */
+    class Table {
+    public:
+      /**
+       * Returns number of rows
+       * @return size_t Number of rows
+       */
+      size_t size() const { return m_rows; }
+
+      /**
+       * Returns unsigned number
+       * @param row Row index
+       * @param field Field index
+       * @return uint64_t Value
+       */
+      uint64_t getUint(size_t row, uint32_t field) const;
+
+      /**
+       * Returns signed number
+       * @param row Row index
+       * @param field Field index
+       * @return int64_t Value
+       */
+      int64_t getInt(size_t row, uint32_t field) const;
+
+      /**
+       * Returns floating point number
+       * @param row Row index
+       * @param field Field index
+       * @return double Value
+       */
+      double getDouble(size_t row, uint32_t field) const;
+
+      /**
+       * Returns string stored in image
+       * @param row Row index
+       * @param field Index of the first of two string fields
+       * @return std::string_view String valid as long as the reader
+       */
+      std::string_view getString(size_t row, uint32_t field) const;
+    private:
+      friend class CacheImageReader;
+      /// Fields of all rows
+      const uint64_t *m_data = nullptr;
+      /// Number of rows
+      size_t m_rows = 0;
+      /// Number of fields in row
+      uint32_t m_fieldCount = 0;
+      /// String area
+      const char *m_strings = nullptr;
+      /// String area size
+      size_t m_stringsSize = 0;
+    };
+
+    /**
+     * Maps and validates image file
+     * @param fileName Image file
+     * @param version Expected image content version
+     * @throws std::runtime_error if image cannot be mapped or is not valid
+     */
+    CacheImageReader(const std::string &fileName, uint32_t version);
+
+    /**
+     * Unmaps image file
+     */
+    ~CacheImageReader();
+
+    CacheImageReader(const CacheImageReader &) = delete;
+    CacheImageReader &operator=(const CacheImageReader &) = delete;
+
+    /**
+     * Returns table
+     * @param id Table ID
+     * @param fieldCount Expected number of fields in row
+     * @return Table Table
+     * @throws std::runtime_error if table does not exist or has different row layout
+     */
+    Table getTable(uint32_t id, uint32_t fieldCount) const;
+
+    /**
+     * Computes FNV-1a checksum
+     * @param data Data
+     * @param size Data size
+     * @return uint64_t Checksum
+     */
+    static uint64_t checksum(const char *data, size_t size);
+  private:
+    /// Mapped image
+    const char *m_data = nullptr;
+    /// Image size
+    size_t m_size = 0;
+    /// Tables by ID
+    std::unordered_map<uint32_t, Table> m_tables;
+  };
+}
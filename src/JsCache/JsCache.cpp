@@ -18,7 +18,9 @@
  #define IJsCacheService_EXPORTS
 
 #include "JsCache.h"
+#include "CacheImage.h"
 #include "CurlUtils.h"
+#include "ParallelRunner.h"
 #include "JsonValidationUtils.h"
 #include "EmbedExplore.h"
 #include "EmbedOS.h"
@@ -28,6 +30,7 @@
 #include "rapidjson/document.h"
 #include "rapidjson/pointer.h"
 #include "TraceMacros.h"
+#include "ZipUtils.h"
 
 #include <algorithm>
 #include <cstdint>
@@ -38,7 +41,8 @@
 #include <iostream>
 #include <map>
 #include <memory>
-#include <zip.h>
+#include <optional>
+#include <unordered_set>
 
 #ifdef TRC_CHANNEL
 #undef TRC_CHANNEL
@@ -60,14 +64,96 @@ namespace iqrf {
   static const char *PACKAGES_DIR = "cache/packages/id";
   static const char *QUANTITIES_DIR = "cache/quantities";
   static const char *SERVER_DIR = "cache/server";
+  static const char *SERVER_DATA_FILE = "server/data.json";
 
   static const char *SERVER_URL = "server";
   static const char *ZIP_URL = "zip";
 
   static const char *SERVER_STATE_FILE = "serverState.json";
 
+  static const char *CACHE_IMAGE_FILE = "cache.img";
+  /// Cache image content version, increase when image tables or parsing of cache files change
+  static const uint32_t CACHE_IMAGE_VERSION = 1;
+
+  /// Cache image tables
+  enum CacheImageTable : uint32_t {
+    IMAGE_SERVER = 1,
+    IMAGE_COMPANIES,
+    IMAGE_MANUFACTURERS,
+    IMAGE_PRODUCTS,
+    IMAGE_OSDPA,
+    IMAGE_STANDARDS,
+    IMAGE_STANDARD_DRIVERS,
+    IMAGE_PACKAGES,
+    IMAGE_PACKAGE_DRIVERS,
+    IMAGE_QUANTITIES,
+  };
+
+  /**
+   * Checks if standard or package stored in directory named by its ID changed
+   * @param dir Standard or package directory
+   * @param delta Changes of cache files
+   * @param changed Delta check of ID
+   * @return true if entity changed or directory name is not an ID, false otherwise
+   */
+  template <typename T>
+  static bool isChanged(const std::filesystem::path &dir, const CacheDelta &delta, bool (CacheDelta::*changed)(T) const) {
+    try {
+      return (delta.*changed)(static_cast<T>(std::stoul(dir.filename().string())));
+    } catch (const std::logic_error &) {
+      return true;
+    }
+  }
+
+  /**
+   * Measures durations of cache update phases
+   */
+  class PhaseTimer {
+  public:
+    /**
+     * Runs and measures phase
+     * @param phase Phase name
+     * @param func Phase function
+     */
+    template <class F>
+    void measure(const std::string &phase, F &&func) {
+      auto start = std::chrono::steady_clock::now();
+      func();
+      auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+      m_phases.emplace_back(phase, duration.count());
+      m_total += duration.count();
+    }
+
+    /**
+     * Returns total duration of measured phases
+     * @return int64_t Duration in milliseconds
+     */
+    int64_t total() const {
+      return m_total;
+    }
+
+    /**
+     * Returns phase durations as text
+     * @return std::string Phase durations
+     */
+    std::string str() const {
+      std::ostringstream os;
+      for (const auto &[phase, duration] : m_phases) {
+        os << phase << ": " << duration << " ms, ";
+      }
+      os << "total: " << m_total << " ms";
+      return os.str();
+    }
+  private:
+    /// Phase names and durations
+    std::vector<std::pair<std::string, int64_t>> m_phases;
+    /// Total duration
+    int64_t m_total = 0;
+  };
+
   JsCache::JsCache() {
     TRC_FUNCTION_ENTER("");
+    m_snapshot = std::make_shared<const CacheSnapshot>();
     TRC_FUNCTION_LEAVE("");
   }
 
@@ -101,9 +187,11 @@ namespace iqrf {
           std::cerr << "[IQRF Repository cache] Failed to download remote cache: " << e.what() << std::endl;
           fail = true;
         }
+        CacheDelta delta;
         if (!fail) {
           try {
-            validateCache();
+            delta = compareCache();
+            validateCache(delta);
           } catch (const std::exception &e) {
             TRC_WARNING("[IQRF Repository cache] Failed to validate remote cache contents: " << e.what());
             std::cerr << "[IQRF Repository cache] Failed to validate remote cache contents: " << e.what() << std::endl;
@@ -112,7 +200,7 @@ namespace iqrf {
         }
         if (!fail) {
           try {
-            updateCacheFiles();
+            updateCacheFiles(delta);
           } catch (const std::exception &e) {
             TRC_WARNING("[IQRF Repository cache] Failed to update cache files: " << e.what());
             std::cerr << "[IQRF Repository cache] Failed to update cache files: " << e.what() << std::endl;
@@ -124,7 +212,10 @@ namespace iqrf {
       }
     } else {
       try {
-        m_serverState = getCacheServer(m_serverStateFilePath);
+        // local server state is compared with remote one before the cache is loaded
+        auto snapshot = std::make_shared<CacheSnapshot>();
+        snapshot->serverState = getCacheServer(m_serverStateFilePath);
+        std::atomic_store(&m_snapshot, std::shared_ptr<const CacheSnapshot>(std::move(snapshot)));
       } catch (const std::exception &e) {
         TRC_WARNING("[IQRF Repository cache] Cache exists, but server state file does not.");
         std::cerr << "[IQRF Repository cache] Cache exists, but server state file does not." << std::endl;
@@ -146,9 +237,11 @@ namespace iqrf {
           std::cerr << "[IQRF Repository cache] Failed to download remote cache: " << e.what() << std::endl;
           fail = true;
         }
+        CacheDelta delta;
         if (!fail) {
           try {
-            validateCache();
+            delta = compareCache();
+            validateCache(delta);
           } catch (const std::exception &e) {
             TRC_WARNING("[IQRF Repository cache] Failed to validate remote cache contents: " << e.what());
             std::cerr << "[IQRF Repository cache] Failed to validate remote cache contents: " << e.what() << std::endl;
@@ -157,7 +250,7 @@ namespace iqrf {
         }
         if (!fail) {
           try {
-            updateCacheFiles();
+            updateCacheFiles(delta);
           } catch (const std::exception &e) {
             TRC_WARNING("[IQRF Repository cache] Failed to update cache files: " << e.what());
             std::cerr << "[IQRF Repository cache] Failed to update cache files: " << e.what() << std::endl;
@@ -226,6 +319,18 @@ namespace iqrf {
     if (v && v->IsBool()) {
       m_downloadIfRepoCacheEmpty = v->GetBool();
     }
+    v = Pointer("/deltaUpdate").Get(doc);
+    if (v && v->IsBool()) {
+      m_deltaUpdate = v->GetBool();
+    }
+    v = Pointer("/loaderThreads").Get(doc);
+    if (v && v->IsUint()) {
+      m_loaderThreads = v->GetUint();
+    }
+    v = Pointer("/cacheImage").Get(doc);
+    if (v && v->IsBool()) {
+      m_cacheImage = v->GetBool();
+    }
 
     m_cacheDir = m_iLaunchService->getCacheDir() + "/" + m_iqrfRepoCache;
     if (!std::filesystem::exists(m_cacheDir)) {
@@ -309,26 +414,28 @@ namespace iqrf {
 
   ///// API /////
 
-  std::shared_ptr<IJsCacheService::StdDriver> JsCache::getDriver(const int id, const double ver) const {
+  std::shared_ptr<const IJsCacheService::StdDriver> JsCache::getDriver(const int id, const double ver) const {
     TRC_FUNCTION_ENTER(PAR(id) << std::fixed << std::setprecision(2) << PAR(ver));
-    std::shared_ptr<StdDriver> driver = nullptr;
-    const auto foundDrv = m_standardMap.find(id);
-    if (foundDrv != m_standardMap.end()) {
+    std::shared_ptr<const StdDriver> driver = nullptr;
+    auto snapshot = getSnapshot();
+    const auto foundDrv = snapshot->standardMap.find(id);
+    if (foundDrv != snapshot->standardMap.end()) {
       const StdItem &stdItem = foundDrv->second;
       const auto foundVer = stdItem.m_drivers.find(ver);
       if (foundVer != stdItem.m_drivers.end()) {
-        driver = std::make_shared<StdDriver>(foundVer->second);
+        driver = std::shared_ptr<const StdDriver>(snapshot, &foundVer->second);
       }
     }
     TRC_FUNCTION_LEAVE("");
     return driver;
   }
 
-  std::shared_ptr<IJsCacheService::StdDriver> JsCache::getLatestDriver(const int id) const {
+  std::shared_ptr<const IJsCacheService::StdDriver> JsCache::getLatestDriver(const int id) const {
     TRC_FUNCTION_ENTER(PAR(id));
-    std::shared_ptr<StdDriver> driver = nullptr;
-    const auto found = m_standardMap.find(id);
-    if (found != m_standardMap.end()) {
+    std::shared_ptr<const StdDriver> driver = nullptr;
+    auto snapshot = getSnapshot();
+    const auto found = snapshot->standardMap.find(id);
+    if (found != snapshot->standardMap.end()) {
       const StdItem &stdItem = found->second;
       double highestVersion = 0;
       for (const auto &[driverVersion, _driver] : stdItem.m_drivers) {
@@ -336,24 +443,24 @@ namespace iqrf {
           highestVersion = driverVersion;
         }
       }
-      driver = std::make_shared<StdDriver>(stdItem.m_drivers.at(highestVersion));
+      driver = std::shared_ptr<const StdDriver>(snapshot, &stdItem.m_drivers.at(highestVersion));
     }
     TRC_FUNCTION_LEAVE("");
     return driver;
   }
 
-  std::shared_ptr<IJsCacheService::Manufacturer> JsCache::getManufacturer(uint16_t hwpid) const {
+  std::shared_ptr<const IJsCacheService::Manufacturer> JsCache::getManufacturer(uint16_t hwpid) const {
     TRC_FUNCTION_ENTER(PAR(hwpid));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    std::shared_ptr<Manufacturer> manufacturer = nullptr;
-    const auto found = m_productMap.find(hwpid);
-    if (found != m_productMap.end()) {
+    std::shared_ptr<const Manufacturer> manufacturer = nullptr;
+    const auto found = snapshot->productMap.find(hwpid);
+    if (found != snapshot->productMap.end()) {
       const unsigned int manufacturerId = found->second.m_manufacturerId;
-      const auto foundManuf = m_manufacturerMap.find(manufacturerId);
-      if (foundManuf != m_manufacturerMap.end()) {
-        manufacturer = std::make_shared<Manufacturer>(foundManuf->second);
+      const auto foundManuf = snapshot->manufacturerMap.find(manufacturerId);
+      if (foundManuf != snapshot->manufacturerMap.end()) {
+        manufacturer = std::shared_ptr<const Manufacturer>(snapshot, &foundManuf->second);
       }
     }
 
@@ -363,15 +470,15 @@ namespace iqrf {
     return manufacturer;
   }
 
-  std::shared_ptr<IJsCacheService::Product> JsCache::getProduct(const uint16_t hwpid) const {
+  std::shared_ptr<const IJsCacheService::Product> JsCache::getProduct(const uint16_t hwpid) const {
     TRC_FUNCTION_ENTER(PAR(hwpid));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    std::shared_ptr<Product> product = nullptr;
-    const auto found = m_productMap.find(hwpid);
-    if (found != m_productMap.end()) {
-      product = std::make_shared<Product>(found->second);
+    std::shared_ptr<const Product> product = nullptr;
+    const auto found = snapshot->productMap.find(hwpid);
+    if (found != snapshot->productMap.end()) {
+      product = std::shared_ptr<const Product>(snapshot, &found->second);
     }
 
     const int productId = product == nullptr ? -1 : static_cast<int>(product->m_manufacturerId);
@@ -380,19 +487,24 @@ namespace iqrf {
     return product;
   }
 
-  const metadata::Metadata* JsCache::getProductMetadata(uint16_t hwpid, uint16_t hwpidVer) const {
+  std::shared_ptr<const metadata::Metadata> JsCache::getProductMetadata(uint16_t hwpid, uint16_t hwpidVer) const {
     TRC_FUNCTION_ENTER(PAR(hwpid) << PAR(hwpidVer));
-    auto record = m_productMap.find(hwpid);
-    if (record == m_productMap.end()) {
+    auto snapshot = getSnapshot();
+    auto record = snapshot->productMap.find(hwpid);
+    if (record == snapshot->productMap.end()) {
       return nullptr;
     }
     if (record->second.m_metadata == nullptr) {
       return nullptr;
     }
-    return record->second.m_metadata->getProfile(hwpidVer);
+    const metadata::Metadata *profile = record->second.m_metadata->getProfile(hwpidVer);
+    if (profile == nullptr) {
+      return nullptr;
+    }
+    return std::shared_ptr<const metadata::Metadata>(snapshot, profile);
   }
 
-  std::shared_ptr<IJsCacheService::Package> JsCache::getPackage(
+  std::shared_ptr<const IJsCacheService::Package> JsCache::getPackage(
     const uint16_t hwpid,
     const uint16_t hwpidVer,
     const std::string &os,
@@ -400,14 +512,12 @@ namespace iqrf {
   ) const {
     TRC_FUNCTION_ENTER(PAR(hwpid) << PAR(hwpidVer) << PAR(os) << PAR(dpa));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    std::shared_ptr<Package> package = nullptr;
-    for (const auto &[id, pkg] : m_packageMap) {
-      if (pkg.m_hwpid == hwpid && pkg.m_hwpidVer == hwpidVer && pkg.m_os == os && pkg.m_dpa == dpa) {
-        package = std::make_shared<Package>(pkg);
-        break;
-      }
+    std::shared_ptr<const Package> package = nullptr;
+    const Package *pkg = snapshot->packageIndex.find(hwpid, hwpidVer, os, dpa);
+    if (pkg != nullptr) {
+      package = std::shared_ptr<const Package>(snapshot, pkg);
     }
 
     const int packageId = package == nullptr ? -1 : static_cast<int>(package->m_packageId);
@@ -416,19 +526,15 @@ namespace iqrf {
     return package;
   }
 
-  std::shared_ptr<IJsCacheService::Package> JsCache::getPackage(uint16_t hwpid, uint16_t hwpidVer, uint16_t os, uint16_t dpa) const {
+  std::shared_ptr<const IJsCacheService::Package> JsCache::getPackage(uint16_t hwpid, uint16_t hwpidVer, uint16_t os, uint16_t dpa) const {
     TRC_FUNCTION_ENTER(PAR(hwpid) << PAR(hwpidVer) << PAR(os) << PAR(dpa));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    std::shared_ptr<Package> package = nullptr;
-    std::string osStr = embed::os::Read::getOsBuildAsString(os);
-    std::string dpaStr = embed::explore::Enumerate::getDpaVerAsHexaString(dpa);
-    for (const auto &[id, pkg] : m_packageMap) {
-      if (pkg.m_hwpid == hwpid && pkg.m_hwpidVer == hwpidVer && pkg.m_os == osStr && pkg.m_dpa == dpaStr) {
-        package = std::make_shared<Package>(pkg);
-        break;
-      }
+    std::shared_ptr<const Package> package = nullptr;
+    const Package *pkg = snapshot->packageIndex.find(hwpid, hwpidVer, os, dpa);
+    if (pkg != nullptr) {
+      package = std::shared_ptr<const Package>(snapshot, pkg);
     }
 
     TRC_FUNCTION_LEAVE("");
@@ -441,16 +547,14 @@ namespace iqrf {
     // DriverId, DriverVersion, hwpid, hwpidVer
     std::map<int, std::map<double, std::vector<std::pair<int, int>>>> map2;
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
     std::ostringstream ostr;
-    for (const auto &[id, package] : m_packageMap) {
-      const Package &p = package;
-      if (p.m_os == os && p.m_dpa == dpa) {
-        for (const auto &drv : p.m_stdDriverVect) {
-          map2[drv.getId()][drv.getVersion()].emplace_back(p.m_hwpid, p.m_hwpidVer);
-          ostr << '[' << drv.getId() << ',' << std::fixed << std::setprecision(2) << drv.getVersion() << "] ";
-        }
+    for (const Package *package : snapshot->packageIndex.find(os, dpa)) {
+      const Package &p = *package;
+      for (const auto &drv : p.m_stdDriverVect) {
+        map2[drv.getId()][drv.getVersion()].emplace_back(p.m_hwpid, p.m_hwpidVer);
+        ostr << '[' << drv.getId() << ',' << std::fixed << std::setprecision(2) << drv.getVersion() << "] ";
       }
     }
 
@@ -465,14 +569,12 @@ namespace iqrf {
     // hwpid, hwpidVer, driver
     std::map<int, std::map<int, std::string>> map2;
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    for (const auto &[id, package] : m_packageMap) {
-      const Package &p = package;
-      if (p.m_os == os && p.m_dpa == dpa) {
-        if (!p.m_driver.empty() && p.m_driver.size() > 20) {
-          map2[p.m_hwpid].insert(std::make_pair(p.m_hwpidVer, p.m_driver));
-        }
+    for (const Package *package : snapshot->packageIndex.find(os, dpa)) {
+      const Package &p = *package;
+      if (p.m_driver->size() > 20) {
+        map2[p.m_hwpid].insert(std::make_pair(p.m_hwpidVer, *p.m_driver));
       }
     }
 
@@ -485,9 +587,9 @@ namespace iqrf {
 
     MapOsListDpa retval;
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    for (const auto& [id, osDpa] : m_osDpaMap) {
+    for (const auto& [id, osDpa] : snapshot->osDpaMap) {
       int os = 0;
       int dpa = 0;
       std::string osStr = osDpa.m_os;
@@ -506,15 +608,15 @@ namespace iqrf {
     return retval;
   }
 
-  std::shared_ptr<IJsCacheService::OsDpa> JsCache::getOsDpa(const int id) const {
+  std::shared_ptr<const IJsCacheService::OsDpa> JsCache::getOsDpa(const int id) const {
     TRC_FUNCTION_ENTER(PAR(id));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    std::shared_ptr<OsDpa> osDpa;
-    const auto found = m_osDpaMap.find(id);
-    if (found != m_osDpaMap.end()) {
-      osDpa = std::make_shared<OsDpa>(found->second);
+    std::shared_ptr<const OsDpa> osDpa;
+    const auto found = snapshot->osDpaMap.find(id);
+    if (found != snapshot->osDpaMap.end()) {
+      osDpa = std::shared_ptr<const OsDpa>(snapshot, &found->second);
     }
 
     const int osDpaId = osDpa == nullptr ? -1 : static_cast<int>(osDpa->m_osdpaId);
@@ -523,15 +625,15 @@ namespace iqrf {
     return osDpa;
   }
 
-  std::shared_ptr<IJsCacheService::OsDpa> JsCache::getOsDpa(const std::string &os, const std::string &dpa) const {
+  std::shared_ptr<const IJsCacheService::OsDpa> JsCache::getOsDpa(const std::string &os, const std::string &dpa) const {
     TRC_FUNCTION_ENTER(PAR(os) << PAR(dpa));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    std::shared_ptr<OsDpa> osDpa;
-    for (auto &[id, item] : m_osDpaMap) {
+    std::shared_ptr<const OsDpa> osDpa;
+    for (const auto &[id, item] : snapshot->osDpaMap) {
       if (os == item.m_os && dpa == item.m_dpa) {
-        osDpa = std::make_shared<OsDpa>(item);
+        osDpa = std::shared_ptr<const OsDpa>(snapshot, &item);
         break;
       }
     }
@@ -542,15 +644,15 @@ namespace iqrf {
     return osDpa;
   }
 
-  std::shared_ptr<IJsCacheService::Quantity> JsCache::getQuantity(uint8_t type) const {
+  std::shared_ptr<const IJsCacheService::Quantity> JsCache::getQuantity(uint8_t type) const {
     TRC_FUNCTION_ENTER(PAR(type));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
-    std::shared_ptr<Quantity> quantity;
-    const auto found = m_quantityMap.find(type);
-    if (found != m_quantityMap.end()) {
-      quantity = std::make_shared<Quantity>(found->second);
+    std::shared_ptr<const Quantity> quantity;
+    const auto found = snapshot->quantityMap.find(type);
+    if (found != snapshot->quantityMap.end()) {
+      quantity = std::shared_ptr<const Quantity>(snapshot, &found->second);
     }
 
     const int quantityId = quantity == nullptr ? -1 : quantity->m_type;
@@ -561,10 +663,10 @@ namespace iqrf {
   IJsCacheService::ServerState JsCache::getServerState() const {
     TRC_FUNCTION_ENTER("");
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
+    auto snapshot = getSnapshot();
 
     TRC_FUNCTION_LEAVE("");
-    return m_serverState;
+    return snapshot->serverState;
   }
 
   std::tuple<IJsCacheService::CacheStatus, std::string> JsCache::invokeWorker() {
@@ -608,6 +710,10 @@ namespace iqrf {
 
   ///// Private methods /////
 
+  std::shared_ptr<const JsCache::CacheSnapshot> JsCache::getSnapshot() const {
+    return std::atomic_load(&m_snapshot);
+  }
+
   IJsCacheService::ServerState JsCache::getCacheServer(const std::string &fileName) {
     TRC_FUNCTION_ENTER("");
 
@@ -644,17 +750,15 @@ namespace iqrf {
     return serverState;
   }
 
-  std::shared_ptr<IJsCacheService::StdDriver> JsCache::getStandard(int standardId, double version) {
+  const IJsCacheService::StdDriver *JsCache::getStandard(const CacheSnapshot &snapshot, int standardId, double version) {
     TRC_FUNCTION_ENTER(PAR(standardId) << std::fixed << std::setprecision(2) << PAR(version));
 
-    std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
-
-    std::shared_ptr<StdDriver> stdDriver = nullptr;
-    const auto found = m_standardMap.find(standardId);
-    if (found != m_standardMap.end()) {
+    const StdDriver *stdDriver = nullptr;
+    const auto found = snapshot.standardMap.find(standardId);
+    if (found != snapshot.standardMap.end()) {
       const auto foundVer = found->second.m_drivers.find(version);
       if (foundVer != found->second.m_drivers.end()) {
-        stdDriver = std::make_shared<StdDriver>(foundVer->second);
+        stdDriver = &foundVer->second;
       }
     }
 
@@ -664,19 +768,19 @@ namespace iqrf {
     return stdDriver;
   }
 
-  void JsCache::updateCacheServer() {
+  void JsCache::updateCacheServer(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fname = getCacheDataFilePath(SERVER_DIR);
     if (!std::filesystem::exists(fname)) {
       THROW_EXC_TRC_WAR(std::logic_error, "Cache server data file does not exist. " << PAR(fname));
     }
-    m_serverState = getCacheServer(fname);
+    snapshot.serverState = getCacheServer(fname);
 
     TRC_FUNCTION_LEAVE("");
   }
 
-  void JsCache::updateCacheCompanies() {
+  void JsCache::updateCacheCompanies(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fileName = getCacheDataFilePath(COMPANIES_DIR);
@@ -712,12 +816,12 @@ namespace iqrf {
         THROW_EXC_TRC_WAR(std::logic_error, e.what());
       }
     }
-    m_companyMap = companyMap;
+    snapshot.companyMap = std::move(companyMap);
 
     TRC_FUNCTION_LEAVE("")
   }
 
-  void JsCache::updateCacheManufacturers() {
+  void JsCache::updateCacheManufacturers(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fileName = getCacheDataFilePath(MANUFACTURERS_DIR);
@@ -753,12 +857,12 @@ namespace iqrf {
         THROW_EXC_TRC_WAR(std::logic_error, e.what());
       }
     }
-    m_manufacturerMap = manufacturerMap;
+    snapshot.manufacturerMap = std::move(manufacturerMap);
 
     TRC_FUNCTION_LEAVE("")
   }
 
-  void JsCache::updateCacheProducts() {
+  void JsCache::updateCacheProducts(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fileName = getCacheDataFilePath(PRODUCTS_DIR);
@@ -779,6 +883,7 @@ namespace iqrf {
     }
 
     std::map<uint16_t, Product> productMap;
+    std::map<uint16_t, std::string> metadataSources;
     for (auto itr = doc.begin(); itr != doc.end(); ++itr) {
       json productDoc = itr.value();
       try {
@@ -802,6 +907,7 @@ namespace iqrf {
               metadata = std::make_shared<metadata::ProductMetadata>(
                 metadata::ProductMetadataParser::parse(metadataDoc)
               );
+              metadataSources.emplace(hwpid, metadataDoc.dump());
             } catch (const std::exception &e) {
               TRC_WARNING(
                 "Failed to parse static metadata version " << newestSupported
@@ -830,12 +936,13 @@ namespace iqrf {
         THROW_EXC_TRC_WAR(std::logic_error, e.what());
       }
     }
-    m_productMap = productMap;
+    snapshot.productMap = std::move(productMap);
+    snapshot.metadataSources = std::move(metadataSources);
 
     TRC_FUNCTION_LEAVE("")
   }
 
-  void JsCache::updateCacheOsDpa() {
+  void JsCache::updateCacheOsDpa(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fileName = getCacheDataFilePath(OSDPA_DIR);
@@ -873,12 +980,12 @@ namespace iqrf {
       }
     }
 
-    m_osDpaMap = osDpaMap;
+    snapshot.osDpaMap = std::move(osDpaMap);
 
     TRC_FUNCTION_LEAVE("")
   }
 
-  void JsCache::updateCacheStandards() {
+  void JsCache::updateCacheStandards(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fileName = getCacheDataFilePath(STANDARDS_DIR);
@@ -909,67 +1016,80 @@ namespace iqrf {
       );
     }
 
-    for (auto &[id, item] : standardMap) {
-      // get standard version
-      std::ostringstream os;
-      os << STANDARDS_DIR << '/' << id;
-      std::string url = os.str();
-      fileName = getCacheDataFilePath(url);
+    // standards are parsed in parallel, each task fills its own item
+    std::vector<std::pair<const int, StdItem> *> items;
+    for (auto &entry : standardMap) {
+      items.emplace_back(&entry);
+    }
+    ParallelRunner(m_loaderThreads).run(items.size(), [&](size_t i) {
+      updateCacheStandard(items[i]->first, items[i]->second);
+    });
+    snapshot.standardMap = std::move(standardMap);
 
-      if (!std::filesystem::exists(fileName)) {
-        THROW_EXC_TRC_WAR(std::logic_error, "Standard file does not exist: " << PAR(fileName));
-      }
+    TRC_FUNCTION_LEAVE("")
+  }
 
-      json standardDoc;
-      try {
-        std::ifstream file(fileName);
-        standardDoc = json::parse(file);
-      } catch (const json::parse_error &e) {
-        THROW_EXC_TRC_WAR(std::logic_error, "Failed to parse standard file: [" << e.byte << "] " << e.what());
-      }
+  void JsCache::updateCacheStandard(int id, StdItem &item) {
+    TRC_FUNCTION_ENTER(PAR(id));
 
-      try {
-        std::vector<double> versions = standardDoc["versions"];
-        for (auto &version : versions) {
+    // get standard version
+    std::ostringstream os;
+    os << STANDARDS_DIR << '/' << id;
+    std::string url = os.str();
+    std::string fileName = getCacheDataFilePath(url);
 
-          std::ostringstream oss;
-          oss << STANDARDS_DIR << '/' << id << '/' << std::fixed << std::setprecision(2) << version;
-          fileName = getCacheDataFilePath(oss.str());
+    if (!std::filesystem::exists(fileName)) {
+      THROW_EXC_TRC_WAR(std::logic_error, "Standard file does not exist: " << PAR(fileName));
+    }
 
-          if (!std::filesystem::exists(fileName)) {
-            THROW_EXC_TRC_WAR(std::logic_error, "Standard version file does not exist. " << PAR(fileName));
-          }
+    json standardDoc;
+    try {
+      std::ifstream file(fileName);
+      standardDoc = json::parse(file);
+    } catch (const json::parse_error &e) {
+      THROW_EXC_TRC_WAR(std::logic_error, "Failed to parse standard file: [" << e.byte << "] " << e.what());
+    }
 
-          std::ifstream file(fileName);
-          json driverDoc;
-          try {
-            driverDoc = json::parse(file);
-          } catch (const json::parse_error &e) {
-            THROW_EXC_TRC_WAR(std::logic_error, "Failed to parse standard version file: [" << e.byte << "] " << e.what());
-          }
+    try {
+      std::vector<double> versions = standardDoc["versions"];
+      for (auto &version : versions) {
 
-          double drvVersion = driverDoc["version"];
-          int versionFlags = driverDoc["versionFlags"];
-          std::shared_ptr<std::string> driver = std::make_shared<std::string>(driverDoc["driver"]);
-          std::shared_ptr<std::string> notes = std::make_shared<std::string>(driverDoc["notes"]);
+        std::ostringstream oss;
+        oss << STANDARDS_DIR << '/' << id << '/' << std::fixed << std::setprecision(2) << version;
+        fileName = getCacheDataFilePath(oss.str());
 
-          item.m_drivers.insert(
-            std::make_pair(version, StdDriver(id, item.m_name, drvVersion, driver, notes, versionFlags))
-          );
+        if (!std::filesystem::exists(fileName)) {
+          THROW_EXC_TRC_WAR(std::logic_error, "Standard version file does not exist. " << PAR(fileName));
         }
-        item.m_valid = true;
-      } catch (const json::exception &e) {
-        THROW_EXC_TRC_WAR(std::logic_error, e.what())
-      } catch (const std::logic_error &e) {
-        THROW_EXC_TRC_WAR(std::logic_error, e.what());
+
+        std::ifstream file(fileName);
+        json driverDoc;
+        try {
+          driverDoc = json::parse(file);
+        } catch (const json::parse_error &e) {
+          THROW_EXC_TRC_WAR(std::logic_error, "Failed to parse standard version file: [" << e.byte << "] " << e.what());
+        }
+
+        double drvVersion = driverDoc["version"];
+        int versionFlags = driverDoc["versionFlags"];
+        std::shared_ptr<const std::string> driver = std::make_shared<std::string>(driverDoc["driver"]);
+        std::shared_ptr<const std::string> notes = std::make_shared<std::string>(driverDoc["notes"]);
+
+        item.m_drivers.insert(
+          std::make_pair(version, StdDriver(id, item.m_name, drvVersion, driver, notes, versionFlags))
+        );
       }
+      item.m_valid = true;
+    } catch (const json::exception &e) {
+      THROW_EXC_TRC_WAR(std::logic_error, e.what())
+    } catch (const std::logic_error &e) {
+      THROW_EXC_TRC_WAR(std::logic_error, e.what());
     }
-    m_standardMap = standardMap;
 
     TRC_FUNCTION_LEAVE("")
   }
 
-  void JsCache::updateCachePackages() {
+  void JsCache::updateCachePackages(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fname = getCachePath(PACKAGES_DIR);
@@ -989,70 +1109,171 @@ namespace iqrf {
 
     std::ostringstream auxtrc;
     std::map<unsigned int, Package> packageMap;
+    // custom drivers are mostly shared by versions of the same product, keep single copy of each source
+    StringPool driverPool;
+
+    // files are parsed in parallel, results are merged in file order
+    std::vector<std::optional<Package>> packages(vstr.size());
+    std::vector<std::ostringstream> packageTraces(vstr.size());
+    ParallelRunner(m_loaderThreads).run(vstr.size(), [&](size_t i) {
+      packages[i].emplace(parsePackage(vstr[i], snapshot, packageTraces[i]));
+    });
+    for (size_t i = 0; i < packages.size(); ++i) {
+      Package &package = *packages[i];
+      package.m_driver = *driverPool.insert(package.m_driver).first;
+      auxtrc << packageTraces[i].str();
+      const unsigned int packageId = package.m_packageId;
+      packageMap.insert(
+        std::make_pair(packageId, std::move(package))
+      );
+    }
+    snapshot.packageMap = std::move(packageMap);
+    snapshot.packageIndex.build(snapshot.packageMap);
 
-    for (const auto& pkgFile : vstr) {
-      std::ifstream file(pkgFile);
-      json doc;
-      try {
-        doc = json::parse(file);
-      } catch (const json::parse_error &e) {
-        THROW_EXC_TRC_WAR(std::logic_error, "Failed to parse package information file: [" << e.byte << "] " << e.what());
+    TRC_FUNCTION_LEAVE("")
+  }
+
+  IJsCacheService::Package JsCache::parsePackage(
+    const std::string &fileName,
+    const CacheSnapshot &snapshot,
+    std::ostringstream &auxtrc
+  ) {
+    TRC_FUNCTION_ENTER(PAR(fileName));
+
+    std::ifstream file(fileName);
+    json doc;
+    try {
+      doc = json::parse(file);
+    } catch (const json::parse_error &e) {
+      THROW_EXC_TRC_WAR(std::logic_error, "Failed to parse package information file: [" << e.byte << "] " << e.what());
+    }
+
+    try {
+      unsigned int packageId = doc["packageID"];
+      uint16_t hwpid = doc["hwpid"];
+      uint16_t hwpidVer = doc["hwpidVer"];
+      std::string handlerUrl = doc["handlerUrl"];
+      std::string handlerHash = doc["handlerHash"];
+      std::string os = doc["os"];
+      std::string dpa = doc["dpa"];
+      std::string notes = doc["notes"];
+      auto driver = std::make_shared<const std::string>(doc["driver"].get<std::string>());
+
+      auxtrc << std::endl
+        << NAME_PAR(package, packageId)
+        << NAME_PAR(os, os)
+        << NAME_PAR(dpa, dpa)
+        << NAME_PAR(hwpid, hwpid)
+        << NAME_PAR(hwpidVer, hwpidVer)
+        << std::endl
+        << "    standards: ";
+
+      json standardsDoc = doc["standards"];
+      if (!standardsDoc.is_array()) {
+        THROW_EXC_TRC_WAR(std::logic_error, "Package standards should be an array. " << PAR(packageId));
+      }
+      std::vector<StdDriver> stdDrivers;
+      for (auto itr = standardsDoc.begin(); itr != standardsDoc.end(); ++itr) {
+        json standardDoc = itr.value();
+        int standardId = standardDoc["standardID"];
+        double version = standardDoc["version"];
+
+        const StdDriver *stdDrv = getStandard(snapshot, standardId, version);
+        if (stdDrv != nullptr) {
+          stdDrivers.emplace_back(*stdDrv);
+          auxtrc << '[' << standardId << ',' << std::fixed << std::setprecision(2) << version << "], ";
+        } else {
+          auxtrc << '[' << standardId << ',' << std::fixed << std::setprecision(2) << version << ", N/F], ";
+        }
       }
+      TRC_FUNCTION_LEAVE(PAR(packageId));
+      return Package(packageId, hwpid, hwpidVer, handlerUrl, handlerHash, os, dpa, notes, driver, stdDrivers);
+    } catch (const json::exception &e) {
+      THROW_EXC_TRC_WAR(std::logic_error, e.what())
+    } catch (const std::logic_error &e) {
+      THROW_EXC_TRC_WAR(std::logic_error, e.what());
+    }
+  }
 
-      try {
-        unsigned int packageId = doc["packageID"];
-        uint16_t hwpid = doc["hwpid"];
-        uint16_t hwpidVer = doc["hwpidVer"];
-        std::string handlerUrl = doc["handlerUrl"];
-        std::string handlerHash = doc["handlerHash"];
-        std::string os = doc["os"];
-        std::string dpa = doc["dpa"];
-        std::string notes = doc["notes"];
-        std::string driver = doc["driver"];
-
-        auxtrc << std::endl
-          << NAME_PAR(package, packageId)
-          << NAME_PAR(os, os)
-          << NAME_PAR(dpa, dpa)
-          << NAME_PAR(hwpid, hwpid)
-          << NAME_PAR(hwpidVer, hwpidVer)
-          << std::endl
-          << "    standards: ";
-
-        json standardsDoc = doc["standards"];
-        if (!standardsDoc.is_array()) {
-          THROW_EXC_TRC_WAR(std::logic_error, "Package standards should be an array. " << PAR(packageId));
+  void JsCache::patchSnapshot(const CacheSnapshot &current, const CacheDelta &delta, CacheSnapshot &snapshot) {
+    TRC_FUNCTION_ENTER("");
+
+    // entities stored in single file are parsed again or taken over as a whole
+    if (delta.hasEntity("server")) {
+      updateCacheServer(snapshot);
+    } else {
+      snapshot.serverState = current.serverState;
+    }
+    if (delta.hasEntity("companies")) {
+      updateCacheCompanies(snapshot);
+    } else {
+      snapshot.companyMap = current.companyMap;
+    }
+    if (delta.hasEntity("manufacturers")) {
+      updateCacheManufacturers(snapshot);
+    } else {
+      snapshot.manufacturerMap = current.manufacturerMap;
+    }
+    if (delta.hasEntity("products")) {
+      updateCacheProducts(snapshot);
+    } else {
+      snapshot.productMap = current.productMap;
+      snapshot.metadataSources = current.metadataSources;
+    }
+    if (delta.hasEntity("osdpa")) {
+      updateCacheOsDpa(snapshot);
+    } else {
+      snapshot.osDpaMap = current.osDpaMap;
+    }
+    if (delta.hasEntity("quantities")) {
+      updateCacheQuantities(snapshot);
+    } else {
+      snapshot.quantityMap = current.quantityMap;
+    }
+
+    // standard list holds standard names, changed list means all standards are parsed again
+    if (delta.hasEntity("standards")) {
+      updateCacheStandards(snapshot);
+    } else {
+      snapshot.standardMap = current.standardMap;
+      for (int id : delta.getStandards()) {
+        auto found = snapshot.standardMap.find(id);
+        if (found == snapshot.standardMap.end()) {
+          continue;
         }
-        std::vector<StdDriver> stdDrivers;
-        for (auto itr = standardsDoc.begin(); itr != standardsDoc.end(); ++itr) {
-          json standardDoc = itr.value();
-          int standardId = standardDoc["standardID"];
-          double version = standardDoc["version"];
-
-          std::shared_ptr<StdDriver> stdDrv = getStandard(standardId, version);
-          if (stdDrv != nullptr) {
-            stdDrivers.emplace_back(*stdDrv);
-            auxtrc << '[' << standardId << ',' << std::fixed << std::setprecision(2) << version << "], ";
-          } else {
-            auxtrc << '[' << standardId << ',' << std::fixed << std::setprecision(2) << version << ", N/F], ";
-          }
+        StdItem item(found->second.m_name);
+        updateCacheStandard(id, item);
+        found->second = std::move(item);
+      }
+    }
+
+    // packages hold copies of their standard drivers
+    if (delta.hasEntity("standards") || !delta.getStandards().empty()) {
+      updateCachePackages(snapshot);
+    } else {
+      snapshot.packageMap = current.packageMap;
+      StringPool driverPool;
+      for (const auto &[id, package] : snapshot.packageMap) {
+        driverPool.insert(package.m_driver);
+      }
+      std::ostringstream auxtrc;
+      for (unsigned int packageId : delta.getPackages()) {
+        snapshot.packageMap.erase(packageId);
+        std::string fileName = getCachePath(PACKAGES_DIR) + '/' + std::to_string(packageId) + "/data.json";
+        if (std::filesystem::exists(fileName)) {
+          Package package = parsePackage(fileName, snapshot, auxtrc);
+          package.m_driver = *driverPool.insert(package.m_driver).first;
+          const unsigned int id = package.m_packageId;
+          snapshot.packageMap.insert(std::make_pair(id, std::move(package)));
         }
-        Package package(packageId, hwpid, hwpidVer, handlerUrl, handlerHash, os, dpa, notes, driver, stdDrivers);
-        packageMap.insert(
-          std::make_pair(packageId, package)
-        );
-      } catch (const json::exception &e) {
-        THROW_EXC_TRC_WAR(std::logic_error, e.what())
-      } catch (const std::logic_error &e) {
-        THROW_EXC_TRC_WAR(std::logic_error, e.what());
       }
+      snapshot.packageIndex.build(snapshot.packageMap);
     }
-    m_packageMap = packageMap;
 
-    TRC_FUNCTION_LEAVE("")
+    TRC_FUNCTION_LEAVE("");
   }
 
-  void JsCache::updateCacheQuantities() {
+  void JsCache::updateCacheQuantities(CacheSnapshot &snapshot) {
     TRC_FUNCTION_ENTER("");
 
     std::string fileName = getCacheDataFilePath(QUANTITIES_DIR);
@@ -1097,11 +1318,317 @@ namespace iqrf {
         THROW_EXC_TRC_WAR(std::logic_error, e.what());
       }
     }
-    m_quantityMap = quantityMap;
+    snapshot.quantityMap = std::move(quantityMap);
 
     TRC_FUNCTION_LEAVE("");
   }
 
+  void JsCache::writeCacheImage(const CacheSnapshot &snapshot) const {
+    TRC_FUNCTION_ENTER("");
+
+    auto start = std::chrono::steady_clock::now();
+    try {
+      CacheImageWriter image;
+      auto addStdDriver = [&image](const StdDriver &driver) {
+        image.addInt(driver.getId());
+        image.addDouble(driver.getVersion());
+        image.addInt(driver.getVersionFlags());
+        image.addString(driver.getName());
+        image.addString(driver.getDriver() ? *driver.getDriver() : std::string());
+        image.addString(driver.getNotes() ? *driver.getNotes() : std::string());
+      };
+
+      const ServerState &server = snapshot.serverState;
+      image.beginTable(IMAGE_SERVER, 14);
+      image.addInt(server.m_apiVersion);
+      image.addString(server.m_hostname);
+      image.addString(server.m_user);
+      image.addString(server.m_buildDateTime);
+      image.addString(server.m_startDateTime);
+      image.addString(server.m_dateTime);
+      image.addInt(server.m_databaseChecksum);
+      image.addString(server.m_databaseChangeDateTime);
+
+      image.beginTable(IMAGE_COMPANIES, 5);
+      for (const auto &[id, company] : snapshot.companyMap) {
+        image.addUint(id);
+        image.addString(company.m_name);
+        image.addString(company.m_homePage);
+      }
+
+      image.beginTable(IMAGE_MANUFACTURERS, 4);
+      for (const auto &[id, manufacturer] : snapshot.manufacturerMap) {
+        image.addUint(id);
+        image.addUint(manufacturer.m_companyId);
+        image.addString(manufacturer.m_name);
+      }
+
+      // metadata are stored as source documents, empty source means product without metadata
+      image.beginTable(IMAGE_PRODUCTS, 8);
+      for (const auto &[hwpid, product] : snapshot.productMap) {
+        auto metadataSource = snapshot.metadataSources.find(hwpid);
+        image.addUint(hwpid);
+        image.addUint(product.m_manufacturerId);
+        image.addString(product.m_companyName);
+        image.addString(product.m_name);
+        image.addString(metadataSource != snapshot.metadataSources.end() ? metadataSource->second : std::string());
+      }
+
+      image.beginTable(IMAGE_OSDPA, 7);
+      for (const auto &[id, osDpa] : snapshot.osDpaMap) {
+        image.addUint(id);
+        image.addString(osDpa.m_os);
+        image.addString(osDpa.m_dpa);
+        image.addString(osDpa.m_notes);
+      }
+
+      image.beginTable(IMAGE_STANDARDS, 4);
+      for (const auto &[id, standard] : snapshot.standardMap) {
+        image.addInt(id);
+        image.addString(standard.m_name);
+        image.addUint(standard.m_valid);
+      }
+
+      image.beginTable(IMAGE_STANDARD_DRIVERS, 10);
+      for (const auto &[id, standard] : snapshot.standardMap) {
+        for (const auto &[version, driver] : standard.m_drivers) {
+          image.addDouble(version);
+          addStdDriver(driver);
+        }
+      }
+
+      // standard drivers of package are stored in consecutive rows of package drivers table
+      image.beginTable(IMAGE_PACKAGES, 17);
+      uint64_t packageDriverIdx = 0;
+      for (const auto &[id, package] : snapshot.packageMap) {
+        image.addUint(id);
+        image.addUint(package.m_hwpid);
+        image.addUint(package.m_hwpidVer);
+        image.addString(package.m_handlerUrl);
+        image.addString(package.m_handlerHash);
+        image.addString(package.m_os);
+        image.addString(package.m_dpa);
+        image.addString(package.m_notes);
+        image.addString(*package.m_driver);
+        image.addUint(packageDriverIdx);
+        image.addUint(package.m_stdDriverVect.size());
+        packageDriverIdx += package.m_stdDriverVect.size();
+      }
+
+      image.beginTable(IMAGE_PACKAGE_DRIVERS, 9);
+      for (const auto &[id, package] : snapshot.packageMap) {
+        for (const auto &driver : package.m_stdDriverVect) {
+          addStdDriver(driver);
+        }
+      }
+
+      image.beginTable(IMAGE_QUANTITIES, 15);
+      for (const auto &[type, quantity] : snapshot.quantityMap) {
+        image.addUint(type);
+        image.addString(quantity.m_id);
+        image.addString(quantity.m_name);
+        image.addString(quantity.m_shortName);
+        image.addString(quantity.m_unit);
+        image.addUint(quantity.m_precision);
+        image.addString(std::string(quantity.m_frcs.begin(), quantity.m_frcs.end()));
+        image.addUint(quantity.m_width);
+        image.addString(quantity.m_driverKey);
+      }
+
+      image.write(getCachePath(CACHE_IMAGE_FILE), CACHE_IMAGE_VERSION);
+    } catch (const std::exception &e) {
+      CATCH_EXC_TRC_WAR(std::exception, e, "[IQRF Repository cache] Failed to write cache image.");
+      removeCacheImage();
+      TRC_FUNCTION_LEAVE("");
+      return;
+    }
+
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    TRC_INFORMATION("[IQRF Repository cache] Cache image written in " << duration << " ms.");
+    TRC_FUNCTION_LEAVE("");
+  }
+
+  bool JsCache::readCacheImage(CacheSnapshot &snapshot) {
+    TRC_FUNCTION_ENTER("");
+
+    const std::string fileName = getCachePath(CACHE_IMAGE_FILE);
+    if (!std::filesystem::exists(fileName)) {
+      TRC_FUNCTION_LEAVE("Cache image does not exist.");
+      return false;
+    }
+
+    try {
+      CacheImageReader image(fileName, CACHE_IMAGE_VERSION);
+      // sources stored once in image are shared by all drivers referring to them
+      std::map<std::pair<const char *, size_t>, std::shared_ptr<const std::string>> sources;
+      auto getSource = [&sources](std::string_view source) {
+        auto &shared = sources[std::make_pair(source.data(), source.size())];
+        if (!shared) {
+          shared = std::make_shared<std::string>(source);
+        }
+        return shared;
+      };
+      auto getStdDriver = [&getSource](const CacheImageReader::Table &table, size_t row, uint32_t field) {
+        return StdDriver(
+          static_cast<int>(table.getInt(row, field)),
+          std::string(table.getString(row, field + 3)),
+          table.getDouble(row, field + 1),
+          getSource(table.getString(row, field + 5)),
+          getSource(table.getString(row, field + 7)),
+          static_cast<int>(table.getInt(row, field + 2))
+        );
+      };
+
+      auto server = image.getTable(IMAGE_SERVER, 14);
+      if (server.size() != 1) {
+        THROW_EXC_TRC_WAR(std::logic_error, "Cache image server state is missing.");
+      }
+      ServerState &serverState = snapshot.serverState;
+      serverState.m_apiVersion = static_cast<int>(server.getInt(0, 0));
+      serverState.m_hostname = server.getString(0, 1);
+      serverState.m_user = server.getString(0, 3);
+      serverState.m_buildDateTime = server.getString(0, 5);
+      serverState.m_startDateTime = server.getString(0, 7);
+      serverState.m_dateTime = server.getString(0, 9);
+      serverState.m_databaseChecksum = server.getInt(0, 11);
+      serverState.m_databaseChangeDateTime = server.getString(0, 12);
+      // image has to be built from the installed cache files
+      const int64_t databaseChecksum = getCacheServer(m_serverStateFilePath).m_databaseChecksum;
+      if (serverState.m_databaseChecksum != databaseChecksum) {
+        THROW_EXC_TRC_WAR(std::logic_error, "Cache image does not match cache files: "
+          << NAME_PAR(image, serverState.m_databaseChecksum) << NAME_PAR(files, databaseChecksum));
+      }
+
+      auto companies = image.getTable(IMAGE_COMPANIES, 5);
+      for (size_t i = 0; i < companies.size(); ++i) {
+        unsigned int id = static_cast<unsigned int>(companies.getUint(i, 0));
+        snapshot.companyMap.insert(std::make_pair(
+          id, Company(id, std::string(companies.getString(i, 1)), std::string(companies.getString(i, 3)))
+        ));
+      }
+
+      auto manufacturers = image.getTable(IMAGE_MANUFACTURERS, 4);
+      for (size_t i = 0; i < manufacturers.size(); ++i) {
+        unsigned int id = static_cast<unsigned int>(manufacturers.getUint(i, 0));
+        snapshot.manufacturerMap.insert(std::make_pair(
+          id, Manufacturer(id, static_cast<unsigned int>(manufacturers.getUint(i, 1)), std::string(manufacturers.getString(i, 2)))
+        ));
+      }
+
+      auto products = image.getTable(IMAGE_PRODUCTS, 8);
+      for (size_t i = 0; i < products.size(); ++i) {
+        uint16_t hwpid = static_cast<uint16_t>(products.getUint(i, 0));
+        std::string_view metadataSource = products.getString(i, 6);
+        std::shared_ptr<metadata::ProductMetadata> metadata = nullptr;
+        if (!metadataSource.empty()) {
+          metadata = std::make_shared<metadata::ProductMetadata>(
+            metadata::ProductMetadataParser::parse(json::parse(metadataSource))
+          );
+          snapshot.metadataSources.emplace(hwpid, std::string(metadataSource));
+        }
+        snapshot.productMap.insert(std::make_pair(
+          hwpid,
+          Product(
+            hwpid,
+            static_cast<unsigned int>(products.getUint(i, 1)),
+            std::string(products.getString(i, 2)),
+            std::string(products.getString(i, 4)),
+            metadata
+          )
+        ));
+      }
+
+      auto osDpas = image.getTable(IMAGE_OSDPA, 7);
+      for (size_t i = 0; i < osDpas.size(); ++i) {
+        unsigned int id = static_cast<unsigned int>(osDpas.getUint(i, 0));
+        snapshot.osDpaMap.insert(std::make_pair(
+          id,
+          OsDpa(id, std::string(osDpas.getString(i, 1)), std::string(osDpas.getString(i, 3)), std::string(osDpas.getString(i, 5)))
+        ));
+      }
+
+      auto standards = image.getTable(IMAGE_STANDARDS, 4);
+      for (size_t i = 0; i < standards.size(); ++i) {
+        StdItem item{std::string(standards.getString(i, 1))};
+        item.m_valid = standards.getUint(i, 3) != 0;
+        snapshot.standardMap.insert(std::make_pair(static_cast<int>(standards.getInt(i, 0)), std::move(item)));
+      }
+      auto standardDrivers = image.getTable(IMAGE_STANDARD_DRIVERS, 10);
+      for (size_t i = 0; i < standardDrivers.size(); ++i) {
+        StdDriver driver = getStdDriver(standardDrivers, i, 1);
+        auto found = snapshot.standardMap.find(driver.getId());
+        if (found == snapshot.standardMap.end()) {
+          THROW_EXC_TRC_WAR(std::logic_error, "Cache image driver of unknown standard: " << driver.getId());
+        }
+        found->second.m_drivers.insert(std::make_pair(standardDrivers.getDouble(i, 0), std::move(driver)));
+      }
+
+      auto packages = image.getTable(IMAGE_PACKAGES, 17);
+      auto packageDrivers = image.getTable(IMAGE_PACKAGE_DRIVERS, 9);
+      for (size_t i = 0; i < packages.size(); ++i) {
+        unsigned int id = static_cast<unsigned int>(packages.getUint(i, 0));
+        uint64_t driverIdx = packages.getUint(i, 15);
+        uint64_t driverCount = packages.getUint(i, 16);
+        if (driverIdx > packageDrivers.size() || driverCount > packageDrivers.size() - driverIdx) {
+          THROW_EXC_TRC_WAR(std::logic_error, "Cache image package drivers out of range: " << PAR(id));
+        }
+        std::vector<StdDriver> stdDrivers;
+        stdDrivers.reserve(driverCount);
+        for (uint64_t j = driverIdx; j < driverIdx + driverCount; ++j) {
+          stdDrivers.emplace_back(getStdDriver(packageDrivers, j, 0));
+        }
+        snapshot.packageMap.insert(std::make_pair(
+          id,
+          Package(
+            id,
+            static_cast<uint16_t>(packages.getUint(i, 1)),
+            static_cast<uint16_t>(packages.getUint(i, 2)),
+            std::string(packages.getString(i, 3)),
+            std::string(packages.getString(i, 5)),
+            std::string(packages.getString(i, 7)),
+            std::string(packages.getString(i, 9)),
+            std::string(packages.getString(i, 11)),
+            getSource(packages.getString(i, 13)),
+            stdDrivers
+          )
+        ));
+      }
+      snapshot.packageIndex.build(snapshot.packageMap);
+
+      auto quantities = image.getTable(IMAGE_QUANTITIES, 15);
+      for (size_t i = 0; i < quantities.size(); ++i) {
+        uint8_t type = static_cast<uint8_t>(quantities.getUint(i, 0));
+        std::string_view frcs = quantities.getString(i, 10);
+        snapshot.quantityMap.insert(std::make_pair(
+          type,
+          Quantity(
+            type,
+            std::string(quantities.getString(i, 1)),
+            std::string(quantities.getString(i, 3)),
+            std::string(quantities.getString(i, 5)),
+            std::string(quantities.getString(i, 7)),
+            static_cast<uint8_t>(quantities.getUint(i, 9)),
+            std::vector<uint8_t>(frcs.begin(), frcs.end()),
+            static_cast<uint8_t>(quantities.getUint(i, 12)),
+            std::string(quantities.getString(i, 13))
+          )
+        ));
+      }
+    } catch (const std::exception &e) {
+      CATCH_EXC_TRC_WAR(std::exception, e, "[IQRF Repository cache] Cache image cannot be used, loading cache files.");
+      TRC_FUNCTION_LEAVE("");
+      return false;
+    }
+
+    TRC_FUNCTION_LEAVE("");
+    return true;
+  }
+
+  void JsCache::removeCacheImage() const {
+    std::error_code ec;
+    std::filesystem::remove(getCachePath(CACHE_IMAGE_FILE), ec);
+  }
+
   std::string JsCache::getTmpPath(const std::string &path) const {
     return m_tmpDir + path;
   }
@@ -1169,10 +1696,10 @@ namespace iqrf {
 
     TRC_INFORMATION(
       "Comparing db checksums: " <<
-      NAME_PAR(localChecksum, m_serverState.m_databaseChecksum) <<
+      NAME_PAR(localChecksum, getSnapshot()->serverState.m_databaseChecksum) <<
       NAME_PAR(remoteChecksum, remoteServerState.m_databaseChecksum)
     );
-    m_upToDate = m_serverState.m_databaseChecksum == remoteServerState.m_databaseChecksum;
+    m_upToDate = getSnapshot()->serverState.m_databaseChecksum == remoteServerState.m_databaseChecksum;
 
     std::filesystem::remove(tmpServerStatePath);
 
@@ -1192,125 +1719,136 @@ namespace iqrf {
 
     TRC_INFORMATION("[IQRF Repository cache] Downloading cache...");
     std::cout << "[IQRF Repository cache] Downloading cache..." << std::endl;
+    auto start = std::chrono::steady_clock::now();
 
     std::string tmpArchivePath = getTmpPath("cache.zip");
     std::string tmpServerStatePath = getTmpPath("serverCheck.json");
-    CurlUtils::downloadFile(getAbsoluteUrl(ZIP_URL), tmpArchivePath, {{"accept", "application/zip"}});
-    CurlUtils::downloadFile(getAbsoluteUrl(SERVER_URL), tmpServerStatePath, {{"accept", "application/json"}});
-
-    if (!std::filesystem::exists(tmpArchivePath)) {
-      THROW_EXC_TRC_WAR(std::runtime_error, "file not exist " << PAR(tmpArchivePath));
-    }
-
-    zip_t *zipArch = nullptr;
-    zip_file_t *zipFile = nullptr;
-    int err;
-    constexpr zip_uint64_t BUF_SIZE = 8196;
-    char buf[BUF_SIZE];
-
-    if ((zipArch = zip_open(tmpArchivePath.c_str(), 0, &err)) == nullptr) {
-      zip_error_t error;
-      zip_error_init_with_code(&error, err);
-      const char *errorMessage = zip_error_strerror(&error);
-      zip_error_fini(&error);
-      THROW_EXC_TRC_WAR(std::logic_error, "Can't open zip archive: " << errorMessage);
-    }
-
-    zip_int64_t num_entries = zip_get_num_entries(zipArch, 0);
-
-    for (zip_uint64_t i = 0; i < static_cast<zip_uint64_t>(num_entries); i++) {
-      std::string name = zip_get_name(zipArch, i, 0);
-      std::string extractedPath = getTmpCachePath(name);
-      createDirectory(std::filesystem::path(extractedPath).parent_path());
-
-      zip_stat_t zipStat;
-      if (zip_stat_index(zipArch, i, 0, &zipStat) == 0) {
-        zipFile = zip_fopen_index(zipArch, i, 0);
-        if (!zipFile) {
-          THROW_EXC_TRC_WAR(std::logic_error, "Can't open file from zip: " << extractedPath);
-        }
-
-        std::ofstream outfile(extractedPath, std::ofstream::binary);
-        if (!outfile.is_open()) {
-          THROW_EXC_TRC_WAR(std::logic_error, "Can't open output file to inflate from zip: " << extractedPath);
-        }
-
-        zip_uint64_t sum = 0;
-        zip_int64_t len = 0;
-        while (sum != zipStat.size) {
-          len = zip_fread(zipFile, buf, BUF_SIZE);
-          if (len < 0) {
-            THROW_EXC_TRC_WAR(std::logic_error, "Can't write file from zip: " << extractedPath);
-          }
-
-          outfile.write(buf, len);
-          sum += len;
-        }
-
-        outfile.close();
-        zip_fclose(zipFile);
-      }
+    // archive transfer interrupted by unreliable connection is resumed by retries and next cache updates
+    try {
+      CurlUtils::downloadFiles({
+        {getAbsoluteUrl(ZIP_URL), tmpArchivePath, {{"accept", "application/zip"}}},
+        {getAbsoluteUrl(SERVER_URL), tmpServerStatePath, {{"accept", "application/json"}}},
+      });
+    } catch (const std::runtime_error &e) {
+      THROW_EXC_TRC_WAR(std::runtime_error, "Failed to download cache: " << e.what());
     }
 
-    if (zip_close(zipArch) == -1) {
-      TRC_WARNING("Can't close zip: " << tmpArchivePath);
+    // stale files of previous failed update must not be taken as downloaded ones
+    std::filesystem::remove_all(getTmpPath("cache"));
+    try {
+      size_t files = ZipUtils::extractArchive(tmpArchivePath, getTmpPath("cache"));
+      TRC_DEBUG("Extracted cache files: " << PAR(files));
+    } catch (const std::exception &e) {
+      std::filesystem::remove(tmpArchivePath);
+      THROW_EXC_TRC_WAR(std::logic_error, "Failed to extract cache archive: " << e.what());
     }
 
     std::filesystem::remove(tmpArchivePath);
     std::filesystem::remove(tmpServerStatePath);
 
-    TRC_INFORMATION("[IQRF Repository cache] Cache successfully downloaded.");
-    std::cout << "[IQRF Repository cache] Cache successfully downloaded." << std::endl;
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    TRC_INFORMATION("[IQRF Repository cache] Cache successfully downloaded in " << duration << " ms.");
+    std::cout << "[IQRF Repository cache] Cache successfully downloaded in " << duration << " ms." << std::endl;
 
     TRC_FUNCTION_LEAVE("")
   }
 
-  void JsCache::updateCacheFiles() const {
+  CacheDelta JsCache::compareCache() const {
+    TRC_FUNCTION_ENTER(PAR(m_deltaUpdate));
+
+    CacheDelta delta = CacheDelta::compare(getTmpPath("cache"), getCachePath("cache"), !m_deltaUpdate);
+
+    TRC_INFORMATION("[IQRF Repository cache] Cache changes: "
+      << NAME_PAR(full, delta.isFull())
+      << NAME_PAR(changedFiles, delta.getChangedFiles().size())
+      << NAME_PAR(removedFiles, delta.getRemovedFiles().size())
+      << NAME_PAR(standards, delta.getStandards().size())
+      << NAME_PAR(packages, delta.getPackages().size())
+    );
+    TRC_FUNCTION_LEAVE("");
+    return delta;
+  }
+
+  void JsCache::updateCacheFiles(const CacheDelta &delta) const {
     TRC_FUNCTION_ENTER("");
 
     TRC_INFORMATION("[IQRF Repository cache] Updating cache files...");
     std::cout << "[IQRF Repository cache] Updating cache files..." << std::endl;
+    auto start = std::chrono::steady_clock::now();
+
+    // image of previous cache files must not be loaded if the update is interrupted
+    removeCacheImage();
 
-    std::string cacheName = getCachePath("cache");
-    std::string cacheNameOld = getCachePath("cache.old");
-    if (std::filesystem::exists(cacheName)) {
-      std::filesystem::remove_all(cacheNameOld);
-      std::filesystem::copy(cacheName, cacheNameOld, std::filesystem::copy_options::overwrite_existing | std::filesystem::copy_options::recursive);
-      std::filesystem::remove_all(cacheName);
+    const std::filesystem::path cacheRoot(getCachePath("cache"));
+    const std::filesystem::path tmpCache(getTmpPath("cache"));
+
+    for (const auto &path : delta.getRemovedFiles()) {
+      std::filesystem::path filePath = cacheRoot / path;
+      std::filesystem::remove(filePath);
+      // drop directories of removed packages and standards
+      for (auto dir = filePath.parent_path(); dir != cacheRoot && std::filesystem::exists(dir) && std::filesystem::is_empty(dir); dir = dir.parent_path()) {
+        std::filesystem::remove(dir);
+      }
+    }
+    // server state is replaced last, interrupted update is detected as outdated cache by next check
+    std::vector<std::string> changedFiles(delta.getChangedFiles().begin(), delta.getChangedFiles().end());
+    std::stable_partition(changedFiles.begin(), changedFiles.end(), [](const std::string &path) {
+      return path != SERVER_DATA_FILE;
+    });
+    for (const auto &path : changedFiles) {
+      std::filesystem::path filePath = cacheRoot / path;
+      std::filesystem::create_directories(filePath.parent_path());
+      std::filesystem::copy_file(tmpCache / path, filePath, std::filesystem::copy_options::overwrite_existing);
     }
-    // copy and overwrite existing cache, remove tmp
-    std::string tmpCache = getTmpPath("cache");
-    std::filesystem::copy(tmpCache, cacheName, std::filesystem::copy_options::overwrite_existing | std::filesystem::copy_options::recursive);
     std::filesystem::remove_all(tmpCache);
 
-    TRC_INFORMATION("[IQRF Repository cache] Cache files successfully updated.");
-    std::cout << "[IQRF Repository cache] Cache files successfully updated." << std::endl;
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    TRC_INFORMATION("[IQRF Repository cache] Cache files successfully updated in " << duration << " ms: "
+      << NAME_PAR(changed, changedFiles.size())
+      << NAME_PAR(removed, delta.getRemovedFiles().size())
+    );
+    std::cout << "[IQRF Repository cache] Cache files successfully updated in " << duration << " ms." << std::endl;
+    TRC_FUNCTION_LEAVE("");
   }
 
-  void JsCache::validateCache() {
+  void JsCache::validateCache(const CacheDelta &delta) {
     TRC_FUNCTION_ENTER("");
 
     TRC_INFORMATION("[IQRF Repository cache] Validating cache contents...");
     std::cout << "[IQRF Repository cache] Validating cache contents..." << std::endl;
 
+    PhaseTimer timer;
+
     // companies data
     try {
-      validateCompaniesData();
-      validateManufacturersData();
-      validateProductsData();
-      validateOsDpaData();
-      validateStandardsListData();
-      validateStandardsVersionsData();
-      validatePackagesData();
-      validateQuantitiesData();
+      if (delta.hasEntity("companies")) {
+        timer.measure("companies", [&] { validateCompaniesData(); });
+      }
+      if (delta.hasEntity("manufacturers")) {
+        timer.measure("manufacturers", [&] { validateManufacturersData(); });
+      }
+      if (delta.hasEntity("products")) {
+        timer.measure("products", [&] { validateProductsData(); });
+      }
+      if (delta.hasEntity("osdpa")) {
+        timer.measure("osdpa", [&] { validateOsDpaData(); });
+      }
+      if (delta.hasEntity("standards")) {
+        timer.measure("standard list", [&] { validateStandardsListData(); });
+      }
+      timer.measure("standards", [&] { validateStandardsVersionsData(delta); });
+      timer.measure("packages", [&] { validatePackagesData(delta); });
+      if (delta.hasEntity("quantities")) {
+        timer.measure("quantities", [&] { validateQuantitiesData(); });
+      }
     } catch (const std::exception &e) {
       std::filesystem::remove_all(getTmpPath("cache"));
       std::cerr << "[IQRF Repository cache] " << e.what() << std::endl;
       THROW_EXC_TRC_WAR(std::runtime_error, "[IQRF Repository cache] " << e.what() << std::endl);
     }
 
-    TRC_INFORMATION("[IQRF Repository cache] Cache contents successfully validated.");
-    std::cout << "[IQRF Repository cache] Cache contents successfully validated." << std::endl;
+    TRC_INFORMATION("[IQRF Repository cache] Cache contents successfully validated: " << timer.str());
+    std::cout << "[IQRF Repository cache] Cache contents successfully validated in " << timer.total() << " ms." << std::endl;
 
     TRC_FUNCTION_LEAVE("");
   }
@@ -1412,7 +1950,7 @@ namespace iqrf {
     TRC_FUNCTION_LEAVE("");
   }
 
-  void JsCache::validateStandardsVersionsData() {
+  void JsCache::validateStandardsVersionsData(const CacheDelta &delta) {
     TRC_FUNCTION_ENTER("");
 
     valijson::Schema standardVersionsSchema, standardDataSchema;
@@ -1423,12 +1961,13 @@ namespace iqrf {
 
     std::vector<std::filesystem::path> dirs;
     for (const auto &item : std::filesystem::directory_iterator(getTmpCachePath("standards"))) {
-      if (item.is_directory()) {
+      if (item.is_directory() && isChanged(item.path(), delta, &CacheDelta::hasStandard)) {
         dirs.emplace_back(item.path());
       }
     }
 
-    for (const auto &dir : dirs) {
+    ParallelRunner(m_loaderThreads).run(dirs.size(), [&](size_t i) {
+      const auto &dir = dirs[i];
       auto standardVersionFilePath = dir.string() + "/data.json";
       valijson::ValidationResults errors;
       if (!JsonValidationUtils::validate(standardVersionsSchema, standardVersionFilePath, errors)) {
@@ -1450,12 +1989,12 @@ namespace iqrf {
           throw std::runtime_error("Data file " + standardDataFilePath + " violates constraints of schema " + standardDataSchemaPath);
         }
       }
-    }
+    });
 
     TRC_FUNCTION_LEAVE("");
   }
 
-  void JsCache::validatePackagesData() {
+  void JsCache::validatePackagesData(const CacheDelta &delta) {
     TRC_FUNCTION_ENTER("");
 
     valijson::Schema schema;
@@ -1475,19 +2014,19 @@ namespace iqrf {
 
     std::vector<std::filesystem::path> dirs;
     for (const auto &item : std::filesystem::directory_iterator(getTmpCachePath("packages/id"))) {
-      if (item.is_directory()) {
+      if (item.is_directory() && isChanged(item.path(), delta, &CacheDelta::hasPackage)) {
         dirs.emplace_back(item.path());
       }
     }
 
-    valijson::ValidationResults errors;
-    for (const auto &dir : dirs) {
-      auto filePath = dir.string() + "/data.json";
+    ParallelRunner(m_loaderThreads).run(dirs.size(), [&](size_t i) {
+      auto filePath = dirs[i].string() + "/data.json";
+      valijson::ValidationResults errors;
       if (!JsonValidationUtils::validate(schema, filePath, errors)) {
         logSchemaViolations(JsonValidationUtils::getSchemaViolations(errors));
         throw std::runtime_error("Data file " + filePath + " violates constraints of schema " + schemaPath);
       }
-    }
+    });
 
     TRC_FUNCTION_LEAVE("");
   }
@@ -1520,36 +2059,55 @@ namespace iqrf {
     TRC_FUNCTION_LEAVE("");
   }
 
-  void JsCache::loadCache(bool firstLoad) {
+  void JsCache::loadCache(bool firstLoad, const CacheDelta *delta) {
     TRC_FUNCTION_ENTER("");
 
     std::lock_guard<std::recursive_mutex> lck(m_updateMtx);
 
-    auto serverState = m_serverState;
-    auto companyMap = m_companyMap;
-    auto manufacturerMap = m_manufacturerMap;
-    auto productMap = m_productMap;
-    auto osDpaMap = m_osDpaMap;
-    auto standardMap = m_standardMap;
-    auto packageMap = m_packageMap;
-    auto quantityMap = m_quantityMap;
     try {
       TRC_INFORMATION("[IQRF Repository cache] Loading cache... ");
       std::cout << "[IQRF Repository cache] Loading cache... " << std::endl;
 
-      updateCacheServer();
-      updateCacheCompanies();
-      updateCacheManufacturers();
-      updateCacheProducts();
-      updateCacheOsDpa();
-      updateCacheStandards();
-      updateCachePackages();
-      updateCacheQuantities();
+      // readers keep using current snapshot until the new one is complete
+      auto snapshot = std::make_shared<CacheSnapshot>();
+      PhaseTimer timer;
+      bool patched = false;
+      // changes apply to published snapshot only if it matches cache files before the update
+      if (delta != nullptr && !delta->isFull() && !m_snapshotStale) {
+        try {
+          timer.measure("changes", [&] { patchSnapshot(*getSnapshot(), *delta, *snapshot); });
+          patched = true;
+        } catch (const std::exception &e) {
+          CATCH_EXC_TRC_WAR(std::exception, e, "[IQRF Repository cache] Applying cache changes failed, loading whole cache.");
+          snapshot = std::make_shared<CacheSnapshot>();
+        }
+      }
+      // image is used only for loads not preceded by cache files update
+      bool fromImage = !patched && delta == nullptr && m_cacheImage;
+      if (fromImage) {
+        timer.measure("image", [&] { fromImage = readCacheImage(*snapshot); });
+        if (!fromImage) {
+          snapshot = std::make_shared<CacheSnapshot>();
+        }
+      }
+      if (!patched && !fromImage) {
+        timer.measure("server", [&] { updateCacheServer(*snapshot); });
+        timer.measure("companies", [&] { updateCacheCompanies(*snapshot); });
+        timer.measure("manufacturers", [&] { updateCacheManufacturers(*snapshot); });
+        timer.measure("products", [&] { updateCacheProducts(*snapshot); });
+        timer.measure("osdpa", [&] { updateCacheOsDpa(*snapshot); });
+        timer.measure("standards", [&] { updateCacheStandards(*snapshot); });
+        timer.measure("packages", [&] { updateCachePackages(*snapshot); });
+        timer.measure("quantities", [&] { updateCacheQuantities(*snapshot); });
+      }
+      std::shared_ptr<const CacheSnapshot> published(std::move(snapshot));
+      std::atomic_store(&m_snapshot, published);
+      m_snapshotStale = false;
 
       m_upToDate = true;
       m_cacheStatus = CacheStatus::UPDATED;
-      TRC_INFORMATION("[IQRF Repository cache] Cache successfully loaded.");
-      std::cout << "[IQRF Repository cache] Cache successfully loaded." << std::endl;
+      TRC_INFORMATION("[IQRF Repository cache] Cache successfully loaded: " << timer.str());
+      std::cout << "[IQRF Repository cache] Cache successfully loaded in " << timer.total() << " ms." << std::endl;
 
       // invoke call back
       {
@@ -1560,19 +2118,16 @@ namespace iqrf {
           }
         }
       }
+
+      if (m_cacheImage && !fromImage) {
+        writeCacheImage(*published);
+      }
     } catch (std::exception &e) {
       CATCH_EXC_TRC_WAR(std::logic_error, e, "[IQRF Repository cache] Loading cache failed: " << e.what());
       std::cerr << "[IQRF Repository cache] Loading IqrfRepo cache failed: " << e.what() << std::endl;
       m_cacheStatus = CacheStatus::UPDATE_FAILED;
       m_cacheUpdateError = e.what();
-      m_serverState = serverState;
-      m_companyMap = companyMap;
-      m_manufacturerMap = manufacturerMap;
-      m_productMap = productMap;
-      m_osDpaMap = osDpaMap;
-      m_standardMap = standardMap;
-      m_packageMap = packageMap;
-      m_quantityMap = quantityMap;
+      m_snapshotStale = true;
       if (firstLoad) {
         THROW_EXC_TRC_WAR(std::logic_error, "[IQRF Repository cache] Failed to initialize cache.");
       }
@@ -1602,44 +2157,40 @@ namespace iqrf {
       m_cacheStatus = CacheStatus::PENDING;
       m_cacheUpdateError = "ok";
 
+      // update runs without DPA exclusive access, new snapshot is published atomically and drivers
+      // reload requested by cache reload handlers swaps contexts without interrupting running calls
+      bool filesUpdated = false;
       try {
-        m_exclusiveAccess = m_iIqrfDpaService->getExclusiveAccess();
-        try {
-          checkCache();
+        checkCache();
+        if (invoked) {
+          // wake up invoking thread
+          m_invokeWorkerCv.notify_all();
+          // wait for invoking thread to collect cache status
+          m_cacheUpdateCv.wait(lock);
+        }
+        if (!m_upToDate) {
+          downloadCache();
+          CacheDelta delta = compareCache();
+          validateCache(delta);
+          filesUpdated = true;
+          updateCacheFiles(delta);
+          loadCache(false, &delta);
           if (invoked) {
             // wake up invoking thread
             m_invokeWorkerCv.notify_all();
-            // wait for invoking thread to collect cache status
-            m_cacheUpdateCv.wait(lock);
-          }
-          if (!m_upToDate) {
-            downloadCache();
-            validateCache();
-            updateCacheFiles();
-            loadCache();
-            if (invoked) {
-              // wake up invoking thread
-              m_invokeWorkerCv.notify_all();
-              // wait for invoking thread to collect cache status after update
-              m_cacheUpdateCv.wait(lock);
-            }
-          }
-        } catch (std::exception &e) {
-          CATCH_EXC_TRC_WAR(std::logic_error, e, "[IQRF Repository cache] Periodic cache update failed, next attempt in " << m_checkPeriodInMinutes << " minutes.");
-          std::cerr << "[IQRF Repository cache] Periodic cache update failed, next attempt in " << m_checkPeriodInMinutes << " minutes." << std::endl;
-          m_cacheStatus = CacheStatus::UPDATE_FAILED;
-          m_cacheUpdateError = e.what();
-          if (invoked) {
-            m_invokeWorkerCv.notify_all();
+            // wait for invoking thread to collect cache status after update
             m_cacheUpdateCv.wait(lock);
           }
         }
-        m_exclusiveAccess.reset();
-      } catch (const std::exception &e) {
-        std::string errorStr("Exclusive access unavailable, cache update cancelled.");
-        CATCH_EXC_TRC_WAR(std::exception, e, errorStr);
+      } catch (std::exception &e) {
+        CATCH_EXC_TRC_WAR(std::logic_error, e, "[IQRF Repository cache] Periodic cache update failed, next attempt in " << m_checkPeriodInMinutes << " minutes.");
+        std::cerr << "[IQRF Repository cache] Periodic cache update failed, next attempt in " << m_checkPeriodInMinutes << " minutes." << std::endl;
         m_cacheStatus = CacheStatus::UPDATE_FAILED;
-        m_cacheUpdateError = errorStr;
+        m_cacheUpdateError = e.what();
+        // cache files may be partially replaced, delta must not be applied to published snapshot
+        if (filesUpdated) {
+          m_snapshotStale = true;
+        }
         if (invoked) {
           m_invokeWorkerCv.notify_all();
           m_cacheUpdateCv.wait(lock);
@@ -23,12 +23,17 @@
 #include "ILaunchService.h"
 #include "IIqrfDpaService.h"
 #include "ITraceService.h"
+#include "CacheDelta.h"
+#include "PackageIndex.h"
 #include "ShapeProperties.h"
 
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <thread>
+#include <unordered_set>
 
 namespace iqrf {
 
@@ -124,38 +129,38 @@ namespace iqrf {
      * Returns driver by ID and driver version
      * @param id Driver (standard) ID
      * @param ver Driver version
-     * @return std::shared_ptr<StdDriver> Driver
+     * @return std::shared_ptr<const StdDriver> Driver
      */
-    std::shared_ptr<StdDriver> getDriver(int id, double ver) const override;
+    std::shared_ptr<const StdDriver> getDriver(int id, double ver) const override;
 
     /**
      * Return latest driver by ID
      * @param id Driver (standard) ID
-     * @return std::shared_ptr<StdDriver>
+     * @return std::shared_ptr<const StdDriver>
      */
-    std::shared_ptr<StdDriver> getLatestDriver(int id) const override;
+    std::shared_ptr<const StdDriver> getLatestDriver(int id) const override;
 
     /**
      * Returns manufacturer by product HWPID
      * @param hwpid Product HWPID
-     * @return std::shared_ptr<Manufacturer> Manufacturer
+     * @return std::shared_ptr<const Manufacturer> Manufacturer
      */
-    std::shared_ptr<Manufacturer> getManufacturer(uint16_t hwpid) const override;
+    std::shared_ptr<const Manufacturer> getManufacturer(uint16_t hwpid) const override;
 
     /**
      * Returns product by product HWPID
      * @param hwpid Product HWPID
-     * @return std::shared_ptr<Product> Product
+     * @return std::shared_ptr<const Product> Product
      */
-    std::shared_ptr<Product> getProduct(uint16_t hwpid) const override;
+    std::shared_ptr<const Product> getProduct(uint16_t hwpid) const override;
 
     /**
      * Returns product metadata profile by HWPID and HWPID version
      * @param hwpid Product HWPID
      * @param hwpidVer HWPID version
-     * @return `std::optional<Metadata>` Metadata profile
+     * @return Metadata profile, nullptr if product has no metadata for HWPID version
      */
-    const metadata::Metadata* getProductMetadata(uint16_t hwpid, uint16_t hwpidVer) const override;
+    std::shared_ptr<const metadata::Metadata> getProductMetadata(uint16_t hwpid, uint16_t hwpidVer) const override;
 
     /**
      * Returns product package by HWPID, string OS and string DPA
@@ -163,9 +168,9 @@ namespace iqrf {
      * @param hwpidVer HWPID version
      * @param os OS string
      * @param dpa DPA string
-     * @return std::shared_ptr<Package> Package
+     * @return std::shared_ptr<const Package> Package
      */
-    std::shared_ptr<Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, const std::string& os, const std::string& dpa) const override;
+    std::shared_ptr<const Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, const std::string& os, const std::string& dpa) const override;
 
     /**
      * Returns product package by HWPID, OS and DPA
@@ -173,9 +178,9 @@ namespace iqrf {
      * @param hwpidVer HWPID version
      * @param os OS
      * @param dpa DPA
-     * @return std::shared_ptr<Package> Package
+     * @return std::shared_ptr<const Package> Package
      */
-    std::shared_ptr<Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, uint16_t os, uint16_t dpa) const override;
+    std::shared_ptr<const Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, uint16_t os, uint16_t dpa) const override;
 
     /**
      * Returns driver combinations by string OS and DPA
@@ -202,24 +207,24 @@ namespace iqrf {
     /**
      * Returns OS DPA by id
      * @param id OS DPA ID
-     * @return std::shared_ptr<OsDpa> OS DPA
+     * @return std::shared_ptr<const OsDpa> OS DPA
      */
-    std::shared_ptr<OsDpa> getOsDpa(int id) const override;
+    std::shared_ptr<const OsDpa> getOsDpa(int id) const override;
 
     /**
      * Returns OS DPA by string OS and DPA
      * @param os OS string
      * @param dpa DPA string
-     * @return std::shared_ptr<OsDpa> OS DPA
+     * @return std::shared_ptr<const OsDpa> OS DPA
      */
-    std::shared_ptr<OsDpa> getOsDpa(const std::string& os, const std::string& dpa) const override;
+    std::shared_ptr<const OsDpa> getOsDpa(const std::string& os, const std::string& dpa) const override;
 
     /**
      * Returns quantity by sensor type (ID)
      * @param type Sensor type
-     * @return std::shared_ptr<Quantity> Quantity
+     * @return std::shared_ptr<const Quantity> Quantity
      */
-    std::shared_ptr<Quantity> getQuantity(uint8_t type) const override;
+    std::shared_ptr<const Quantity> getQuantity(uint8_t type) const override;
 
     /**
      * Returns server state
@@ -247,6 +252,62 @@ namespace iqrf {
     void unregisterCacheReloadedHandler(const std::string &clientId) override;
 
   private:
+    /// Hashes shared string by content
+    struct SharedStringHash {
+      size_t operator()(const std::shared_ptr<const std::string> &str) const {
+        return std::hash<std::string>()(*str);
+      }
+    };
+
+    /// Compares shared strings by content
+    struct SharedStringEqual {
+      bool operator()(const std::shared_ptr<const std::string> &lhs, const std::shared_ptr<const std::string> &rhs) const {
+        return *lhs == *rhs;
+      }
+    };
+
+    /// Strings interned by content
+    typedef std::unordered_set<std::shared_ptr<const std::string>, SharedStringHash, SharedStringEqual> StringPool;
+
+    /**
+     * Immutable snapshot of cache contents
+     *
+     * Snapshot is built by cache load and published as a whole, readers keep the snapshot they took
+     * consistent for all their lookups. Package index refers to packages of the same snapshot.
+     */
+    struct CacheSnapshot {
+      CacheSnapshot() = default;
+      CacheSnapshot(const CacheSnapshot &) = delete;
+      CacheSnapshot &operator=(const CacheSnapshot &) = delete;
+
+      /// Server state (repository)
+      ServerState serverState;
+      /// Companies
+      std::map<unsigned int, Company> companyMap;
+      /// Manufacturers
+      std::map<unsigned int, Manufacturer> manufacturerMap;
+      /// Products
+      std::map<uint16_t, Product> productMap;
+      /// Static metadata documents of products, stored in cache image
+      std::map<uint16_t, std::string> metadataSources;
+      /// OS DPA combinations
+      std::map<unsigned int, OsDpa> osDpaMap;
+      /// Packages
+      std::map<unsigned int, Package> packageMap;
+      /// Package lookup indexes
+      PackageIndex<Package> packageIndex;
+      /// Standards
+      std::map<int, StdItem> standardMap;
+      /// Quantities
+      std::map<uint8_t, Quantity> quantityMap;
+    };
+
+    /**
+     * Returns current snapshot of cache contents
+     * @return Cache snapshot
+     */
+    std::shared_ptr<const CacheSnapshot> getSnapshot() const;
+
     /**
      * Returns cache server state from file
      * @param fileName Server state file
@@ -256,51 +317,102 @@ namespace iqrf {
 
     /**
      * Get standard driver
+     * @param snapshot Cache snapshot
      * @param standardId Standard ID
      * @param version Driver version
-     * @return std::shared_ptr<StdDriver> Standard driver
+     * @return const StdDriver* Standard driver owned by snapshot, nullptr if not found
      */
-    std::shared_ptr<StdDriver> getStandard(int standardId, double version);
+    const StdDriver *getStandard(const CacheSnapshot &snapshot, int standardId, double version);
 
     /**
      * Parses and stores cache server state
+     * @param snapshot Snapshot to store to
      */
-    void updateCacheServer();
+    void updateCacheServer(CacheSnapshot &snapshot);
 
     /**
      * Parses and stores cache companies
+     * @param snapshot Snapshot to store to
      */
-    void updateCacheCompanies();
+    void updateCacheCompanies(CacheSnapshot &snapshot);
 
     /**
      * Parses and stores cache manufacturers
+     * @param snapshot Snapshot to store to
      */
-    void updateCacheManufacturers();
+    void updateCacheManufacturers(CacheSnapshot &snapshot);
 
     /**
      * Parses and stores cache products
+     * @param snapshot Snapshot to store to
      */
-    void updateCacheProducts();
+    void updateCacheProducts(CacheSnapshot &snapshot);
 
     /**
      * Parses and stores cache OS DPA
+     * @param snapshot Snapshot to store to
      */
-    void updateCacheOsDpa();
+    void updateCacheOsDpa(CacheSnapshot &snapshot);
 
     /**
      * Parses and stores cache standards
+     * @param snapshot Snapshot to store to
+     */
+    void updateCacheStandards(CacheSnapshot &snapshot);
+
+    /**
+     * Parses versions of single standard
+     * @param id Standard ID
+     * @param item Standard to store versions to
      */
-    void updateCacheStandards();
+    void updateCacheStandard(int id, StdItem &item);
 
     /**
      * Parses and stores cache packages
+     * @param snapshot Snapshot to store to
+     */
+    void updateCachePackages(CacheSnapshot &snapshot);
+
+    /**
+     * Parses package information file
+     * @param fileName Package information file
+     * @param snapshot Snapshot with standards used by package
+     * @param auxtrc Package trace output
+     * @return Package Package, custom driver source is not interned
+     */
+    Package parsePackage(const std::string &fileName, const CacheSnapshot &snapshot, std::ostringstream &auxtrc);
+
+    /**
+     * Builds snapshot from current one, only changed entities are parsed again
+     * @param current Current snapshot
+     * @param delta Changes of cache files
+     * @param snapshot Snapshot to store to
      */
-    void updateCachePackages();
+    void patchSnapshot(const CacheSnapshot &current, const CacheDelta &delta, CacheSnapshot &snapshot);
 
     /**
      * Parses and stores cache quantities
+     * @param snapshot Snapshot to store to
      */
-    void updateCacheQuantities();
+    void updateCacheQuantities(CacheSnapshot &snapshot);
+
+    /**
+     * Writes snapshot to cache image
+     * @param snapshot Snapshot loaded from cache files
+     */
+    void writeCacheImage(const CacheSnapshot &snapshot) const;
+
+    /**
+     * Reads snapshot from cache image if the image matches installed cache files
+     * @param snapshot Snapshot to store to
+     * @return true if snapshot was read, false if cache files have to be parsed
+     */
+    bool readCacheImage(CacheSnapshot &snapshot);
+
+    /**
+     * Removes cache image
+     */
+    void removeCacheImage() const;
 
     /**
      * Returns absolute path to tmp cache directory
@@ -371,14 +483,22 @@ namespace iqrf {
     void downloadCache();
 
     /**
-     * Replace cache files from tmp file after validation
+     * Compares downloaded cache with installed cache
+     * @return CacheDelta Changes of cache files, full if delta updates are disabled
      */
-    void updateCacheFiles() const;
+    CacheDelta compareCache() const;
 
     /**
-     * Validates downloaded cache
+     * Replace changed cache files from tmp files after validation
+     * @param delta Changes of cache files
      */
-    void validateCache();
+    void updateCacheFiles(const CacheDelta &delta) const;
+
+    /**
+     * Validates changed files of downloaded cache
+     * @param delta Changes of cache files
+     */
+    void validateCache(const CacheDelta &delta);
 
     /**
      * Log schema violations
@@ -413,13 +533,15 @@ namespace iqrf {
 
     /**
      * Validates standards version data
+     * @param delta Changes of cache files
      */
-    void validateStandardsVersionsData();
+    void validateStandardsVersionsData(const CacheDelta &delta);
 
     /**
      * Validates packages data
+     * @param delta Changes of cache files
      */
-    void validatePackagesData();
+    void validatePackagesData(const CacheDelta &delta);
 
     /**
      * Validates quantities data
@@ -433,8 +555,10 @@ namespace iqrf {
 
     /**
      * Loads cache contents from cache directory
+     * @param firstLoad Initial load, failure is reported by exception
+     * @param delta Changes of cache files, whole cache is loaded if nullptr
      */
-    void loadCache(bool firstLoad = false);
+    void loadCache(bool firstLoad = false, const CacheDelta *delta = nullptr);
 
     /**
      * Cache update worker
@@ -451,7 +575,7 @@ namespace iqrf {
     iqrf::ISchedulerService *m_iSchedulerService = nullptr;
     /// Launch service
     shape::ILaunchService *m_iLaunchService = nullptr;
-    /// Cache update mutex
+    /// Cache update mutex, serializes cache loads and checks, readers use snapshot without locking
     mutable std::recursive_mutex m_updateMtx;
     /// Path to tmp Daemon directory
     std::string m_tmpDir = "/tmp/iqrf-gateway-daemon/";
@@ -465,6 +589,12 @@ namespace iqrf {
     std::string m_iqrfRepoCache = "iqrfRepoCache";
     /// Download cache if cache is empty
     bool m_downloadIfRepoCacheEmpty = false;
+    /// Update only changed cache files and entities
+    bool m_deltaUpdate = true;
+    /// Number of threads validating and parsing cache files, 0 for number of hardware threads
+    unsigned int m_loaderThreads = 0;
+    /// Load cache from compiled cache image when cache files did not change
+    bool m_cacheImage = true;
     /// Cache update thread
     std::thread m_cacheUpdateThread;
     /// Cache update thread variable
@@ -489,26 +619,12 @@ namespace iqrf {
     bool m_upToDate = false;
     /// Cache reload handlers map
     std::map<std::string, CacheReloadedFunc> m_cacheReloadedHndlMap;
-    /// Exclusive access
-    std::unique_ptr<IIqrfDpaService::ExclusiveAccess> m_exclusiveAccess;
 
     /// Server state file
     std::string m_serverStateFilePath;
-    /// Server state (repository)
-    ServerState m_serverState;
-    /// Companies
-    std::map<unsigned int, Company> m_companyMap;
-    /// Manufacturers
-    std::map<unsigned int, Manufacturer> m_manufacturerMap;
-    /// Products
-    std::map<uint16_t, Product> m_productMap;
-    /// OS DPA combinations
-    std::map<unsigned int, OsDpa> m_osDpaMap;
-    /// Packages
-    std::map<unsigned int, Package> m_packageMap;
-    /// Standards
-    std::map<int, StdItem> m_standardMap;
-    /// Quantities
-    std::map<uint8_t, Quantity> m_quantityMap;
+    /// Cache contents, accessed by atomic_load and atomic_store
+    std::shared_ptr<const CacheSnapshot> m_snapshot;
+    /// Published snapshot does not reflect cache files after failed cache files update or load
+    bool m_snapshotStale = false;
   };
 }
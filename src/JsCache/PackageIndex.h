@@ -0,0 +1,186 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace iqrf {
+
+  /**
+   * Secondary indexes of repository packages
+   *
+   * Packages are indexed by product (HWPID, HWPID version) and OS and DPA versions. Numeric versions
+   * are parsed from package strings, string lookups match package strings exactly. Index refers to
+   * packages of the map it was built from and has to be rebuilt when the map changes.
+   * @tparam T Package type
+   */
+  template <class T>
+  class PackageIndex {
+  public:
+    /// Packages in package ID order
+    typedef std::vector<const T *> PackageList;
+
+    /**
+     * Builds indexes, the first package in package ID order wins on duplicate keys
+     * @param packages Packages by package ID
+     */
+    void build(const std::map<unsigned int, T> &packages) {
+      clear();
+      m_packages.reserve(packages.size());
+      for (const auto &[id, package] : packages) {
+        auto &osDpa = m_osDpaPackages[osDpaKey(package.m_os, package.m_dpa)];
+        osDpa.packages.push_back(&package);
+        osDpa.products.emplace(productKey(package.m_hwpid, package.m_hwpidVer), &package);
+        uint16_t osBuild = 0;
+        uint16_t dpaVer = 0;
+        if (parseVersion(package.m_os, osBuild) && parseVersion(package.m_dpa, dpaVer)) {
+          m_packages.emplace(packageKey(package.m_hwpid, package.m_hwpidVer, osBuild, dpaVer), &package);
+        }
+      }
+    }
+
+    /**
+     * Removes all packages from indexes
+     */
+    void clear() {
+      m_packages.clear();
+      m_osDpaPackages.clear();
+    }
+
+    /**
+     * Finds package by product and numeric OS build and DPA version
+     * @param hwpid HWPID
+     * @param hwpidVer HWPID version
+     * @param osBuild OS build
+     * @param dpaVer DPA version
+     * @return Package, nullptr if not found
+     */
+    const T *find(uint16_t hwpid, uint16_t hwpidVer, uint16_t osBuild, uint16_t dpaVer) const {
+      auto found = m_packages.find(packageKey(hwpid, hwpidVer, osBuild, dpaVer));
+      return found != m_packages.end() ? found->second : nullptr;
+    }
+
+    /**
+     * Finds package by product and OS build and DPA version strings
+     * @param hwpid HWPID
+     * @param hwpidVer HWPID version
+     * @param os OS build string
+     * @param dpa DPA version string
+     * @return Package, nullptr if not found
+     */
+    const T *find(uint16_t hwpid, uint16_t hwpidVer, const std::string &os, const std::string &dpa) const {
+      auto osDpa = m_osDpaPackages.find(osDpaKey(os, dpa));
+      if (osDpa == m_osDpaPackages.end()) {
+        return nullptr;
+      }
+      auto found = osDpa->second.products.find(productKey(hwpid, hwpidVer));
+      return found != osDpa->second.products.end() ? found->second : nullptr;
+    }
+
+    /**
+     * Finds packages by OS build and DPA version strings
+     * @param os OS build string
+     * @param dpa DPA version string
+     * @return Packages in package ID order
+     */
+    const PackageList &find(const std::string &os, const std::string &dpa) const {
+      static const PackageList empty;
+      auto osDpa = m_osDpaPackages.find(osDpaKey(os, dpa));
+      return osDpa != m_osDpaPackages.end() ? osDpa->second.packages : empty;
+    }
+
+    /**
+     * Parses four digit hexadecimal version string, e.g. OS build 08C8 or DPA version 0303
+     * @param str Version string
+     * @param value Parsed version
+     * @return true if string is a valid version, false otherwise
+     */
+    static bool parseVersion(const std::string &str, uint16_t &value) {
+      if (str.length() != 4) {
+        return false;
+      }
+      uint16_t result = 0;
+      for (char c : str) {
+        uint16_t digit = 0;
+        if (c >= '0' && c <= '9') {
+          digit = static_cast<uint16_t>(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+          digit = static_cast<uint16_t>(c - 'a' + 10);
+        } else if (c >= 'A' && c <= 'F') {
+          digit = static_cast<uint16_t>(c - 'A' + 10);
+        } else {
+          return false;
+        }
+        result = static_cast<uint16_t>((result << 4) | digit);
+      }
+      value = result;
+      return true;
+    }
+
+  private:
+    /**
+     * Packages of OS and DPA combination
+     */
+    struct OsDpaPackages {
+      /// packages in package ID order
+      PackageList packages;
+      /// packages by product key
+      std::unordered_map<uint32_t, const T *> products;
+    };
+
+    /**
+     * Returns key of product
+     * @param hwpid HWPID
+     * @param hwpidVer HWPID version
+     * @return Product key
+     */
+    static uint32_t productKey(uint16_t hwpid, uint16_t hwpidVer) {
+      return (static_cast<uint32_t>(hwpid) << 16) | hwpidVer;
+    }
+
+    /**
+     * Returns key of package
+     * @param hwpid HWPID
+     * @param hwpidVer HWPID version
+     * @param osBuild OS build
+     * @param dpaVer DPA version
+     * @return Package key
+     */
+    static uint64_t packageKey(uint16_t hwpid, uint16_t hwpidVer, uint16_t osBuild, uint16_t dpaVer) {
+      return (static_cast<uint64_t>(productKey(hwpid, hwpidVer)) << 32) | (static_cast<uint64_t>(osBuild) << 16) | dpaVer;
+    }
+
+    /**
+     * Returns key of OS and DPA combination
+     * @param os OS build string
+     * @param dpa DPA version string
+     * @return OS and DPA key
+     */
+    static std::string osDpaKey(const std::string &os, const std::string &dpa) {
+      return os + '/' + dpa;
+    }
+
+    /// packages by product, OS build and DPA version
+    std::unordered_map<uint64_t, const T *> m_packages;
+    /// packages by OS and DPA strings
+    std::unordered_map<std::string, OsDpaPackages> m_osDpaPackages;
+  };
+}
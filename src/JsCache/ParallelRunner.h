@@ -0,0 +1,102 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace iqrf {
+
+  /**
+   * Runs independent indexed tasks on bounded number of threads
+   *
+   * Tasks are taken in index order by worker threads, calling thread is one of the workers. Tasks should
+   * store their results by index so that the caller merges them in deterministic order. If tasks fail,
+   * exception of the failed task with the lowest index is rethrown after all workers finish. If a worker
+   * thread cannot be started, already started workers are joined and the error is rethrown.
+   */
+  class ParallelRunner {
+  public:
+    /**
+     * Constructor
+     * @param threads Maximum number of threads, 0 to use number of hardware threads
+     */
+    explicit ParallelRunner(unsigned int threads = 0) {
+      m_threads = threads > 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * Returns maximum number of threads
+     * @return unsigned int Number of threads
+     */
+    unsigned int getThreads() const {
+      return m_threads;
+    }
+
+    /**
+     * Runs tasks and waits for their completion
+     * @param count Number of tasks
+     * @param task Task function called with task index
+     */
+    template <class F>
+    void run(size_t count, F task) const {
+      std::vector<std::exception_ptr> errors(count);
+      std::atomic<size_t> next(0);
+      auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++) {
+          try {
+            task(i);
+          } catch (...) {
+            errors[i] = std::current_exception();
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+      size_t threadCount = std::min<size_t>(m_threads, count);
+      try {
+        for (size_t i = 1; i < threadCount; ++i) {
+          threads.emplace_back(worker);
+        }
+      } catch (...) {
+        // started workers reference local state, stop them taking further tasks and wait for them
+        next = count;
+        for (auto &thread : threads) {
+          thread.join();
+        }
+        throw;
+      }
+      worker();
+      for (auto &thread : threads) {
+        thread.join();
+      }
+
+      for (const auto &error : errors) {
+        if (error) {
+          std::rethrow_exception(error);
+        }
+      }
+    }
+  private:
+    /// Maximum number of threads
+    unsigned int m_threads;
+  };
+}
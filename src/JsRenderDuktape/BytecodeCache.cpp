@@ -0,0 +1,224 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BytecodeCache.h"
+#include "Trace.h"
+#include "duktape.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+namespace iqrf {
+
+	/// Bytecode file header
+	struct BytecodeFileHeader {
+		/// File magic
+		char magic[8];
+		/// Duktape version the bytecode was dumped by
+		uint32_t dukVersion;
+		/// Size of pointer the bytecode was dumped with
+		uint32_t pointerSize;
+		/// Bytecode size
+		uint64_t size;
+		/// Bytecode checksum
+		uint64_t checksum;
+	};
+
+	static const char BYTECODE_MAGIC[8] = {'I', 'Q', 'R', 'F', 'D', 'U', 'K', 'B'};
+
+	void BytecodeCache::setDirectory(const std::string &dir) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		m_dir = dir;
+		if (!m_dir.empty()) {
+			std::error_code ec;
+			std::filesystem::create_directories(m_dir, ec);
+			if (ec) {
+				TRC_WARNING("Failed to create bytecode cache directory: " << PAR(m_dir) << PAR(ec.message()));
+				m_dir.clear();
+			}
+		}
+	}
+
+	std::shared_ptr<const std::vector<char>> BytecodeCache::get(const std::string &hash) {
+		if (!isValidKey(hash)) {
+			return nullptr;
+		}
+		std::lock_guard<std::mutex> lck(m_mtx);
+		auto found = m_bytecode.find(hash);
+		if (found != m_bytecode.end()) {
+			return found->second;
+		}
+		auto bytecode = readFile(hash);
+		if (bytecode != nullptr) {
+			m_bytecode.insert(std::make_pair(hash, bytecode));
+		}
+		return bytecode;
+	}
+
+	void BytecodeCache::put(const std::string &hash, std::vector<char> &&bytecode) {
+		if (!isValidKey(hash) || bytecode.empty()) {
+			return;
+		}
+		auto entry = std::make_shared<const std::vector<char>>(std::move(bytecode));
+		std::lock_guard<std::mutex> lck(m_mtx);
+		m_bytecode[hash] = entry;
+		writeFile(hash, *entry);
+	}
+
+	void BytecodeCache::remove(const std::string &hash) {
+		if (!isValidKey(hash)) {
+			return;
+		}
+		std::lock_guard<std::mutex> lck(m_mtx);
+		m_bytecode.erase(hash);
+		if (!m_dir.empty()) {
+			std::error_code ec;
+			std::filesystem::remove(getFilePath(hash), ec);
+		}
+	}
+
+	void BytecodeCache::clear() {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		m_bytecode.clear();
+	}
+
+	void BytecodeCache::retain(const std::set<std::string> &hashes) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		m_bytecode.clear();
+		if (m_dir.empty()) {
+			return;
+		}
+		std::vector<std::filesystem::path> orphaned;
+		std::error_code ec;
+		for (std::filesystem::directory_iterator itr(m_dir, ec), end; !ec && itr != end; itr.increment(ec)) {
+			const auto &path = itr->path();
+			if (path.extension() != ".dukbc") {
+				continue;
+			}
+			std::string hash = path.stem().string();
+			if (isValidKey(hash) && hashes.count(hash) == 0) {
+				orphaned.push_back(path);
+			}
+		}
+		if (ec) {
+			TRC_WARNING("Failed to list bytecode cache directory: " << PAR(m_dir) << PAR(ec.message()));
+		}
+		for (const auto &path : orphaned) {
+			TRC_DEBUG("Removing orphaned bytecode cache file: " << PAR(path.string()));
+			std::filesystem::remove(path, ec);
+		}
+	}
+
+	bool BytecodeCache::isValidKey(const std::string &hash) {
+		if (hash.empty()) {
+			return false;
+		}
+		return std::all_of(hash.begin(), hash.end(), [](char c) {
+			return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+		});
+	}
+
+	std::string BytecodeCache::getFilePath(const std::string &hash) const {
+		return m_dir + '/' + hash + ".dukbc";
+	}
+
+	std::shared_ptr<const std::vector<char>> BytecodeCache::readFile(const std::string &hash) const {
+		if (m_dir.empty()) {
+			return nullptr;
+		}
+		std::ifstream file(getFilePath(hash), std::ios::binary);
+		if (!file.is_open()) {
+			return nullptr;
+		}
+		BytecodeFileHeader header;
+		if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))) {
+			return nullptr;
+		}
+		// Duktape does not validate bytecode, anything dumped by other build or damaged is rejected here
+		if (!std::equal(std::begin(BYTECODE_MAGIC), std::end(BYTECODE_MAGIC), header.magic)
+			|| header.dukVersion != DUK_VERSION || header.pointerSize != sizeof(void *)) {
+			return nullptr;
+		}
+		// size is checked against file length before allocating, damaged header must not trigger huge allocation
+		std::streampos start = file.tellg();
+		file.seekg(0, std::ios::end);
+		std::streampos end = file.tellg();
+		if (start < 0 || end < start || header.size != static_cast<uint64_t>(end - start)) {
+			TRC_WARNING("Bytecode cache file size mismatch: " << PAR(hash) << PAR(header.size));
+			return nullptr;
+		}
+		file.seekg(start);
+		std::vector<char> bytecode(header.size);
+		if (!file.read(bytecode.data(), bytecode.size())) {
+			return nullptr;
+		}
+		if (checksum(bytecode) != header.checksum) {
+			return nullptr;
+		}
+		return std::make_shared<const std::vector<char>>(std::move(bytecode));
+	}
+
+	void BytecodeCache::writeFile(const std::string &hash, const std::vector<char> &bytecode) const {
+		if (m_dir.empty()) {
+			return;
+		}
+		BytecodeFileHeader header;
+		std::copy(std::begin(BYTECODE_MAGIC), std::end(BYTECODE_MAGIC), header.magic);
+		header.dukVersion = DUK_VERSION;
+		header.pointerSize = sizeof(void *);
+		header.size = bytecode.size();
+		header.checksum = checksum(bytecode);
+
+		// write to temporary file first, so that readers never see partially written bytecode
+		std::string path = getFilePath(hash);
+		std::string tmpPath = path + ".tmp";
+		{
+			std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+			if (!file.is_open()) {
+				TRC_WARNING("Failed to open bytecode cache file: " << PAR(tmpPath));
+				return;
+			}
+			file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+			file.write(bytecode.data(), bytecode.size());
+			if (!file) {
+				TRC_WARNING("Failed to write bytecode cache file: " << PAR(tmpPath));
+				file.close();
+				std::error_code ec;
+				std::filesystem::remove(tmpPath, ec);
+				return;
+			}
+		}
+		std::error_code ec;
+		std::filesystem::rename(tmpPath, path, ec);
+		if (ec) {
+			TRC_WARNING("Failed to rename bytecode cache file: " << PAR(path) << PAR(ec.message()));
+			std::filesystem::remove(tmpPath, ec);
+		}
+	}
+
+	uint64_t BytecodeCache::checksum(const std::vector<char> &bytecode) {
+		uint64_t hash = 14695981039346656037ULL;
+		for (char c : bytecode) {
+			hash ^= static_cast<unsigned char>(c);
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+}
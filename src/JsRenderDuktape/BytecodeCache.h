@@ -0,0 +1,115 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace iqrf {
+	/**
+	 * Cache of compiled driver code
+	 *
+	 * Bytecode is keyed by hash of the driver code it was compiled from. Entries are kept in memory
+	 * and persisted in cache directory, so unchanged driver code is not compiled again after restart.
+	 */
+	class BytecodeCache {
+	public:
+		/**
+		 * Sets directory to persist bytecode in
+		 * @param dir Cache directory, empty to keep bytecode in memory only
+		 */
+		void setDirectory(const std::string &dir);
+
+		/**
+		 * Returns bytecode of driver code
+		 * @param hash Driver code hash
+		 * @return Bytecode, nullptr if not cached
+		 */
+		std::shared_ptr<const std::vector<char>> get(const std::string &hash);
+
+		/**
+		 * Stores bytecode of driver code
+		 * @param hash Driver code hash
+		 * @param bytecode Bytecode
+		 */
+		void put(const std::string &hash, std::vector<char> &&bytecode);
+
+		/**
+		 * Removes bytecode of driver code from memory and cache directory
+		 * @param hash Driver code hash
+		 */
+		void remove(const std::string &hash);
+
+		/**
+		 * Releases bytecode kept in memory
+		 */
+		void clear();
+
+		/**
+		 * Releases bytecode kept in memory and removes files of driver code not listed from cache directory
+		 * @param hashes Hashes of driver code to keep files of
+		 */
+		void retain(const std::set<std::string> &hashes);
+
+		/**
+		 * Checks if hash can be used as cache key
+		 * @param hash Driver code hash
+		 * @return true if hash is a non-empty hexadecimal string, false otherwise
+		 */
+		static bool isValidKey(const std::string &hash);
+	private:
+		/**
+		 * Returns path of bytecode file
+		 * @param hash Driver code hash
+		 * @return Bytecode file path
+		 */
+		std::string getFilePath(const std::string &hash) const;
+
+		/**
+		 * Reads bytecode file
+		 * @param hash Driver code hash
+		 * @return Bytecode, nullptr if file does not exist or is not valid
+		 */
+		std::shared_ptr<const std::vector<char>> readFile(const std::string &hash) const;
+
+		/**
+		 * Writes bytecode file
+		 * @param hash Driver code hash
+		 * @param bytecode Bytecode
+		 */
+		void writeFile(const std::string &hash, const std::vector<char> &bytecode) const;
+
+		/**
+		 * Computes bytecode checksum
+		 * @param bytecode Bytecode
+		 * @return FNV-1a checksum
+		 */
+		static uint64_t checksum(const std::vector<char> &bytecode);
+
+		/// Cache mutex
+		std::mutex m_mtx;
+		/// Cache directory
+		std::string m_dir;
+		/// Bytecode by driver code hash
+		std::map<std::string, std::shared_ptr<const std::vector<char>>> m_bytecode;
+	};
+}
@@ -17,10 +17,36 @@
 
 #include "Context.h"
 
+#include <cmath>
+
 namespace iqrf {
 
-	Context::Context() {
-		m_ctx = duk_create_heap_default();
+	/**
+	 * Enables heap limit for the duration of a protected call
+	 */
+	class HeapLimitGuard {
+	public:
+		/**
+		 * Constructor
+		 * @param allocator Heap allocator
+		 */
+		explicit HeapLimitGuard(HeapAllocator &allocator) : m_allocator(allocator) {
+			m_allocator.enableLimit(true);
+		}
+
+		/**
+		 * Destructor
+		 */
+		~HeapLimitGuard() {
+			m_allocator.enableLimit(false);
+		}
+	private:
+		/// Heap allocator
+		HeapAllocator &m_allocator;
+	};
+
+	Context::Context(size_t heapLimit) : m_allocator(heapLimit) {
+		m_ctx = duk_create_heap(HeapAllocator::allocFunction, HeapAllocator::reallocFunction, HeapAllocator::freeFunction, &m_allocator, nullptr);
 		if (!m_ctx) {
 			std::cerr << "Failed to create a Duktape heap." << std::endl;
 			throw std::logic_error("Failed to create a Duktape heap.\n");
@@ -32,14 +58,87 @@ namespace iqrf {
 		duk_destroy_heap(m_ctx);
 	}
 
-	void Context::loadCode(const std::string &js) {
-		duk_push_string(m_ctx, js.c_str());
-		if (duk_peval(m_ctx) != 0) {
+	size_t Context::getHeapSize() const {
+		return m_allocator.getStats().liveBytes;
+	}
+
+	JsEngineContext::MemoryStats Context::getMemoryStats() const {
+		auto allocatorStats = m_allocator.getStats();
+		MemoryStats stats;
+		stats.liveBytes = allocatorStats.liveBytes;
+		stats.peakBytes = allocatorStats.peakBytes;
+		stats.reservedBytes = allocatorStats.reservedBytes;
+		stats.limitBytes = allocatorStats.limitBytes;
+		stats.limitHits = allocatorStats.limitHits;
+		return stats;
+	}
+
+	void Context::loadCode(const std::string &js, std::vector<char> *bytecode) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		duk_push_lstring(m_ctx, js.c_str(), js.length());
+		duk_push_string(m_ctx, "drivers");
+		int result = 0;
+		{
+			HeapLimitGuard limit(m_allocator);
+			result = duk_pcompile(m_ctx, 0);
+		}
+		if (result != 0) {
 			std::string errstr = duk_safe_to_string(m_ctx, -1);
+			duk_pop(m_ctx);
+			std::cerr << "Error in driver scripts: " << errstr << std::endl;
+			throw std::logic_error(errstr);
+		}
+		if (bytecode != nullptr) {
+			duk_dup(m_ctx, -1);
+			duk_dump_function(m_ctx);
+			duk_size_t size = 0;
+			const char *buffer = static_cast<const char *>(duk_get_buffer(m_ctx, -1, &size));
+			bytecode->assign(buffer, buffer + size);
+			duk_pop(m_ctx);
+		}
+		runCode();
+	}
+
+	void Context::loadBytecode(const std::vector<char> &bytecode) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		void *buffer = duk_push_fixed_buffer(m_ctx, bytecode.size());
+		std::copy(bytecode.begin(), bytecode.end(), static_cast<char *>(buffer));
+		// bytecode is not validated by Duktape, callers are responsible for its integrity
+		auto load = [](duk_context *ctx, void *udata) -> duk_ret_t {
+			(void)udata;
+			duk_load_function(ctx);
+			return 1;
+		};
+		int result = 0;
+		{
+			HeapLimitGuard limit(m_allocator);
+			result = duk_safe_call(m_ctx, load, nullptr, 1, 1);
+		}
+		if (result != 0) {
+			std::string errstr = duk_safe_to_string(m_ctx, -1);
+			duk_pop(m_ctx);
+			throw std::logic_error("Failed to load driver bytecode: " + errstr);
+		}
+		runCode();
+	}
+
+	void Context::runCode() {
+		// global code expects global object as this binding, same as duk_peval
+		duk_push_global_object(m_ctx);
+		int result = 0;
+		{
+			HeapLimitGuard limit(m_allocator);
+			result = duk_pcall_method(m_ctx, 0);
+		}
+		if (result != 0) {
+			std::string errstr = duk_safe_to_string(m_ctx, -1);
+			duk_pop(m_ctx);
 			std::cerr << "Error in driver scripts: " << errstr << std::endl;
 			throw std::logic_error(errstr);
 		}
 		duk_pop(m_ctx);
+		// functions resolved from previous code are stale
+		m_resolvedHandles.clear();
 		m_initialized = true;
 	}
 
@@ -73,7 +172,7 @@ namespace iqrf {
 		}
 	}
 
-	void Context::callFunction(const std::string &name, const std::string &params, std::string &ret) {
+	void Context::pushFunction(const std::string &name) {
 		auto pos = name.find_last_of('.');
 		if (pos == std::string::npos) {
 			throw std::logic_error("Invalid namespace and function format: " + name);
@@ -81,11 +180,22 @@ namespace iqrf {
 		std::string ns = name.substr(0, pos);
 		std::string object = name.substr(pos + 1, name.length() -1);
 		findNamespaceObject(ns, object);
+		// keep the function only, drop namespace objects beneath it
+		for (int i = 1; i < m_relativeStack; ++i) {
+			duk_remove(m_ctx, -2);
+		}
+		m_relativeStack = 0;
+	}
 
+	void Context::callPushedFunction(const std::string &params, std::string &ret) {
 		duk_push_string(m_ctx, params.c_str());
 		duk_json_decode(m_ctx, -1);
 
-		int result = duk_pcall(m_ctx, 1);
+		int result = 0;
+		{
+			HeapLimitGuard limit(m_allocator);
+			result = duk_pcall(m_ctx, 1);
+		}
 		std::string error;
 		if (result != 0) {
 			duk_dup(m_ctx, -1);
@@ -94,11 +204,249 @@ namespace iqrf {
 		}
 
 		ret = duk_json_encode(m_ctx, -1);
+		duk_pop(m_ctx);
 		if (result != 0) {
-			duk_pop_n(m_ctx, m_relativeStack);
 			throw std::logic_error(error);
 		}
+	}
+
+	void Context::callFunction(const std::string &name, const std::string &params, std::string &ret) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		pushFunction(name);
+		callPushedFunction(params, ret);
+	}
+
+	void Context::callFunction(int handle, const std::string &name, const std::string &params, std::string &ret) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		pushFunction(handle, name);
+		callPushedFunction(params, ret);
+	}
+
+	void Context::callFunction(int handle, const std::string &name, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		pushFunction(handle, name);
+		callPushedFunction(params, ret, allocator);
+	}
+
+	void Context::pushFunction(int handle, const std::string &name) {
+		if (handle < 0) {
+			throw std::logic_error("Invalid function handle: " + std::to_string(handle));
+		}
+		size_t index = static_cast<size_t>(handle);
+		duk_push_heap_stash(m_ctx);
+		if (index < m_resolvedHandles.size() && m_resolvedHandles[index]) {
+			duk_get_prop_index(m_ctx, -1, static_cast<duk_uarridx_t>(index));
+			duk_remove(m_ctx, -2);
+			return;
+		}
+		duk_pop(m_ctx);
+		pushFunction(name);
+		duk_push_heap_stash(m_ctx);
+		duk_dup(m_ctx, -2);
+		duk_put_prop_index(m_ctx, -2, static_cast<duk_uarridx_t>(index));
+		duk_pop(m_ctx);
+		if (index >= m_resolvedHandles.size()) {
+			m_resolvedHandles.resize(index + 1, false);
+		}
+		m_resolvedHandles[index] = true;
+	}
 
-		duk_pop_n(m_ctx, m_relativeStack);
+	void Context::callPushedFunction(const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) {
+		// stack has to be left as it was found, global object is expected on top by function lookup
+		duk_idx_t top = duk_get_top(m_ctx) - 1;
+		try {
+			pushValue(params, 0);
+			int result = 0;
+			{
+				HeapLimitGuard limit(m_allocator);
+				result = duk_pcall(m_ctx, 1);
+			}
+			if (result != 0) {
+				throw std::logic_error(duk_safe_to_string(m_ctx, -1));
+			}
+			if (!getValue(-1, ret, allocator, 0)) {
+				ret.SetNull();
+			}
+		} catch (...) {
+			duk_set_top(m_ctx, top);
+			throw;
+		}
+		duk_pop(m_ctx);
+	}
+
+	void Context::pushValue(const rapidjson::Value &value, int depth) {
+		if (depth > MAX_VALUE_DEPTH || !duk_check_stack(m_ctx, 2)) {
+			throw std::logic_error("Driver function parameters nested too deep.");
+		}
+		switch (value.GetType()) {
+			case rapidjson::kNullType:
+				duk_push_null(m_ctx);
+				break;
+			case rapidjson::kFalseType:
+				duk_push_false(m_ctx);
+				break;
+			case rapidjson::kTrueType:
+				duk_push_true(m_ctx);
+				break;
+			case rapidjson::kNumberType:
+				duk_push_number(m_ctx, value.GetDouble());
+				break;
+			case rapidjson::kStringType:
+				duk_push_lstring(m_ctx, value.GetString(), value.GetStringLength());
+				break;
+			case rapidjson::kArrayType: {
+				duk_push_array(m_ctx);
+				duk_uarridx_t index = 0;
+				for (const auto &item : value.GetArray()) {
+					pushValue(item, depth + 1);
+					duk_put_prop_index(m_ctx, -2, index++);
+				}
+				break;
+			}
+			case rapidjson::kObjectType:
+				duk_push_object(m_ctx);
+				for (const auto &member : value.GetObject()) {
+					pushValue(member.value, depth + 1);
+					duk_put_prop_lstring(m_ctx, -2, member.name.GetString(), member.name.GetStringLength());
+				}
+				break;
+		}
+	}
+
+	bool Context::getValue(duk_idx_t index, rapidjson::Value &value, rapidjson::Document::AllocatorType &allocator, int depth) {
+		if (depth > MAX_VALUE_DEPTH || !duk_check_stack(m_ctx, 4)) {
+			throw std::logic_error("Driver function result nested too deep.");
+		}
+		index = duk_normalize_index(m_ctx, index);
+		switch (duk_get_type(m_ctx, index)) {
+			case DUK_TYPE_NULL:
+				value.SetNull();
+				return true;
+			case DUK_TYPE_BOOLEAN:
+				value.SetBool(duk_get_boolean(m_ctx, index));
+				return true;
+			case DUK_TYPE_NUMBER: {
+				double number = duk_get_number(m_ctx, index);
+				// JSON text of integral numbers has no fraction and parses to integer values
+				if (!std::isfinite(number)) {
+					value.SetNull();
+				} else if (std::trunc(number) == number && std::fabs(number) < 9007199254740992.0) {
+					value.SetInt64(static_cast<int64_t>(number));
+				} else {
+					value.SetDouble(number);
+				}
+				return true;
+			}
+			case DUK_TYPE_STRING: {
+				duk_size_t length = 0;
+				const char *str = duk_get_lstring(m_ctx, index, &length);
+				value.SetString(str, static_cast<rapidjson::SizeType>(length), allocator);
+				return true;
+			}
+			case DUK_TYPE_OBJECT:
+				break;
+			default:
+				return false;
+		}
+		if (duk_is_function(m_ctx, index)) {
+			return false;
+		}
+		// safe call operations share stack frame of the caller, their argument is on the stack top
+		// objects with custom serialization are rare in drivers, let Duktape serialize them
+		auto encode = [](duk_context *ctx, void *udata) -> duk_ret_t {
+			if (!duk_is_buffer_data(ctx, -1) && !duk_has_prop_string(ctx, -1, "toJSON")) {
+				return 0;
+			}
+			*static_cast<bool *>(udata) = true;
+			duk_json_encode(ctx, -1);
+			return 1;
+		};
+		bool custom = false;
+		duk_dup(m_ctx, index);
+		safeCall(encode, &custom, 1, 1);
+		if (custom) {
+			const char *json = duk_get_string(m_ctx, -1);
+			if (json == nullptr) {
+				duk_pop(m_ctx);
+				return false;
+			}
+			rapidjson::Document doc(&allocator);
+			doc.Parse(json);
+			duk_pop(m_ctx);
+			value = static_cast<rapidjson::Value &>(doc);
+			return true;
+		}
+		duk_pop(m_ctx);
+		if (duk_is_array(m_ctx, index)) {
+			auto getLength = [](duk_context *ctx, void *udata) -> duk_ret_t {
+				*static_cast<duk_size_t *>(udata) = duk_get_length(ctx, -1);
+				return 0;
+			};
+			auto getItem = [](duk_context *ctx, void *udata) -> duk_ret_t {
+				duk_get_prop_index(ctx, -1, *static_cast<duk_uarridx_t *>(udata));
+				return 1;
+			};
+			duk_size_t length = 0;
+			duk_dup(m_ctx, index);
+			safeCall(getLength, &length, 1, 1);
+			duk_pop(m_ctx);
+			value.SetArray();
+			value.Reserve(static_cast<rapidjson::SizeType>(length), allocator);
+			for (duk_uarridx_t i = 0; i < length; ++i) {
+				duk_dup(m_ctx, index);
+				safeCall(getItem, &i, 1, 1);
+				rapidjson::Value item;
+				if (!getValue(-1, item, allocator, depth + 1)) {
+					item.SetNull();
+				}
+				duk_pop(m_ctx);
+				value.PushBack(item, allocator);
+			}
+			return true;
+		}
+		auto enumerate = [](duk_context *ctx, void *udata) -> duk_ret_t {
+			(void)udata;
+			duk_enum(ctx, -1, DUK_ENUM_OWN_PROPERTIES_ONLY);
+			return 1;
+		};
+		// key and value are left undefined when enumeration is finished
+		auto next = [](duk_context *ctx, void *udata) -> duk_ret_t {
+			(void)udata;
+			return duk_next(ctx, -1, 1) ? 2 : 0;
+		};
+		value.SetObject();
+		duk_dup(m_ctx, index);
+		safeCall(enumerate, nullptr, 1, 1);
+		while (true) {
+			duk_dup(m_ctx, -1);
+			safeCall(next, nullptr, 1, 2);
+			if (duk_is_undefined(m_ctx, -2)) {
+				duk_pop_2(m_ctx);
+				break;
+			}
+			rapidjson::Value item;
+			if (getValue(-1, item, allocator, depth + 1)) {
+				duk_size_t length = 0;
+				const char *key = duk_get_lstring(m_ctx, -2, &length);
+				value.AddMember(rapidjson::Value(key, static_cast<rapidjson::SizeType>(length), allocator), item, allocator);
+			}
+			duk_pop_2(m_ctx);
+		}
+		duk_pop(m_ctx);
+		return true;
+	}
+
+	void Context::safeCall(duk_safe_call_function func, void *udata, duk_idx_t nargs, duk_idx_t nrets) {
+		int result = 0;
+		{
+			HeapLimitGuard limit(m_allocator);
+			result = duk_safe_call(m_ctx, func, udata, nargs, nrets);
+		}
+		if (result != 0) {
+			// error is the first of returned values
+			std::string errstr = duk_safe_to_string(m_ctx, -nrets);
+			duk_pop_n(m_ctx, nrets);
+			throw std::logic_error(errstr);
+		}
 	}
 }
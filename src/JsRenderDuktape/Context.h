@@ -18,35 +18,63 @@
 
 #include "duktape.h"
 #include "DpaPerExceptions.h"
+#include "HeapAllocator.h"
+#include "JsEngineContext.h"
 #include "StringUtils.h"
 
+#include "rapidjson/document.h"
+
 #include <algorithm>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
 
 namespace iqrf {
 	/**
-	 * Driver context
+	 * Duktape driver context
+	 *
+	 * Duktape heap is not thread safe, calls to the same context are serialized by context mutex.
+	 * Different contexts can be used concurrently.
 	 */
-	class Context {
+	class Context : public JsEngineContext {
 	public:
 		/**
 		 * Constructor
+		 * @param heapLimit Limit of memory allocated by running driver code in bytes, 0 for unlimited
 		 */
-		Context();
+		explicit Context(size_t heapLimit = 0);
 
 		/**
 		 * Destructor
 		 */
-		virtual ~Context();
+		~Context() override;
 
 		/**
 		 * Loads code to duktape context heap
 		 * @param js JavaScript code to load
+		 * @param bytecode If not null, compiled code bytecode is stored here
+		 */
+		void loadCode(const std::string &js, std::vector<char> *bytecode = nullptr) override;
+
+		/**
+		 * Loads code compiled by loadCode to duktape context heap
+		 * @param bytecode Compiled code bytecode
+		 */
+		void loadBytecode(const std::vector<char> &bytecode) override;
+
+		/**
+		 * Returns memory allocated by context heap
+		 * @return Allocated bytes
 		 */
-		void loadCode(const std::string &js);
+		size_t getHeapSize() const override;
+
+		/**
+		 * Returns memory statistics of context heap
+		 * @return Memory statistics
+		 */
+		MemoryStats getMemoryStats() const override;
 
 		/**
 		 * Call context function
@@ -54,8 +82,38 @@ namespace iqrf {
 		 * @param params Function parameters
 		 * @param ret Return value to store
 		 */
-		void callFunction(const std::string &name, const std::string &params, std::string &ret);
+		void callFunction(const std::string &name, const std::string &params, std::string &ret) override;
+
+		/**
+		 * Call context function by handle
+		 *
+		 * Function is looked up by name on the first call only, the resolved function is kept in heap stash
+		 * indexed by handle.
+		 * @param handle Function handle, small non-negative integer unique for function name
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 */
+		void callFunction(int handle, const std::string &name, const std::string &params, std::string &ret) override;
+
+		/**
+		 * Call context function by handle, parameters and result are passed as values without JSON text
+		 *
+		 * Result is built the way JSON.stringify would serialize it, i.e. undefined and function members
+		 * are omitted, non-finite numbers are stored as null and integral numbers as integers.
+		 * @param handle Function handle, small non-negative integer unique for function name
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @param allocator Allocator of return value
+		 */
+		void callFunction(int handle, const std::string &name, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) override;
 	private:
+		/**
+		 * Runs compiled code on top of the stack in global scope
+		 */
+		void runCode();
+
 		/**
 		 * Attempts to find called function in context heap
 		 * @param ns namespace
@@ -63,11 +121,77 @@ namespace iqrf {
 		 */
 		void findNamespaceObject(const std::string &ns, const std::string &object);
 
+		/**
+		 * Finds function by name and pushes it to the top of the stack
+		 * @param name Function name
+		 */
+		void pushFunction(const std::string &name);
+
+		/**
+		 * Pushes function stored in heap stash by handle, function is found by name and stored on the first call
+		 * @param handle Function handle
+		 * @param name Function name
+		 */
+		void pushFunction(int handle, const std::string &name);
+
+		/**
+		 * Calls function on top of the stack and pops it
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 */
+		void callPushedFunction(const std::string &params, std::string &ret);
+
+		/**
+		 * Calls function on top of the stack and pops it
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @param allocator Allocator of return value
+		 */
+		void callPushedFunction(const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator);
+
+		/**
+		 * Pushes value to the top of the stack
+		 * @param value Value to push
+		 * @param depth Nesting depth of value
+		 */
+		void pushValue(const rapidjson::Value &value, int depth);
+
+		/**
+		 * Converts stack item to value
+		 * @param index Stack index of item
+		 * @param value Value to store
+		 * @param allocator Allocator of value
+		 * @param depth Nesting depth of item
+		 * @return false if item has no JSON representation, i.e. it is undefined or function
+		 */
+		bool getValue(duk_idx_t index, rapidjson::Value &value, rapidjson::Document::AllocatorType &allocator, int depth);
+
+		/**
+		 * Runs Duktape operation in protected call
+		 *
+		 * Property getters, Proxy traps and toJSON methods of driver results run driver code, errors thrown
+		 * by them outside of protected call are fatal for the heap.
+		 * @param func Operation
+		 * @param udata Operation data
+		 * @param nargs Number of arguments taken from the stack
+		 * @param nrets Number of values left on the stack, at least one to report error
+		 */
+		void safeCall(duk_safe_call_function func, void *udata, duk_idx_t nargs, duk_idx_t nrets);
+
+		/// Maximal nesting depth of values passed to and from context, same as Duktape JSON limit
+		static const int MAX_VALUE_DEPTH = 1000;
+
+		/// Context heap mutex
+		std::mutex m_mtx;
+		/// Context heap allocator
+		HeapAllocator m_allocator;
 		/// Driver context initialized
 		bool m_initialized = false;
 		/// Context heap
 		duk_context *m_ctx = nullptr;
 		/// Duktape stack item
 		int m_relativeStack = 0;
+		/// Function handles resolved and stored in heap stash
+		std::vector<bool> m_resolvedHandles;
 	};
 }
@@ -0,0 +1,61 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FunctionProfiler.h"
+
+#include <algorithm>
+
+namespace iqrf {
+
+	void FunctionProfiler::enable(bool enabled) {
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	bool FunctionProfiler::isEnabled() const {
+		return m_enabled.load(std::memory_order_relaxed);
+	}
+
+	void FunctionProfiler::record(int contextId, int functionHandle, std::chrono::nanoseconds duration, int64_t heapGrowth, bool failed) {
+		uint64_t time = static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0));
+		std::lock_guard<std::mutex> lck(m_mtx);
+		auto &profile = m_profile[contextId][functionHandle];
+		if (profile.calls == 0 || heapGrowth > profile.maxHeapGrowthBytes) {
+			profile.maxHeapGrowthBytes = heapGrowth;
+		}
+		++profile.calls;
+		if (failed) {
+			++profile.errors;
+		}
+		profile.totalTimeNs += time;
+		profile.maxTimeNs = std::max(profile.maxTimeNs, time);
+		profile.heapGrowthBytes += heapGrowth;
+	}
+
+	FunctionProfiler::Profile FunctionProfiler::getProfile() const {
+		Profile result;
+		std::lock_guard<std::mutex> lck(m_mtx);
+		for (const auto &[contextId, functions] : m_profile) {
+			result[contextId].insert(functions.begin(), functions.end());
+		}
+		return result;
+	}
+
+	void FunctionProfiler::reset() {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		m_profile.clear();
+	}
+}
@@ -0,0 +1,79 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "IJsRenderService.h"
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace iqrf {
+	/**
+	 * Profiler of driver function calls
+	 *
+	 * Calls are recorded by context and function handle. Disabled profiler costs a single atomic load per call.
+	 */
+	class FunctionProfiler {
+	public:
+		/// Function profiles by context ID and function handle
+		typedef std::map<int, std::map<int, IJsRenderService::FunctionProfile>> Profile;
+
+		/**
+		 * Enables or disables recording of calls
+		 * @param enabled Recording enabled
+		 */
+		void enable(bool enabled);
+
+		/**
+		 * Checks if recording of calls is enabled
+		 * @return true if recording is enabled, false otherwise
+		 */
+		bool isEnabled() const;
+
+		/**
+		 * Records function call
+		 * @param contextId Context ID
+		 * @param functionHandle Function handle
+		 * @param duration Execution time
+		 * @param heapGrowth Heap growth in bytes
+		 * @param failed Call failed
+		 */
+		void record(int contextId, int functionHandle, std::chrono::nanoseconds duration, int64_t heapGrowth, bool failed);
+
+		/**
+		 * Returns recorded profile
+		 * @return Function profiles by context ID and function handle
+		 */
+		Profile getProfile() const;
+
+		/**
+		 * Clears recorded profile
+		 */
+		void reset();
+	private:
+		/// Recording enabled
+		std::atomic<bool> m_enabled{false};
+		/// Profile mutex
+		mutable std::mutex m_mtx;
+		/// Function profiles by context ID and function handle
+		std::unordered_map<int, std::unordered_map<int, IJsRenderService::FunctionProfile>> m_profile;
+	};
+}
@@ -0,0 +1,194 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HeapAllocator.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+
+namespace iqrf {
+
+	HeapAllocator::HeapAllocator(size_t limit) : m_limit(limit) {}
+
+	HeapAllocator::~HeapAllocator() {
+		for (void *slab : m_slabs) {
+			std::free(slab);
+		}
+	}
+
+	void HeapAllocator::enableLimit(bool enabled) {
+		m_limitEnabled = enabled;
+	}
+
+	HeapAllocator::Stats HeapAllocator::getStats() const {
+		Stats stats;
+		stats.liveBytes = m_liveBytes.load(std::memory_order_relaxed);
+		stats.peakBytes = m_peakBytes.load(std::memory_order_relaxed);
+		stats.reservedBytes = m_reservedBytes.load(std::memory_order_relaxed);
+		stats.limitBytes = m_limit;
+		stats.limitHits = m_limitHits.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void *HeapAllocator::allocFunction(void *udata, size_t size) {
+		return static_cast<HeapAllocator *>(udata)->allocate(size);
+	}
+
+	void *HeapAllocator::reallocFunction(void *udata, void *ptr, size_t size) {
+		return static_cast<HeapAllocator *>(udata)->reallocate(ptr, size);
+	}
+
+	void HeapAllocator::freeFunction(void *udata, void *ptr) {
+		static_cast<HeapAllocator *>(udata)->release(ptr);
+	}
+
+	void *HeapAllocator::allocate(size_t size) {
+		if (!withinLimit(size)) {
+			return nullptr;
+		}
+		AllocHeader *header = takeBlock(size);
+		if (header == nullptr) {
+			return nullptr;
+		}
+		account(size, 0);
+		return header + 1;
+	}
+
+	void *HeapAllocator::reallocate(void *ptr, size_t size) {
+		if (ptr == nullptr) {
+			return allocate(size);
+		}
+		if (size == 0) {
+			release(ptr);
+			return nullptr;
+		}
+		auto *header = static_cast<AllocHeader *>(ptr) - 1;
+		size_t oldSize = header->size;
+		if (size > oldSize && !withinLimit(size - oldSize)) {
+			return nullptr;
+		}
+		size_t oldClass = sizeClass(oldSize);
+		size_t newClass = sizeClass(size);
+		if (oldClass == newClass && oldClass < CLASS_COUNT) {
+			// block is large enough
+			header->size = size;
+		} else if (oldClass == CLASS_COUNT && newClass == CLASS_COUNT) {
+			header = static_cast<AllocHeader *>(std::realloc(header, sizeof(AllocHeader) + size));
+			if (header == nullptr) {
+				return nullptr;
+			}
+			header->size = size;
+			m_reservedBytes += size;
+			m_reservedBytes -= oldSize;
+		} else {
+			AllocHeader *moved = takeBlock(size);
+			if (moved == nullptr) {
+				return nullptr;
+			}
+			std::memcpy(moved + 1, header + 1, std::min(oldSize, size));
+			returnBlock(header);
+			header = moved;
+		}
+		account(size, oldSize);
+		return header + 1;
+	}
+
+	void HeapAllocator::release(void *ptr) {
+		if (ptr == nullptr) {
+			return;
+		}
+		auto *header = static_cast<AllocHeader *>(ptr) - 1;
+		size_t size = header->size;
+		returnBlock(header);
+		account(0, size);
+	}
+
+	HeapAllocator::AllocHeader *HeapAllocator::takeBlock(size_t size) {
+		size_t cls = sizeClass(size);
+		AllocHeader *header = nullptr;
+		if (cls == CLASS_COUNT) {
+			header = static_cast<AllocHeader *>(std::malloc(sizeof(AllocHeader) + size));
+			if (header == nullptr) {
+				return nullptr;
+			}
+			m_reservedBytes += sizeof(AllocHeader) + size;
+		} else if (m_freeBlocks[cls] != nullptr) {
+			FreeBlock *block = m_freeBlocks[cls];
+			m_freeBlocks[cls] = block->next;
+			header = reinterpret_cast<AllocHeader *>(block);
+		} else {
+			if (m_slabCursor[cls] == nullptr || m_slabCursor[cls] + CLASS_SIZES[cls] > m_slabEnd[cls]) {
+				// called from Duktape C code, exceptions must not escape
+				void *slab = std::malloc(SLAB_SIZE);
+				if (slab == nullptr) {
+					return nullptr;
+				}
+				try {
+					m_slabs.push_back(slab);
+				} catch (const std::exception &) {
+					std::free(slab);
+					return nullptr;
+				}
+				m_slabCursor[cls] = static_cast<char *>(slab);
+				m_slabEnd[cls] = m_slabCursor[cls] + SLAB_SIZE;
+				m_reservedBytes += SLAB_SIZE;
+			}
+			header = reinterpret_cast<AllocHeader *>(m_slabCursor[cls]);
+			m_slabCursor[cls] += CLASS_SIZES[cls];
+		}
+		header->size = size;
+		return header;
+	}
+
+	void HeapAllocator::returnBlock(AllocHeader *header) {
+		size_t cls = sizeClass(header->size);
+		if (cls == CLASS_COUNT) {
+			m_reservedBytes -= sizeof(AllocHeader) + header->size;
+			std::free(header);
+			return;
+		}
+		auto *block = reinterpret_cast<FreeBlock *>(header);
+		block->next = m_freeBlocks[cls];
+		m_freeBlocks[cls] = block;
+	}
+
+	bool HeapAllocator::withinLimit(size_t growth) {
+		if (!m_limitEnabled || m_limit == 0 || m_liveBytes.load(std::memory_order_relaxed) + growth <= m_limit) {
+			return true;
+		}
+		// Duktape runs garbage collection and retries, allocation fails in driver code if it does not help
+		m_limitHits.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	void HeapAllocator::account(size_t added, size_t removed) {
+		// single writer, heap calls are serialized
+		size_t live = m_liveBytes.load(std::memory_order_relaxed) + added - removed;
+		m_liveBytes.store(live, std::memory_order_relaxed);
+		if (live > m_peakBytes.load(std::memory_order_relaxed)) {
+			m_peakBytes.store(live, std::memory_order_relaxed);
+		}
+	}
+
+	size_t HeapAllocator::sizeClass(size_t size) {
+		size_t blockSize = sizeof(AllocHeader) + size;
+		auto found = std::lower_bound(CLASS_SIZES.begin(), CLASS_SIZES.end(), blockSize);
+		return static_cast<size_t>(found - CLASS_SIZES.begin());
+	}
+}
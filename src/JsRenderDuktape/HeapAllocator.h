@@ -0,0 +1,202 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace iqrf {
+	/**
+	 * Memory allocator of a single Duktape heap
+	 *
+	 * Small allocations are served from per heap pools of fixed size blocks, so short lived Duktape objects
+	 * reuse memory of their heap instead of fragmenting the process heap. Pool memory is returned when the heap
+	 * is destroyed. Large allocations are passed to malloc.
+	 *
+	 * Allocator is not thread safe, Duktape heap calls are serialized by context. Statistics can be read
+	 * from any thread.
+	 */
+	class HeapAllocator {
+	public:
+		/**
+		 * Memory statistics
+		 */
+		struct Stats {
+			/// Memory requested by heap and not freed yet
+			size_t liveBytes = 0;
+			/// Maximal live memory
+			size_t peakBytes = 0;
+			/// Memory taken from process heap, pools and large allocations including headers
+			size_t reservedBytes = 0;
+			/// Live memory limit, 0 if unlimited
+			size_t limitBytes = 0;
+			/// Number of allocations refused by limit
+			size_t limitHits = 0;
+		};
+
+		/**
+		 * Constructor
+		 * @param limit Live memory limit in bytes enforced while limit is enabled, 0 for unlimited
+		 */
+		explicit HeapAllocator(size_t limit = 0);
+
+		/**
+		 * Destructor, releases pools
+		 */
+		~HeapAllocator();
+
+		HeapAllocator(const HeapAllocator &) = delete;
+		HeapAllocator &operator=(const HeapAllocator &) = delete;
+
+		/**
+		 * Enables or disables live memory limit
+		 *
+		 * Duktape treats failed allocations as fatal outside of protected calls, the limit should be enabled
+		 * only while driver code runs in a protected call.
+		 * @param enabled Limit enabled
+		 */
+		void enableLimit(bool enabled);
+
+		/**
+		 * Returns memory statistics
+		 * @return Memory statistics
+		 */
+		Stats getStats() const;
+
+		/**
+		 * Duktape heap allocation function
+		 * @param udata Allocator
+		 * @param size Size to allocate
+		 * @return Allocated memory, nullptr on failure
+		 */
+		static void *allocFunction(void *udata, size_t size);
+
+		/**
+		 * Duktape heap reallocation function
+		 * @param udata Allocator
+		 * @param ptr Memory to reallocate
+		 * @param size New size
+		 * @return Reallocated memory, nullptr on failure
+		 */
+		static void *reallocFunction(void *udata, void *ptr, size_t size);
+
+		/**
+		 * Duktape heap free function
+		 * @param udata Allocator
+		 * @param ptr Memory to free
+		 */
+		static void freeFunction(void *udata, void *ptr);
+	private:
+		/// Allocation header keeping allocation size, preserves maximal alignment of returned memory
+		struct alignas(std::max_align_t) AllocHeader {
+			/// Allocation size
+			size_t size;
+		};
+
+		/**
+		 * Allocates memory
+		 * @param size Size to allocate
+		 * @return Allocated memory, nullptr on failure
+		 */
+		void *allocate(size_t size);
+
+		/**
+		 * Reallocates memory
+		 * @param ptr Memory to reallocate
+		 * @param size New size
+		 * @return Reallocated memory, nullptr on failure
+		 */
+		void *reallocate(void *ptr, size_t size);
+
+		/**
+		 * Frees memory
+		 * @param ptr Memory to free
+		 */
+		void release(void *ptr);
+
+		/**
+		 * Takes block from pool or process heap, live memory is not accounted
+		 * @param size Allocation size
+		 * @return Block with header set, nullptr on failure
+		 */
+		AllocHeader *takeBlock(size_t size);
+
+		/**
+		 * Returns block to pool or process heap, live memory is not accounted
+		 * @param header Block
+		 */
+		void returnBlock(AllocHeader *header);
+
+		/**
+		 * Checks limit for growth of live memory
+		 * @param growth Number of bytes to add
+		 * @return true if growth fits into limit
+		 */
+		bool withinLimit(size_t growth);
+
+		/**
+		 * Accounts live memory change
+		 * @param added Number of bytes allocated
+		 * @param removed Number of bytes freed
+		 */
+		void account(size_t added, size_t removed);
+
+		/**
+		 * Returns size class of allocation
+		 * @param size Allocation size
+		 * @return Size class index, CLASS_COUNT for allocations not served by pools
+		 */
+		static size_t sizeClass(size_t size);
+
+		/// Block sizes of pools, block holds allocation header and allocated memory, multiples of header size
+		static constexpr std::array<size_t, 10> CLASS_SIZES = {32, 48, 64, 96, 128, 192, 256, 384, 512, 1024};
+		/// Number of size classes
+		static constexpr size_t CLASS_COUNT = CLASS_SIZES.size();
+		/// Size of slab pools are carved from
+		static constexpr size_t SLAB_SIZE = 16 * 1024;
+
+		/// Free block of a pool
+		struct FreeBlock {
+			/// Next free block
+			FreeBlock *next;
+		};
+
+		/// Free blocks of pools
+		std::array<FreeBlock *, CLASS_COUNT> m_freeBlocks{};
+		/// First unused block of the last slab of pools
+		std::array<char *, CLASS_COUNT> m_slabCursor{};
+		/// End of the last slab of pools
+		std::array<char *, CLASS_COUNT> m_slabEnd{};
+		/// Slabs of all pools
+		std::vector<void *> m_slabs;
+		/// Live memory limit, 0 if unlimited
+		const size_t m_limit;
+		/// Limit enabled
+		bool m_limitEnabled = false;
+		/// Memory requested and not freed yet
+		std::atomic<size_t> m_liveBytes{0};
+		/// Maximal live memory
+		std::atomic<size_t> m_peakBytes{0};
+		/// Memory taken from process heap
+		std::atomic<size_t> m_reservedBytes{0};
+		/// Allocations refused by limit
+		std::atomic<size_t> m_limitHits{0};
+	};
+}
@@ -0,0 +1,112 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rapidjson/document.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace iqrf {
+	/**
+	 * Driver context of a JavaScript engine
+	 *
+	 * Context holds loaded driver code and calls its functions. Calls to the same context are serialized
+	 * by the context, different contexts can be used concurrently.
+	 */
+	class JsEngineContext {
+	public:
+		/**
+		 * Memory statistics of context heap
+		 */
+		struct MemoryStats {
+			/// Memory allocated by heap and not freed yet
+			size_t liveBytes = 0;
+			/// Maximal memory allocated by heap
+			size_t peakBytes = 0;
+			/// Memory taken from process heap
+			size_t reservedBytes = 0;
+			/// Memory limit of driver code, 0 if unlimited
+			size_t limitBytes = 0;
+			/// Number of allocations refused by limit
+			size_t limitHits = 0;
+		};
+
+		/**
+		 * Destructor
+		 */
+		virtual ~JsEngineContext() {}
+
+		/**
+		 * Loads code to context heap
+		 * @param js JavaScript code to load
+		 * @param bytecode If not null, compiled code bytecode is stored here
+		 */
+		virtual void loadCode(const std::string &js, std::vector<char> *bytecode = nullptr) = 0;
+
+		/**
+		 * Loads code compiled by loadCode of the same engine to context heap
+		 * @param bytecode Compiled code bytecode
+		 */
+		virtual void loadBytecode(const std::vector<char> &bytecode) = 0;
+
+		/**
+		 * Returns memory allocated by context heap
+		 * @return Allocated bytes
+		 */
+		virtual size_t getHeapSize() const = 0;
+
+		/**
+		 * Returns memory statistics of context heap
+		 * @return Memory statistics
+		 */
+		virtual MemoryStats getMemoryStats() const = 0;
+
+		/**
+		 * Call context function
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 */
+		virtual void callFunction(const std::string &name, const std::string &params, std::string &ret) = 0;
+
+		/**
+		 * Call context function by handle
+		 *
+		 * Function is looked up by name on the first call only, the resolved function is kept by handle.
+		 * @param handle Function handle, small non-negative integer unique for function name
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 */
+		virtual void callFunction(int handle, const std::string &name, const std::string &params, std::string &ret) = 0;
+
+		/**
+		 * Call context function by handle, parameters and result are passed as values
+		 *
+		 * Result is built the way JSON.stringify would serialize it.
+		 * @param handle Function handle, small non-negative integer unique for function name
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @param allocator Allocator of return value
+		 */
+		virtual void callFunction(int handle, const std::string &name, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) = 0;
+	};
+}
@@ -16,6 +16,10 @@
  */
 
 #include "JsRenderDuktape.h"
+#include "Context.h"
+#ifdef WITH_QUICKJS
+#include "QuickJsContext.h"
+#endif
 
 #include "iqrf__JsRenderDuktape.hxx"
 
@@ -28,10 +32,14 @@ TRC_INIT_MODULE(iqrf::JsRenderDuktape)
 
 using namespace rapidjson;
 
+/// Bytecode cache subdirectory of daemon cache directory
+#define BYTECODE_CACHE_DIR "/jsBytecode"
+
 namespace iqrf {
 
 	JsRenderDuktape::JsRenderDuktape() {
 		TRC_FUNCTION_ENTER("");
+		m_contextMaps = std::make_shared<const ContextMaps>();
 		TRC_FUNCTION_LEAVE("");
 	}
 
@@ -47,12 +55,56 @@ namespace iqrf {
 			<< "JsRenderDuktape instance activate" << std::endl
 			<< "******************************");
 		modify(props);
+		TRC_INFORMATION("Using JavaScript engine: " << (m_engine == JsEngine::QuickJs ? "quickjs" : "duktape"));
+		if (m_bytecodeCacheEnabled) {
+			std::string cacheDir = m_iLaunchService->getCacheDir();
+			cacheDir = (cacheDir.empty() ? "." : cacheDir) + BYTECODE_CACHE_DIR;
+			if (m_engine == JsEngine::QuickJs) {
+				// bytecode formats of engines differ
+				cacheDir += "/quickjs";
+			}
+			m_bytecodeCache.setDirectory(cacheDir);
+			TRC_INFORMATION("Using bytecode cache dir: " << PAR(cacheDir));
+		}
 		TRC_FUNCTION_LEAVE("");
 	}
 
 	void JsRenderDuktape::modify(const shape::Properties *props) {
 		TRC_FUNCTION_ENTER("");
-		(void)props;
+		const Document &doc = props->getAsJson();
+		const Value *val = Pointer("/engine").Get(doc);
+		if (val != nullptr && val->IsString()) {
+			std::string engine = val->GetString();
+			if (engine == "quickjs") {
+#ifdef WITH_QUICKJS
+				m_engine = JsEngine::QuickJs;
+#else
+				TRC_WARNING("QuickJS engine is not available in this build, using Duktape.");
+				m_engine = JsEngine::Duktape;
+#endif
+			} else {
+				if (engine != "duktape") {
+					TRC_WARNING("Unknown JavaScript engine, using Duktape: " << PAR(engine));
+				}
+				m_engine = JsEngine::Duktape;
+			}
+		}
+		val = Pointer("/bytecodeCache").Get(doc);
+		if (val != nullptr && val->IsBool()) {
+			m_bytecodeCacheEnabled = val->GetBool();
+		}
+		val = Pointer("/nativeDrivers").Get(doc);
+		if (val != nullptr && val->IsBool()) {
+			m_nativeDriversEnabled = val->GetBool();
+		}
+		val = Pointer("/heapLimit").Get(doc);
+		if (val != nullptr && val->IsUint64()) {
+			m_heapLimit = static_cast<size_t>(val->GetUint64());
+		}
+		val = Pointer("/profiling").Get(doc);
+		if (val != nullptr && val->IsBool()) {
+			m_profiler.enable(val->GetBool());
+		}
 		TRC_FUNCTION_LEAVE("");
 	}
 
@@ -65,19 +117,43 @@ namespace iqrf {
 		TRC_FUNCTION_LEAVE("");
 	}
 
-	bool JsRenderDuktape::loadContextCode(int contextId, const std::string &js, const std::set<uint32_t> &driverIdSet) {
-		TRC_FUNCTION_ENTER(PAR(contextId));
+	bool JsRenderDuktape::loadContextCode(int contextId, const std::string &js, const std::set<uint32_t> &driverIdSet, const std::string &codeHash) {
+		TRC_FUNCTION_ENTER(PAR(contextId) << PAR(codeHash));
 		bool retval = true;
 		try {
+			auto current = getContextMaps();
+			if (isContextLoaded(*current, contextId, codeHash)) {
+				// running calls are not disturbed by reloading unchanged code
+				TRC_DEBUG("Context code unchanged, skipping reload: " << PAR(contextId) << PAR(codeHash));
+				auto drivers = current->contextDriverMap.find(contextId);
+				if (drivers == current->contextDriverMap.end() || drivers->second != driverIdSet) {
+					std::unique_lock<std::mutex> lck(m_contextMtx);
+					updateContextMaps([&](ContextMaps &maps) {
+						maps.contextDriverMap[contextId] = driverIdSet;
+					});
+				}
+				TRC_FUNCTION_LEAVE("");
+				return true;
+			}
+			std::shared_ptr<JsEngineContext> context = findSharedContext(*current, codeHash);
+			if (context != nullptr) {
+				TRC_DEBUG("Sharing heap of context with identical code: " << PAR(contextId) << PAR(codeHash));
+			} else {
+				// compile outside of writer lock, running calls keep using the previous context
+				context = createContext(js, codeHash);
+			}
 			std::unique_lock<std::mutex> lck(m_contextMtx);
-			auto found = m_contexts.find(contextId);
-			if (found != m_contexts.end()) {
-				m_contexts.erase(contextId);
-			}
-			auto pair = std::make_pair(contextId, std::shared_ptr<Context>(shape_new Context()));
-			pair.second->loadCode(js);
-			m_contexts.insert(pair);
-			m_contextDriverMap[contextId] = driverIdSet;
+			updateContextMaps([&](ContextMaps &maps) {
+				maps.contexts[contextId] = context;
+				maps.contextDriverMap[contextId] = driverIdSet;
+				if (codeHash.empty()) {
+					maps.contextHashMap.erase(contextId);
+				} else {
+					maps.contextHashMap[contextId] = codeHash;
+				}
+				// native functions match previous code only
+				maps.contextNativeMap.erase(contextId);
+			});
 		} catch (const std::exception &e) {
 			CATCH_EXC_TRC_WAR(std::exception, e, "Failed to load JS code for context " << std::to_string(contextId));
 			shape::Tracer::get().writeMsg((int)shape::TraceLevel::Warning, 33, TRC_MNAME, __FILE__, __LINE__, __FUNCTION__, js);
@@ -90,30 +166,104 @@ namespace iqrf {
 	void JsRenderDuktape::mapAddressToContext(int address, int contextId) {
 		TRC_FUNCTION_ENTER(PAR(address) << PAR(contextId));
 		std::unique_lock<std::mutex> lck(m_contextMtx);
-		m_addressContextMap[address] = contextId;
+		updateContextMaps([&](ContextMaps &maps) {
+			maps.addressContextMap[address] = contextId;
+		});
 		TRC_FUNCTION_LEAVE("");
 	}
 
-	std::set<uint32_t> JsRenderDuktape::getDriverIdSet(int contextId) const {
+	void JsRenderDuktape::setContextDriverHashes(int contextId, const std::set<std::string> &driverHashes) {
+		TRC_FUNCTION_ENTER(PAR(contextId));
+		auto functions = NativeDrivers::select(driverHashes);
+		if (!m_nativeDriversEnabled || functions->empty()) {
+			functions = nullptr;
+		} else {
+			TRC_DEBUG("Using native driver functions: " << PAR(contextId) << PAR(functions->size()));
+		}
 		std::unique_lock<std::mutex> lck(m_contextMtx);
-		auto found = m_contextDriverMap.find(contextId);
-		if (found != m_contextDriverMap.end()) {
+		updateContextMaps([&](ContextMaps &maps) {
+			if (functions != nullptr && maps.contexts.count(contextId) > 0) {
+				maps.contextNativeMap[contextId] = functions;
+			} else {
+				maps.contextNativeMap.erase(contextId);
+			}
+		});
+		TRC_FUNCTION_LEAVE("");
+	}
+
+	std::set<uint32_t> JsRenderDuktape::getDriverIdSet(int contextId) const {
+		auto maps = getContextMaps();
+		auto found = maps->contextDriverMap.find(contextId);
+		if (found != maps->contextDriverMap.end()) {
 			return found->second;
 		}
 		return std::set<uint32_t>();
 	}
 
 	void JsRenderDuktape::callContext(int address, int hwpid, const std::string &fname, const std::string &params, std::string &ret) {
+		callContext(address, hwpid, resolveFunction(fname), params, ret);
+	}
+
+	int JsRenderDuktape::resolveFunction(const std::string &fname) {
+		{
+			std::shared_lock<std::shared_mutex> lck(m_functionMtx);
+			auto found = m_functionHandles.find(fname);
+			if (found != m_functionHandles.end()) {
+				return found->second;
+			}
+		}
+		if (fname.find('.') == std::string::npos) {
+			THROW_EXC_TRC_WAR(std::logic_error, "Invalid namespace and function format: " << fname);
+		}
+		std::unique_lock<std::shared_mutex> lck(m_functionMtx);
+		auto result = m_functionHandles.insert(std::make_pair(fname, static_cast<int>(m_functionNames.size())));
+		if (result.second) {
+			m_functionNames.push_back(std::make_unique<const std::string>(fname));
+			TRC_DEBUG("Resolved function handle: " << PAR(fname) << PAR(result.first->second));
+		}
+		return result.first->second;
+	}
+
+	const std::string &JsRenderDuktape::getFunctionName(int functionHandle) const {
+		std::shared_lock<std::shared_mutex> lck(m_functionMtx);
+		if (functionHandle < 0 || static_cast<size_t>(functionHandle) >= m_functionNames.size()) {
+			THROW_EXC_TRC_WAR(std::logic_error, "Unknown function handle: " << PAR(functionHandle));
+		}
+		// names are never removed, reference stays valid after unlocking
+		return *m_functionNames[functionHandle];
+	}
+
+	void JsRenderDuktape::callContext(int address, int hwpid, int functionHandle, const std::string &params, std::string &ret) {
+		const std::string &fname = getFunctionName(functionHandle);
+		dispatchCall(address, hwpid, functionHandle, fname, [&](const ContextMaps &maps, int contextId, JsEngineContext &ctx) {
+			callFunction(maps, contextId, ctx, functionHandle, fname, params, ret);
+		});
+	}
+
+	void JsRenderDuktape::callContext(int address, int hwpid, const std::string &fname, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) {
+		callContext(address, hwpid, resolveFunction(fname), params, ret, allocator);
+	}
+
+	void JsRenderDuktape::callContext(int address, int hwpid, int functionHandle, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) {
+		const std::string &fname = getFunctionName(functionHandle);
+		dispatchCall(address, hwpid, functionHandle, fname, [&](const ContextMaps &maps, int contextId, JsEngineContext &ctx) {
+			callFunction(maps, contextId, ctx, functionHandle, fname, params, ret, allocator);
+		});
+	}
+
+	void JsRenderDuktape::dispatchCall(int address, int hwpid, int functionHandle, const std::string &fname, const ContextCall &call) {
 		TRC_FUNCTION_ENTER(PAR(address) << PAR(hwpid) << PAR(fname));
-		std::unique_lock<std::mutex> lck(m_contextMtx);
+		// snapshot keeps contexts alive for the duration of the call, only the context itself is locked
+		auto maps = getContextMaps();
 
 		bool addrContextUsed = true;
-		std::shared_ptr<Context> ctx;
+		std::shared_ptr<JsEngineContext> ctx;
+		int contextId = 0;
 		try {
-			ctx = findAddressContext(address);
+			ctx = findAddressContext(*maps, address, contextId);
 			if (ctx == nullptr) {
 				addrContextUsed = false;
-				ctx = findHwpidContext(hwpid);
+				ctx = findHwpidContext(*maps, hwpid, contextId);
 			}
 		} catch (const std::logic_error &e) {
 			CATCH_EXC_TRC_WAR(std::logic_error, e, e.what());
@@ -122,7 +272,7 @@ namespace iqrf {
 		if (address == 0 && addrContextUsed) {
 			bool driverError = false;
 			try {
-				ctx->callFunction(fname, params, ret);
+				invokeCall(*maps, contextId, *ctx, functionHandle, call);
 			} catch (const PeripheralException &e) {
 				driverError = true;
 			} catch (const PeripheralCommandException &e) {
@@ -130,45 +280,153 @@ namespace iqrf {
 			}
 			if (driverError) {
 				TRC_DEBUG("Addr 0 context missing peripheral or command, retrying with provisional context.");
-				int contextId = HWPID_DEFAULT_MAPPING;
-				auto found = m_contexts.find(contextId);
-				if (found == m_contexts.end()) {
+				contextId = HWPID_DEFAULT_MAPPING;
+				auto found = maps->contexts.find(contextId);
+				if (found == maps->contexts.end()) {
 					THROW_EXC_TRC_WAR(std::logic_error, "Default hwpid context not found for addr 0 fallback context.");
 				}
 				ctx = found->second;
-				ctx->callFunction(fname, params, ret);
+				invokeCall(*maps, contextId, *ctx, functionHandle, call);
 			}
 		} else {
-			ctx->callFunction(fname, params, ret);
+			invokeCall(*maps, contextId, *ctx, functionHandle, call);
 		}
 		TRC_FUNCTION_LEAVE("");
 	}
 
-	std::shared_ptr<Context> JsRenderDuktape::findAddressContext(int address) {
-		auto addrContext = m_addressContextMap.find(address);
-		if (addrContext == m_addressContextMap.end()) {
+	void JsRenderDuktape::invokeCall(const ContextMaps &maps, int contextId, JsEngineContext &ctx, int functionHandle, const ContextCall &call) {
+		if (!m_profiler.isEnabled()) {
+			call(maps, contextId, ctx);
+			return;
+		}
+		auto heapBefore = static_cast<int64_t>(ctx.getHeapSize());
+		auto start = std::chrono::steady_clock::now();
+		try {
+			call(maps, contextId, ctx);
+		} catch (...) {
+			auto duration = std::chrono::steady_clock::now() - start;
+			m_profiler.record(contextId, functionHandle, duration, static_cast<int64_t>(ctx.getHeapSize()) - heapBefore, true);
+			throw;
+		}
+		auto duration = std::chrono::steady_clock::now() - start;
+		m_profiler.record(contextId, functionHandle, duration, static_cast<int64_t>(ctx.getHeapSize()) - heapBefore, false);
+	}
+
+	void JsRenderDuktape::callFunction(const ContextMaps &maps, int contextId, JsEngineContext &ctx, int functionHandle, const std::string &fname, const std::string &params, std::string &ret) {
+		auto natives = maps.contextNativeMap.find(contextId);
+		if (natives != maps.contextNativeMap.end()) {
+			auto function = natives->second->find(fname);
+			// native function declines calls it cannot handle identically to driver code
+			if (function != natives->second->end() && function->second(params, ret)) {
+				return;
+			}
+		}
+		ctx.callFunction(functionHandle, fname, params, ret);
+	}
+
+	void JsRenderDuktape::callFunction(const ContextMaps &maps, int contextId, JsEngineContext &ctx, int functionHandle, const std::string &fname, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) {
+		auto natives = maps.contextNativeMap.find(contextId);
+		if (natives != maps.contextNativeMap.end()) {
+			auto function = natives->second->find(fname);
+			if (function != natives->second->end()) {
+				StringBuffer buffer;
+				Writer<StringBuffer> writer(buffer);
+				params.Accept(writer);
+				std::string result;
+				if (function->second(buffer.GetString(), result)) {
+					Document doc(&allocator);
+					doc.Parse(result);
+					ret = static_cast<Value &>(doc);
+					return;
+				}
+			}
+		}
+		ctx.callFunction(functionHandle, fname, params, ret, allocator);
+	}
+
+	std::shared_ptr<JsEngineContext> JsRenderDuktape::findSharedContext(const ContextMaps &maps, const std::string &codeHash) {
+		if (codeHash.empty()) {
 			return nullptr;
 		}
-		int contextId = addrContext->second;
-		auto context = m_contexts.find(contextId);
-		if (context == m_contexts.end()) {
+		for (const auto &[contextId, hash] : maps.contextHashMap) {
+			if (hash == codeHash) {
+				auto found = maps.contexts.find(contextId);
+				if (found != maps.contexts.end()) {
+					return found->second;
+				}
+			}
+		}
+		return nullptr;
+	}
+
+	bool JsRenderDuktape::isContextLoaded(const ContextMaps &maps, int contextId, const std::string &codeHash) {
+		if (codeHash.empty() || maps.contexts.count(contextId) == 0) {
+			return false;
+		}
+		auto loaded = maps.contextHashMap.find(contextId);
+		return loaded != maps.contextHashMap.end() && loaded->second == codeHash;
+	}
+
+	std::shared_ptr<JsEngineContext> JsRenderDuktape::createContext(const std::string &js, const std::string &codeHash) {
+		bool useCache = m_bytecodeCacheEnabled && BytecodeCache::isValidKey(codeHash);
+		std::shared_ptr<JsEngineContext> context(newContext());
+		if (useCache) {
+			try {
+				auto bytecode = m_bytecodeCache.get(codeHash);
+				if (bytecode != nullptr) {
+					context->loadBytecode(*bytecode);
+					TRC_DEBUG("Context loaded from bytecode cache: " << PAR(codeHash));
+					return context;
+				}
+			} catch (const std::exception &e) {
+				CATCH_EXC_TRC_WAR(std::exception, e, "Failed to load cached bytecode, compiling code: " << PAR(codeHash));
+				m_bytecodeCache.remove(codeHash);
+				// heap may hold partially executed code
+				context = newContext();
+			}
+		}
+		std::vector<char> bytecode;
+		context->loadCode(js, useCache ? &bytecode : nullptr);
+		if (useCache) {
+			m_bytecodeCache.put(codeHash, std::move(bytecode));
+		}
+		return context;
+	}
+
+	std::shared_ptr<JsEngineContext> JsRenderDuktape::newContext() const {
+#ifdef WITH_QUICKJS
+		if (m_engine == JsEngine::QuickJs) {
+			return std::shared_ptr<JsEngineContext>(shape_new QuickJsContext(m_heapLimit));
+		}
+#endif
+		return std::shared_ptr<JsEngineContext>(shape_new Context(m_heapLimit));
+	}
+
+	std::shared_ptr<JsEngineContext> JsRenderDuktape::findAddressContext(const ContextMaps &maps, int address, int &contextId) {
+		auto addrContext = maps.addressContextMap.find(address);
+		if (addrContext == maps.addressContextMap.end()) {
+			return nullptr;
+		}
+		contextId = addrContext->second;
+		auto context = maps.contexts.find(contextId);
+		if (context == maps.contexts.end()) {
 			THROW_EXC_TRC_WAR(std::logic_error, "Cannot find JS context for address: " << PAR(address) << PAR(contextId));
 		}
 		TRC_DEBUG("Found address context: " << PAR(address) << PAR(contextId));
 		return context->second;
 	}
 
-	std::shared_ptr<Context> JsRenderDuktape::findHwpidContext(int hwpid) {
+	std::shared_ptr<JsEngineContext> JsRenderDuktape::findHwpidContext(const ContextMaps &maps, int hwpid, int &contextId) {
 		uint16_t uhwpid = (uint16_t)hwpid;
-		int contextId = HWPID_MAPPING_SPACE - (int)uhwpid;
-		auto context = m_contexts.find(contextId);
-		if (context == m_contexts.end()) {
+		contextId = HWPID_MAPPING_SPACE - (int)uhwpid;
+		auto context = maps.contexts.find(contextId);
+		if (context == maps.contexts.end()) {
 			contextId = HWPID_DEFAULT_MAPPING;
-			context = m_contexts.find(contextId);
+			context = maps.contexts.find(contextId);
 		} else {
 			TRC_DEBUG("Using provisional hwpid context: " << PAR(uhwpid) << PAR(contextId));
 		}
-		if (context == m_contexts.end()) {
+		if (context == maps.contexts.end()) {
 			THROW_EXC_TRC_WAR(std::logic_error, "Default hwpid context not found.");
 		} else {
 			TRC_DEBUG("Using default provisional hwpid context: " << PAR(uhwpid) << PAR(contextId));
@@ -177,22 +435,142 @@ namespace iqrf {
 	}
 
 	std::shared_ptr<int> JsRenderDuktape::getDeviceAddrProductId(int address) const {
-		auto result = m_addressContextMap.find(address);
-		if (result == m_addressContextMap.end()) {
+		auto maps = getContextMaps();
+		auto result = maps->addressContextMap.find(address);
+		if (result == maps->addressContextMap.end()) {
 			return nullptr;
 		}
 		return std::make_shared<int>(result->second);
 	}
 
+	IJsRenderService::HeapStats JsRenderDuktape::getHeapStats() const {
+		auto maps = getContextMaps();
+		HeapStats stats;
+		stats.contextCount = maps->contexts.size();
+		std::map<const JsEngineContext *, size_t> heapUsers;
+		for (const auto &[contextId, context] : maps->contexts) {
+			(void)contextId;
+			++heapUsers[context.get()];
+		}
+		stats.heapCount = heapUsers.size();
+		for (const auto &[context, users] : heapUsers) {
+			size_t heapSize = context->getHeapSize();
+			stats.heapBytes += heapSize;
+			stats.savedBytes += (users - 1) * heapSize;
+		}
+		return stats;
+	}
+
+	std::map<int, IJsRenderService::ContextMemoryStats> JsRenderDuktape::getContextMemoryStats() const {
+		auto maps = getContextMaps();
+		std::map<const JsEngineContext *, size_t> heapUsers;
+		for (const auto &[contextId, context] : maps->contexts) {
+			(void)contextId;
+			++heapUsers[context.get()];
+		}
+		std::map<int, ContextMemoryStats> result;
+		for (const auto &[contextId, context] : maps->contexts) {
+			auto heapStats = context->getMemoryStats();
+			ContextMemoryStats &stats = result[contextId];
+			auto drivers = maps->contextDriverMap.find(contextId);
+			if (drivers != maps->contextDriverMap.end()) {
+				stats.driverIds = drivers->second;
+			}
+			stats.heapUsers = heapUsers[context.get()];
+			stats.liveBytes = heapStats.liveBytes;
+			stats.peakBytes = heapStats.peakBytes;
+			stats.reservedBytes = heapStats.reservedBytes;
+			stats.limitBytes = heapStats.limitBytes;
+			stats.limitHits = heapStats.limitHits;
+		}
+		return result;
+	}
+
+	void JsRenderDuktape::setProfiling(bool enabled) {
+		TRC_INFORMATION("Driver function profiling " << (enabled ? "enabled" : "disabled"));
+		m_profiler.enable(enabled);
+	}
+
+	bool JsRenderDuktape::isProfiling() const {
+		return m_profiler.isEnabled();
+	}
+
+	std::map<int, std::map<std::string, IJsRenderService::FunctionProfile>> JsRenderDuktape::getProfile() const {
+		std::map<int, std::map<std::string, FunctionProfile>> result;
+		for (const auto &[contextId, functions] : m_profiler.getProfile()) {
+			auto &contextProfile = result[contextId];
+			for (const auto &[functionHandle, profile] : functions) {
+				contextProfile[getFunctionName(functionHandle)] = profile;
+			}
+		}
+		return result;
+	}
+
+	void JsRenderDuktape::resetProfile() {
+		TRC_INFORMATION("Driver function profile reset");
+		m_profiler.reset();
+	}
+
+	void JsRenderDuktape::retainContexts(const std::set<int> &contextIds, const std::map<int, int> &addressContexts) {
+		TRC_FUNCTION_ENTER(PAR(contextIds.size()));
+		std::unique_lock<std::mutex> lck(m_contextMtx);
+		std::set<std::string> codeHashes;
+		updateContextMaps([&](ContextMaps &maps) {
+			for (auto it = maps.contexts.begin(); it != maps.contexts.end();) {
+				if (contextIds.count(it->first) > 0) {
+					++it;
+					continue;
+				}
+				TRC_DEBUG("Removing context: " << PAR(it->first));
+				maps.contextDriverMap.erase(it->first);
+				maps.contextHashMap.erase(it->first);
+				maps.contextNativeMap.erase(it->first);
+				it = maps.contexts.erase(it);
+			}
+			// addresses not mapped during reload do not belong to network anymore
+			maps.addressContextMap.clear();
+			for (const auto &[address, contextId] : addressContexts) {
+				if (maps.contexts.count(contextId) > 0) {
+					maps.addressContextMap.insert(std::make_pair(address, contextId));
+				}
+			}
+			for (const auto &[contextId, hash] : maps.contextHashMap) {
+				codeHashes.insert(hash);
+			}
+		});
+		// bytecode is needed only to create contexts, files of retained contexts are kept for the next load
+		m_bytecodeCache.retain(codeHashes);
+		TRC_FUNCTION_LEAVE("");
+	}
+
 	void JsRenderDuktape::clearContexts() {
 		TRC_FUNCTION_ENTER("");
 		std::unique_lock<std::mutex> lck(m_contextMtx);
-		m_contexts.clear();
-		m_addressContextMap.clear();
-		m_contextDriverMap.clear();
+		std::atomic_store(&m_contextMaps, std::make_shared<const ContextMaps>());
+		m_bytecodeCache.clear();
 		TRC_FUNCTION_LEAVE("");
 	}
 
+	std::shared_ptr<const JsRenderDuktape::ContextMaps> JsRenderDuktape::getContextMaps() const {
+		return std::atomic_load(&m_contextMaps);
+	}
+
+	void JsRenderDuktape::updateContextMaps(const std::function<void(ContextMaps &)> &modifier) {
+		auto maps = std::make_shared<ContextMaps>(*getContextMaps());
+		modifier(*maps);
+		std::atomic_store(&m_contextMaps, std::shared_ptr<const ContextMaps>(std::move(maps)));
+	}
+
+	void JsRenderDuktape::attachInterface(shape::ILaunchService *iface) {
+		m_iLaunchService = iface;
+	}
+
+	void JsRenderDuktape::detachInterface(shape::ILaunchService *iface) {
+		if (m_iLaunchService == iface) {
+			m_iLaunchService = nullptr;
+		}
+	}
+
 	void JsRenderDuktape::attachInterface(shape::ITraceService *iface) {
 		shape::Tracer::get().addTracerService(iface);
 	}
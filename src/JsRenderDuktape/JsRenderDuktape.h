@@ -17,24 +17,36 @@
 
 #pragma once
 
-#include "Context.h"
+#include "BytecodeCache.h"
+#include "FunctionProfiler.h"
+#include "ILaunchService.h"
 #include "IJsRenderService.h"
 #include "ITraceService.h"
+#include "JsEngineContext.h"
+#include "NativeDrivers.h"
 #include "ShapeProperties.h"
 #include "Trace.h"
 
 #include "rapidjson/rapidjson.h"
 #include "rapidjson/document.h"
+#include "rapidjson/pointer.h"
 #include "rapidjson/istreamwrapper.h"
 #include "rapidjson/stringbuffer.h"
 #include "rapidjson/prettywriter.h"
+#include "rapidjson/writer.h"
 
 #include <algorithm>
 #include <condition_variable>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 /// iqrf namespace
 namespace iqrf {
@@ -72,12 +84,17 @@ namespace iqrf {
 
 		/**
 		 * Creates a new context and loads code, or loads code for existing context
+		 *
+		 * Contexts loaded with identical code hash share a single heap. Loading code with the hash
+		 * the context is already loaded with keeps the context. New context replaces the previous one
+		 * once it is compiled, running calls finish in the previous context.
 		 * @param contextId Context ID
 		 * @param js Code to load
 		 * @param driverIdSet Context drivers
+		 * @param codeHash Hash of code used as key of compiled code cache, empty to always compile code
 		 * @return true if context code was successfully loaded, false otherwise
 		 */
-		bool loadContextCode(int contextId, const std::string &js, const std::set<uint32_t> &driverIdSet) override;
+		bool loadContextCode(int contextId, const std::string &js, const std::set<uint32_t> &driverIdSet, const std::string &codeHash = "") override;
 
 		/**
 		 * Assigns context ID for device address
@@ -86,6 +103,15 @@ namespace iqrf {
 		 */
 		void mapAddressToContext(int address, int contextId) override;
 
+		/**
+		 * Sets hashes of driver code loaded in context, native implementations of functions are used for known drivers
+		 *
+		 * Reloading context code clears the hashes.
+		 * @param contextId Context ID
+		 * @param driverHashes Hashes of all driver code loaded in the context
+		 */
+		void setContextDriverHashes(int contextId, const std::set<std::string> &driverHashes) override;
+
 		/**
 		 * Attempts to find suitable context and call function
 		 * @param address Address
@@ -96,6 +122,48 @@ namespace iqrf {
 		 */
 		void callContext(int address, int hwpid, const std::string &fname, const std::string &params, std::string &ret) override;
 
+		/**
+		 * Resolves function name to handle
+		 *
+		 * Calls by handle skip function name parsing and lookup in contexts the function was already called in.
+		 * Handles are valid for the lifetime of the service and survive reloading of contexts.
+		 * @param fname Function name
+		 * @return Function handle
+		 */
+		int resolveFunction(const std::string &fname) override;
+
+		/**
+		 * Attempts to find suitable context and call function by handle
+		 * @param address Address
+		 * @param hwpid HW profile ID
+		 * @param functionHandle Function handle returned by resolveFunction
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 */
+		void callContext(int address, int hwpid, int functionHandle, const std::string &params, std::string &ret) override;
+
+		/**
+		 * Attempts to find suitable context and call function, parameters and result are passed without JSON text
+		 * @param address Address
+		 * @param hwpid HW profile ID
+		 * @param fname Function name
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 * @param allocator Allocator of return value
+		 */
+		void callContext(int address, int hwpid, const std::string &fname, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) override;
+
+		/**
+		 * Attempts to find suitable context and call function by handle, parameters and result are passed without JSON text
+		 * @param address Address
+		 * @param hwpid HW profile ID
+		 * @param functionHandle Function handle returned by resolveFunction
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 * @param allocator Allocator of return value
+		 */
+		void callContext(int address, int hwpid, int functionHandle, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) override;
+
 		/**
 		 * Returns context driver IDs
 		 * @param contextId Context ID
@@ -110,11 +178,71 @@ namespace iqrf {
 		 */
 		std::shared_ptr<int> getDeviceAddrProductId(int address) const override;
 
+		/**
+		 * Returns driver context heap statistics
+		 * @return Heap statistics
+		 */
+		HeapStats getHeapStats() const override;
+
+		/**
+		 * Returns memory statistics of driver contexts
+		 *
+		 * Contexts sharing a heap report the same heap figures.
+		 * @return Memory statistics by context ID
+		 */
+		std::map<int, ContextMemoryStats> getContextMemoryStats() const override;
+
+		/**
+		 * Enables or disables profiling of driver function calls, collected profile is kept
+		 * @param enabled Profiling enabled
+		 */
+		void setProfiling(bool enabled) override;
+
+		/**
+		 * Checks if profiling of driver function calls is enabled
+		 * @return true if profiling is enabled, false otherwise
+		 */
+		bool isProfiling() const override;
+
+		/**
+		 * Returns profile of driver function calls
+		 *
+		 * Execution time includes waiting for a context shared by concurrent calls.
+		 * @return Function profiles by context ID and function name
+		 */
+		std::map<int, std::map<std::string, FunctionProfile>> getProfile() const override;
+
+		/**
+		 * Clears profile of driver function calls
+		 */
+		void resetProfile() override;
+
+		/**
+		 * Removes contexts not listed and replaces address mapping
+		 *
+		 * Running calls finish in removed contexts.
+		 * @param contextIds IDs of contexts to keep
+		 * @param addressContexts Context IDs by device address mapped during reload
+		 */
+		void retainContexts(const std::set<int> &contextIds, const std::map<int, int> &addressContexts) override;
+
 		/**
 		 * Clears all driver contexts, device and address mapping
 		 */
 		void clearContexts() override;
 
+		/**
+		 * Attaches launch service interface
+		 * @param iface Launch service interface
+		 */
+		void attachInterface(shape::ILaunchService *iface);
+
+		/**
+		 * Detaches launch service interface
+		 * @param iface Launch service interface
+		 */
+		void detachInterface(shape::ILaunchService *iface);
+
 		/**
 		 * Attaches tracing service interface
 		 * @param iface Tracing service interface
@@ -127,27 +255,175 @@ namespace iqrf {
 		 */
 		void detachInterface(shape::ITraceService *iface);
 	private:
+		/**
+		 * JavaScript engines running driver code
+		 */
+		enum class JsEngine {
+			Duktape,
+			QuickJs,
+		};
+
+		/**
+		 * Immutable snapshot of contexts and their mappings
+		 */
+		struct ContextMaps {
+			/// map of contexts
+			std::map<int, std::shared_ptr<JsEngineContext>> contexts;
+			/// map of addresses and corresponding context IDs
+			std::map<int, int> addressContextMap;
+			/// map of context IDs and corresponding driver IDs
+			std::map<int, std::set<uint32_t>> contextDriverMap;
+			/// map of context IDs and hashes of their code
+			std::map<int, std::string> contextHashMap;
+			/// map of context IDs and native implementations of their functions
+			std::map<int, std::shared_ptr<const NativeDrivers::FunctionMap>> contextNativeMap;
+		};
+
+		/**
+		 * Returns current snapshot of contexts and mappings
+		 * @return Contexts and mappings
+		 */
+		std::shared_ptr<const ContextMaps> getContextMaps() const;
+
+		/**
+		 * Publishes modified copy of contexts and mappings
+		 *
+		 * Must be called with writer mutex locked.
+		 * @param modifier Function modifying the copy
+		 */
+		void updateContextMaps(const std::function<void(ContextMaps &)> &modifier);
+
+		/**
+		 * Attempts to find context loaded with the same code
+		 * @param maps Contexts and mappings
+		 * @param codeHash Hash of code
+		 * @return Context, nullptr if there is no such context
+		 */
+		static std::shared_ptr<JsEngineContext> findSharedContext(const ContextMaps &maps, const std::string &codeHash);
+
+		/**
+		 * Checks if context is loaded with code of given hash
+		 * @param maps Contexts and mappings
+		 * @param contextId Context ID
+		 * @param codeHash Hash of code, empty hash never matches
+		 * @return true if context is loaded with the code, false otherwise
+		 */
+		static bool isContextLoaded(const ContextMaps &maps, int contextId, const std::string &codeHash);
+
+		/**
+		 * Creates context and loads code, compiled code is taken from or stored to bytecode cache
+		 * @param js Code to load
+		 * @param codeHash Hash of code
+		 * @return Context
+		 */
+		std::shared_ptr<JsEngineContext> createContext(const std::string &js, const std::string &codeHash);
+
+		/**
+		 * Creates empty context of configured engine
+		 * @return Context
+		 */
+		std::shared_ptr<JsEngineContext> newContext() const;
+
 		/**
 		 * Attempts to find context by device address
+		 * @param maps Contexts and mappings
 		 * @param address Device address
+		 * @param contextId Found context ID
 		 * @return Context
 		 */
-		std::shared_ptr<Context> findAddressContext(int address);
+		static std::shared_ptr<JsEngineContext> findAddressContext(const ContextMaps &maps, int address, int &contextId);
 
 		/**
 		 * Attempts to find context by HWPID with default HWPID fallback
+		 * @param maps Contexts and mappings
 		 * @param hwpid HWPID
+		 * @param contextId Found context ID
 		 * @return Context
 		 */
-		std::shared_ptr<Context> findHwpidContext(int hwpid);
+		static std::shared_ptr<JsEngineContext> findHwpidContext(const ContextMaps &maps, int hwpid, int &contextId);
+
+		/**
+		 * Returns name of resolved function
+		 * @param functionHandle Function handle
+		 * @return Function name
+		 */
+		const std::string &getFunctionName(int functionHandle) const;
+
+		/// Function call in a found context
+		typedef std::function<void(const ContextMaps &, int, JsEngineContext &)> ContextCall;
+
+		/**
+		 * Finds suitable context and calls function in it
+		 *
+		 * Address 0 calls failing on missing peripheral or command are retried in default HWPID context.
+		 * @param address Address
+		 * @param hwpid HW profile ID
+		 * @param functionHandle Function handle
+		 * @param fname Function name
+		 * @param call Function call, invoked with contexts and mappings, context ID and context
+		 */
+		void dispatchCall(int address, int hwpid, int functionHandle, const std::string &fname, const ContextCall &call);
+
+		/**
+		 * Calls function in context, call is recorded in profile if profiling is enabled
+		 * @param maps Contexts and mappings
+		 * @param contextId Context ID
+		 * @param ctx Context
+		 * @param functionHandle Function handle
+		 * @param call Function call
+		 */
+		void invokeCall(const ContextMaps &maps, int contextId, JsEngineContext &ctx, int functionHandle, const ContextCall &call);
+
+		/**
+		 * Calls native implementation of context function, or the function itself if there is none
+		 * @param maps Contexts and mappings
+		 * @param contextId Context ID
+		 * @param ctx Context
+		 * @param functionHandle Function handle
+		 * @param fname Function name
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 */
+		static void callFunction(const ContextMaps &maps, int contextId, JsEngineContext &ctx, int functionHandle, const std::string &fname, const std::string &params, std::string &ret);
+
+		/**
+		 * Calls native implementation of context function, or the function itself if there is none
+		 *
+		 * Native implementations work with JSON text, values are serialized for them.
+		 * @param maps Contexts and mappings
+		 * @param contextId Context ID
+		 * @param ctx Context
+		 * @param functionHandle Function handle
+		 * @param fname Function name
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 * @param allocator Allocator of return value
+		 */
+		static void callFunction(const ContextMaps &maps, int contextId, JsEngineContext &ctx, int functionHandle, const std::string &fname, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator);
 
-		/// context mutex
+		/// launch service
+		shape::ILaunchService *m_iLaunchService = nullptr;
+		/// compiled code cache enabled
+		bool m_bytecodeCacheEnabled = true;
+		/// compiled code cache
+		BytecodeCache m_bytecodeCache;
+		/// native implementations of known driver functions enabled
+		bool m_nativeDriversEnabled = true;
+		/// memory limit of driver code per context heap, 0 if unlimited
+		size_t m_heapLimit = 0;
+		/// engine running driver code
+		JsEngine m_engine = JsEngine::Duktape;
+		/// driver function call profiler
+		FunctionProfiler m_profiler;
+		/// writer mutex, serializes modifications of contexts and mappings
 		mutable std::mutex m_contextMtx;
-		/// map of contexts
-		std::map<int, std::shared_ptr<Context>> m_contexts;
-		/// map of addresses and corresponding context IDs
-		std::map<int, int> m_addressContextMap;
-		/// map of context IDs and corresponding driver IDs
-		std::map<int, std::set<uint32_t>> m_contextDriverMap;
+		/// contexts and mappings, readers access snapshot without locking
+		std::shared_ptr<const ContextMaps> m_contextMaps;
+		/// function handles mutex
+		mutable std::shared_mutex m_functionMtx;
+		/// function handles by function name
+		std::unordered_map<std::string, int> m_functionHandles;
+		/// function names by function handle, names are never removed
+		std::vector<std::unique_ptr<const std::string>> m_functionNames;
 	};
 }
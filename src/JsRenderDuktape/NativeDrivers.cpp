@@ -0,0 +1,822 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "NativeDrivers.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <map>
+#include <optional>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace iqrf {
+
+	const char *NativeDrivers::LIBRARY_V0_HASH = "a58699537271b37d7bc31fd2f677df0b9a2c7f232ddccd57ed747055be6bebc3";
+	const char *NativeDrivers::EMBED_FRC_V0_HASH = "ae477a94acda3d668ec0428b8d65443c4c5ff73f412bf2e76a58ff2130d7859b";
+	const char *NativeDrivers::SENSOR_V15_HASH = "3716765d10d59f2a9c41db72c22f2904ba75ab2a0763cd5286cec7101e3c30d9";
+	const char *NativeDrivers::BINARY_OUTPUT_V4_HASH = "09f53e9fcf5bd6bf29ab03a66822cae67a8724a5722026e3d87872f854a4308f";
+	const char *NativeDrivers::DAEMON_WRAPPER_HASH = "e7426850d9cb0657c3dec91384695c0e56b3b24ea3209713119944b0744a9d31";
+
+	/// Sensor error value, NAN macro is float
+	static const double NOT_A_NUMBER = std::numeric_limits<double>::quiet_NaN();
+
+	/// Standard sensor FRC commands
+	static const uint8_t SENSOR_FRC_2BITS = 0x10;
+	static const uint8_t SENSOR_FRC_1BYTE = 0x90;
+	static const uint8_t SENSOR_FRC_2BYTES = 0xE0;
+	static const uint8_t SENSOR_FRC_4BYTES = 0xF9;
+
+	/// Sensor type as described by standard sensor driver
+	struct SensorType {
+		/// Sensor type
+		uint8_t type;
+		/// Name
+		const char *name;
+		/// Short name
+		const char *shortName;
+		/// Unit
+		const char *unit;
+		/// Supported FRC commands
+		std::vector<uint8_t> frcs;
+	};
+
+	/**
+	 * Sensor types of standard sensor driver version 15
+	 *
+	 * Driver assigns timespan quantity to type 0x09 instead of 0x0A, type 0x0A is therefore unknown to the driver.
+	 */
+	static const std::vector<SensorType> SENSOR_V15_TYPES = {
+		{0x01, "Temperature", "T", "\xC2\xB0" "C", {SENSOR_FRC_1BYTE, SENSOR_FRC_2BYTES}},
+		{0x02, "Carbon dioxide", "CO2", "ppm", {SENSOR_FRC_1BYTE, SENSOR_FRC_2BYTES}},
+		{0x03, "Volatile organic compound", "VOC", "ppm", {SENSOR_FRC_1BYTE, SENSOR_FRC_2BYTES}},
+		{0x04, "Extra-low voltage", "U", "V", {SENSOR_FRC_2BYTES}},
+		{0x05, "Earth\xE2\x80\x99s magnetic field", "B", "T", {SENSOR_FRC_2BYTES}},
+		{0x06, "Low voltage", "U", "V", {SENSOR_FRC_2BYTES}},
+		{0x07, "Current", "I", "A", {SENSOR_FRC_2BYTES}},
+		{0x08, "Power", "E", "W", {SENSOR_FRC_2BYTES}},
+		{0x09, "Timespan", "t", "s", {SENSOR_FRC_2BYTES}},
+		{0x0B, "Illuminance", "Ev", "lx", {SENSOR_FRC_2BYTES}},
+		{0x0C, "Nitrogen dioxide", "NO2", "ppm", {SENSOR_FRC_2BYTES}},
+		{0x0D, "Sulfur dioxide", "SO2", "ppm", {SENSOR_FRC_2BYTES}},
+		{0x0E, "Carbon monoxide", "CO", "ppm", {SENSOR_FRC_2BYTES}},
+		{0x0F, "Ozone", "O3", "ppm", {SENSOR_FRC_2BYTES}},
+		{0x10, "Atmospheric pressure", "p", "hPa", {SENSOR_FRC_2BYTES}},
+		{0x11, "Color temperature", "Tc", "K", {SENSOR_FRC_2BYTES}},
+		{0x12, "Particulates PM2.5", "PM2.5", "\xCE\xBCg/m\xC2\xB3", {SENSOR_FRC_2BYTES}},
+		{0x13, "Sound pressure level", "Lp", "dB", {SENSOR_FRC_2BYTES}},
+		{0x80, "Relative humidity", "RH", "%", {SENSOR_FRC_1BYTE}},
+		{0x81, "Binary data7", "bin7", "?", {SENSOR_FRC_2BITS, SENSOR_FRC_1BYTE}},
+		{0x82, "Power factor", "cos \xCF\x86", "", {SENSOR_FRC_1BYTE}},
+		{0x83, "UV index", "UV", "", {SENSOR_FRC_1BYTE}},
+		{0xA0, "Binary data30", "bin30", "?", {SENSOR_FRC_2BYTES, SENSOR_FRC_4BYTES}},
+		{0xA1, "Consumption", "E", "Wh", {SENSOR_FRC_4BYTES}},
+		{0xA2, "DateTime", "DateTime", "", {SENSOR_FRC_4BYTES}},
+		{0xA3, "Timespan long", "t", "s", {SENSOR_FRC_4BYTES}},
+		{0xC0, "Data block", "datablock", "?", {}},
+	};
+
+	/**
+	 * Finds sensor type
+	 * @param type Sensor type
+	 * @return Sensor type description, nullptr if type is unknown to the driver
+	 */
+	static const SensorType *findSensorType(int64_t type) {
+		for (const auto &sensorType : SENSOR_V15_TYPES) {
+			if (sensorType.type == type) {
+				return &sensorType;
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Converts 16 bit unsigned value to signed value
+	 * @param value Unsigned value
+	 * @return Signed value
+	 */
+	static int uint16ToInt16(uint32_t value) {
+		return value < 0x8000 ? (int)value : (int)value - 0x10000;
+	}
+
+	/**
+	 * Parses JSON parameters
+	 * @param params Parameters
+	 * @param doc Parsed parameters
+	 * @return true if parameters are JSON object
+	 */
+	static bool parseParams(const std::string &params, json &doc) {
+		doc = json::parse(params, nullptr, false);
+		return doc.is_object();
+	}
+
+	/**
+	 * Returns integer member of JSON object
+	 * @param obj JSON object
+	 * @param key Member name
+	 * @param value Member value
+	 * @return true if member exists and is integer
+	 */
+	static bool getInteger(const json &obj, const char *key, int64_t &value) {
+		auto itr = obj.find(key);
+		if (itr == obj.end() || !itr->is_number_integer()) {
+			return false;
+		}
+		value = itr->get<int64_t>();
+		return true;
+	}
+
+	/**
+	 * Compares strings ignoring case of ASCII letters
+	 * @param str String
+	 * @param expected Expected lowercase string
+	 * @return true if strings are equal
+	 */
+	static bool equalsIgnoreCase(const std::string &str, const char *expected) {
+		size_t i = 0;
+		for (; i < str.size() && expected[i] != '\0'; ++i) {
+			char c = str[i];
+			if (c >= 'A' && c <= 'Z') {
+				c = static_cast<char>(c - 'A' + 'a');
+			}
+			if (c != expected[i]) {
+				return false;
+			}
+		}
+		return i == str.size() && expected[i] == '\0';
+	}
+
+	/**
+	 * Parses hexadecimal digit
+	 * @param c Character
+	 * @return Digit value, -1 if character is not hexadecimal digit
+	 */
+	static int hexDigit(char c) {
+		if (c >= '0' && c <= '9') {
+			return c - '0';
+		}
+		if (c >= 'a' && c <= 'f') {
+			return c - 'a' + 10;
+		}
+		if (c >= 'A' && c <= 'F') {
+			return c - 'A' + 10;
+		}
+		return -1;
+	}
+
+	/**
+	 * Checks DPA response and parses its data, mirrors iqrf.CheckResponsePnumPcmdDlen of library driver
+	 *
+	 * Only strictly well-formed responses are accepted, responses the library driver rejects or parses leniently
+	 * are left to the driver code.
+	 * @param response DPA response in raw-hdp format
+	 * @param pnum Expected lowercase PNUM
+	 * @param pcmds Accepted lowercase PCMDs
+	 * @param dlen Expected data length, negative number specifies minimum length, no check if empty
+	 * @param data Response data
+	 * @return true if response was accepted
+	 */
+	static bool checkResponse(const json &response, const char *pnum, std::initializer_list<const char *> pcmds, std::optional<int> dlen, std::vector<uint8_t> &data) {
+		if (!response.is_object()) {
+			return false;
+		}
+		auto rcode = response.find("rcode");
+		if (rcode == response.end() || !rcode->is_string() || rcode->get_ref<const std::string &>() != "00") {
+			return false;
+		}
+		auto rspPnum = response.find("pnum");
+		if (rspPnum == response.end() || !rspPnum->is_string() || !equalsIgnoreCase(rspPnum->get_ref<const std::string &>(), pnum)) {
+			return false;
+		}
+		auto rspPcmd = response.find("pcmd");
+		if (rspPcmd == response.end() || !rspPcmd->is_string()) {
+			return false;
+		}
+		bool pcmdFound = false;
+		for (const char *pcmd : pcmds) {
+			if (equalsIgnoreCase(rspPcmd->get_ref<const std::string &>(), pcmd)) {
+				pcmdFound = true;
+				break;
+			}
+		}
+		if (!pcmdFound) {
+			return false;
+		}
+		data.clear();
+		auto rdata = response.find("rdata");
+		if (rdata != response.end()) {
+			if (!rdata->is_string()) {
+				return false;
+			}
+			const std::string &str = rdata->get_ref<const std::string &>();
+			if (!str.empty()) {
+				// bytes separated by dots, each of exactly two hexadecimal digits
+				if (str.size() % 3 != 2) {
+					return false;
+				}
+				data.reserve(str.size() / 3 + 1);
+				for (size_t i = 0; i < str.size(); i += 3) {
+					int hi = hexDigit(str[i]);
+					int lo = hexDigit(str[i + 1]);
+					if (hi < 0 || lo < 0 || (i + 2 < str.size() && str[i + 2] != '.')) {
+						return false;
+					}
+					data.push_back(static_cast<uint8_t>(hi << 4 | lo));
+				}
+			}
+		}
+		if (!dlen.has_value()) {
+			return true;
+		}
+		if (*dlen >= 0) {
+			return data.size() == static_cast<size_t>(*dlen);
+		}
+		return data.size() >= static_cast<size_t>(-*dlen);
+	}
+
+	/**
+	 * Appends JSON string, escapes the characters JavaScript JSON.stringify escapes
+	 * @param out String to append to
+	 * @param str UTF-8 string
+	 */
+	static void appendJsonString(std::string &out, const char *str) {
+		static const char HEX[] = "0123456789abcdef";
+		out += '"';
+		for (const char *c = str; *c != '\0'; ++c) {
+			unsigned char uc = static_cast<unsigned char>(*c);
+			switch (uc) {
+				case '"':
+					out += "\\\"";
+					break;
+				case '\\':
+					out += "\\\\";
+					break;
+				case '\n':
+					out += "\\n";
+					break;
+				case '\r':
+					out += "\\r";
+					break;
+				case '\t':
+					out += "\\t";
+					break;
+				case '\b':
+					out += "\\b";
+					break;
+				case '\f':
+					out += "\\f";
+					break;
+				default:
+					if (uc < 0x20) {
+						out += "\\u00";
+						out += HEX[uc >> 4];
+						out += HEX[uc & 0x0F];
+					} else {
+						out += *c;
+					}
+			}
+		}
+		out += '"';
+	}
+
+	void NativeDrivers::appendJsonNumber(std::string &out, double value) {
+		if (!std::isfinite(value)) {
+			out += "null";
+			return;
+		}
+		if (value == 0) {
+			// also -0
+			out += '0';
+			return;
+		}
+		// shortest round trip digits, as in Number.prototype.toString
+		char buf[32];
+		auto result = std::to_chars(buf, buf + sizeof(buf), value, std::chars_format::scientific);
+		const char *ptr = buf;
+		if (*ptr == '-') {
+			out += '-';
+			++ptr;
+		}
+		std::string digits;
+		for (; ptr < result.ptr && *ptr != 'e'; ++ptr) {
+			if (*ptr != '.') {
+				digits += *ptr;
+			}
+		}
+		int exponent = 0;
+		std::from_chars(*(ptr + 1) == '+' ? ptr + 2 : ptr + 1, result.ptr, exponent);
+		int k = static_cast<int>(digits.size());
+		int n = exponent + 1;
+		if (k <= n && n <= 21) {
+			out += digits;
+			out.append(n - k, '0');
+		} else if (0 < n && n <= 21) {
+			out.append(digits, 0, n);
+			out += '.';
+			out.append(digits, n, std::string::npos);
+		} else if (-6 < n && n <= 0) {
+			out += "0.";
+			out.append(-n, '0');
+			out += digits;
+		} else {
+			out += digits[0];
+			if (k > 1) {
+				out += '.';
+				out.append(digits, 1, std::string::npos);
+			}
+			out += 'e';
+			out += n - 1 >= 0 ? '+' : '-';
+			out += std::to_string(std::abs(n - 1));
+		}
+	}
+
+	/**
+	 * Appends sensor object of standard sensor driver result
+	 * @param out String to append to
+	 * @param sensorType Sensor type
+	 * @param value Sensor value, nullptr if value is undefined
+	 * @param values Array sensor value, used if value is nullptr
+	 */
+	static void appendSensor(std::string &out, const SensorType &sensorType, const double *value, const std::vector<uint8_t> *values = nullptr) {
+		out += "{\"type\":";
+		out += std::to_string(sensorType.type);
+		out += ",\"name\":";
+		appendJsonString(out, sensorType.name);
+		out += ",\"shortName\":";
+		appendJsonString(out, sensorType.shortName);
+		if (value != nullptr) {
+			out += ",\"value\":";
+			NativeDrivers::appendJsonNumber(out, *value);
+		} else if (values != nullptr) {
+			out += ",\"value\":[";
+			for (size_t i = 0; i < values->size(); ++i) {
+				if (i > 0) {
+					out += ',';
+				}
+				out += std::to_string((*values)[i]);
+			}
+			out += ']';
+		}
+		out += ",\"unit\":";
+		appendJsonString(out, sensorType.unit);
+		out += '}';
+	}
+
+	bool NativeDrivers::sensorEnumerate(const std::string &params, std::string &ret) {
+		json doc;
+		std::vector<uint8_t> data;
+		if (!parseParams(params, doc) || !checkResponse(doc, "5e", {"be"}, -1, data)) {
+			return false;
+		}
+		std::string out = "{\"sensors\":[";
+		for (size_t i = 0; i < data.size(); ++i) {
+			const SensorType *sensorType = findSensorType(data[i]);
+			if (sensorType == nullptr) {
+				return false;
+			}
+			if (i > 0) {
+				out += ',';
+			}
+			out += "{\"type\":";
+			out += std::to_string(sensorType->type);
+			out += ",\"name\":";
+			appendJsonString(out, sensorType->name);
+			out += ",\"shortName\":";
+			appendJsonString(out, sensorType->shortName);
+			out += ",\"unit\":";
+			appendJsonString(out, sensorType->unit);
+			out += ",\"frcs\":[";
+			for (size_t j = 0; j < sensorType->frcs.size(); ++j) {
+				if (j > 0) {
+					out += ',';
+				}
+				out += std::to_string(sensorType->frcs[j]);
+			}
+			out += "]}";
+		}
+		out += "]}";
+		ret = std::move(out);
+		return true;
+	}
+
+	bool NativeDrivers::sensorReadSensorsWithTypes(const std::string &params, std::string &ret) {
+		json doc;
+		std::vector<uint8_t> data;
+		if (!parseParams(params, doc) || !checkResponse(doc, "5e", {"81"}, std::nullopt, data)) {
+			return false;
+		}
+		std::string out = "{\"sensors\":[";
+		bool first = true;
+		size_t index = 0;
+		while (index < data.size()) {
+			uint8_t type = data[index++];
+			const SensorType *sensorType = findSensorType(type);
+			if (sensorType == nullptr) {
+				return false;
+			}
+			size_t dataLength;
+			if ((type & 0x80) == 0) {
+				dataLength = 2;
+			} else if ((type & 0xE0) == 0x80) {
+				dataLength = 1;
+			} else if ((type & 0xE0) == 0xA0) {
+				dataLength = 4;
+			} else {
+				dataLength = index < data.size() ? data[index] + 1 : 1;
+			}
+			if (index + dataLength > data.size()) {
+				// driver decodes missing bytes as undefined
+				return false;
+			}
+			const uint8_t *bytes = data.data() + index;
+			uint32_t raw16 = bytes[0] | (dataLength >= 2 ? bytes[1] << 8 : 0);
+			uint32_t raw32 = dataLength == 4 ? raw16 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24 : 0;
+			double value = NOT_A_NUMBER;
+			switch (type) {
+				case 0x01:
+				case 0x06:
+					value = raw16 == 0x8000 ? NOT_A_NUMBER : uint16ToInt16(raw16) / 16.0;
+					break;
+				case 0x10:
+					value = raw16 == 0xFFFF ? NOT_A_NUMBER : raw16 / 16.0;
+					break;
+				case 0x02:
+				case 0x03:
+				case 0x11:
+					if (raw16 == 0x8000) {
+						// driver fails on misspelled variable
+						return false;
+					}
+					value = raw16;
+					break;
+				case 0x0B:
+					if (raw16 == 0xFFFF) {
+						// driver fails on misspelled variable
+						return false;
+					}
+					value = raw16;
+					break;
+				case 0x04:
+				case 0x07:
+					value = raw16 == 0x8000 ? NOT_A_NUMBER : uint16ToInt16(raw16) / 1000.0;
+					break;
+				case 0x09:
+				case 0x0C:
+				case 0x0D:
+					value = raw16 == 0xFFFF ? NOT_A_NUMBER : raw16 / 1000.0;
+					break;
+				case 0x05:
+					value = raw16 == 0x8000 ? NOT_A_NUMBER : uint16ToInt16(raw16) / 10000000.0;
+					break;
+				case 0x08:
+					value = raw16 == 0xFFFF ? NOT_A_NUMBER : raw16 / 4.0;
+					break;
+				case 0x0E:
+					value = raw16 == 0xFFFF ? NOT_A_NUMBER : raw16 / 100.0;
+					break;
+				case 0x0F:
+					value = raw16 == 0xFFFF ? NOT_A_NUMBER : raw16 / 10000.0;
+					break;
+				case 0x12:
+					value = raw16 == 0x8000 ? NOT_A_NUMBER : raw16 / 4.0;
+					break;
+				case 0x13:
+					value = raw16 == 0x8000 ? NOT_A_NUMBER : raw16 / 16.0;
+					break;
+				case 0x80:
+					value = bytes[0] == 0xEE ? NOT_A_NUMBER : bytes[0] / 2.0;
+					break;
+				case 0x81:
+					value = (bytes[0] & 0x80) != 0 ? NOT_A_NUMBER : bytes[0];
+					break;
+				case 0x82:
+					value = bytes[0] == 0xEE ? NOT_A_NUMBER : bytes[0] / 200.0;
+					break;
+				case 0x83:
+					value = bytes[0] == 0xFF ? NOT_A_NUMBER : bytes[0] / 8.0;
+					break;
+				case 0xA0:
+					value = (bytes[3] & 0x80) != 0 ? NOT_A_NUMBER : raw32;
+					break;
+				case 0xA1:
+				case 0xA2:
+					// error value is never detected by the driver
+					value = raw32;
+					break;
+				case 0xA3:
+					value = raw32 / 16.0;
+					break;
+				case 0xC0:
+					break;
+				default:
+					return false;
+			}
+			if (!first) {
+				out += ',';
+			}
+			first = false;
+			if (type == 0xC0) {
+				std::vector<uint8_t> block(bytes + 1, bytes + dataLength);
+				appendSensor(out, *sensorType, nullptr, &block);
+			} else {
+				appendSensor(out, *sensorType, &value);
+			}
+			index += dataLength;
+		}
+		out += "]}";
+		ret = std::move(out);
+		return true;
+	}
+
+	/**
+	 * Parses FRC values of nodes, mirrors iqrf.embed.frc.ParseResponses of embedded FRC driver
+	 * @param frcCommand FRC command
+	 * @param frcData FRC data with extra result appended
+	 * @return Non-zero FRC values by node index
+	 */
+	static std::map<size_t, uint32_t> parseFrcValues(uint8_t frcCommand, const std::vector<uint8_t> &frcData) {
+		std::map<size_t, uint32_t> result;
+		size_t length = frcData.size();
+		if (frcCommand <= 0x7F) {
+			for (size_t index = 1; index <= 239; ++index) {
+				uint8_t mask = static_cast<uint8_t>(1 << (index % 8));
+				size_t valueIndex = index / 8;
+				if (valueIndex + 32 >= length) {
+					break;
+				}
+				uint32_t frcValue = 0;
+				if ((frcData[valueIndex] & mask) != 0) {
+					frcValue = 0x01;
+				}
+				if ((frcData[valueIndex + 32] & mask) != 0) {
+					frcValue |= 0x02;
+				}
+				if (frcValue != 0) {
+					result[index] = frcValue;
+				}
+			}
+		} else if (frcCommand <= 0xDF) {
+			for (size_t index = 0; index < length; ++index) {
+				if (frcData[index] != 0) {
+					result[index] = frcData[index];
+				}
+			}
+		} else if (frcCommand <= 0xF7) {
+			for (size_t index = 2; index + 1 < length; index += 2) {
+				uint32_t frcValue = frcData[index] | frcData[index + 1] << 8;
+				if (frcValue != 0) {
+					result[index / 2] = frcValue;
+				}
+			}
+		} else {
+			for (size_t index = 4; index + 3 < length; index += 4) {
+				uint32_t frcValue = frcData[index] | frcData[index + 1] << 8 | frcData[index + 2] << 16 | (uint32_t)frcData[index + 3] << 24;
+				if (frcValue != 0) {
+					result[index / 4] = frcValue;
+				}
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * Decodes sensor FRC value, mirrors iqrf.sensor.Frc_Response of standard sensor driver version 15
+	 * @param type Sensor type
+	 * @param frcCommand FRC command supported by sensor type
+	 * @param frcValue Non-zero FRC value
+	 * @param defined Set to false if value is undefined
+	 * @param value Decoded value
+	 * @return true if value was decoded, false if driver fails or decodes value with a quirk
+	 */
+	static bool decodeFrcValue(uint8_t type, uint8_t frcCommand, uint32_t frcValue, bool &defined, double &value) {
+		defined = true;
+		if (frcValue == 1) {
+			defined = false;
+			return true;
+		}
+		if (frcCommand != SENSOR_FRC_2BITS) {
+			if (frcValue == 2) {
+				value = NOT_A_NUMBER;
+				return true;
+			}
+			if (frcValue == 3) {
+				return false;
+			}
+		}
+		double fv = frcValue;
+		switch (type) {
+			case 0x01:
+				if (frcCommand == SENSOR_FRC_1BYTE) {
+					value = (frcValue < 0x80 ? (int)frcValue : (int)frcValue - 0x100) / 2.0 - 22;
+				} else {
+					value = uint16ToInt16(frcValue ^ 0x8000) / 16.0;
+				}
+				return true;
+			case 0x06:
+				value = uint16ToInt16(frcValue ^ 0x8000) / 16.0;
+				return true;
+			case 0x10:
+			case 0x13:
+				value = (fv - 4) / 16.0;
+				return true;
+			case 0x02:
+			case 0x03:
+				value = frcCommand == SENSOR_FRC_1BYTE ? (fv - 4) * 16 : fv - 4;
+				return true;
+			case 0x11:
+			case 0x0B:
+				value = fv - 4;
+				return true;
+			case 0x04:
+			case 0x07:
+				value = uint16ToInt16(frcValue ^ 0x8000) / 1000.0;
+				return true;
+			case 0x09:
+			case 0x0C:
+			case 0x0D:
+				value = (fv - 4) / 1000.0;
+				return true;
+			case 0x05:
+				value = uint16ToInt16(frcValue ^ 0x8000) / 10000000.0;
+				return true;
+			case 0x08:
+			case 0x12:
+				value = (fv - 4) / 4.0;
+				return true;
+			case 0x0E:
+				value = (fv - 4) / 100.0;
+				return true;
+			case 0x0F:
+				value = (fv - 4) / 10000.0;
+				return true;
+			case 0x80:
+				value = (fv - 4) / 2.0;
+				return true;
+			case 0x81:
+				value = frcCommand == SENSOR_FRC_2BITS ? frcValue & 0x01 : fv - 4;
+				return true;
+			case 0x82:
+				value = (fv - 4) / 200.0;
+				return true;
+			case 0x83:
+				value = (fv - 4) / 8.0;
+				return true;
+			case 0xA0:
+				if (frcCommand != SENSOR_FRC_4BYTES) {
+					// driver reuses value of previous node
+					return false;
+				}
+				value = fv - 4;
+				return true;
+			default:
+				// decoding is not implemented by the driver
+				return false;
+		}
+	}
+
+	bool NativeDrivers::sensorFrc(const std::string &params, std::string &ret) {
+		json doc;
+		int64_t type = 0;
+		int64_t frcCommand = 0;
+		if (!parseParams(params, doc) || !getInteger(doc, "sensorType", type) || !getInteger(doc, "frcCommand", frcCommand)) {
+			return false;
+		}
+		const SensorType *sensorType = findSensorType(type);
+		if (sensorType == nullptr || frcCommand < 0 || frcCommand > 0xFF) {
+			return false;
+		}
+		uint8_t command = static_cast<uint8_t>(frcCommand);
+		if (std::find(sensorType->frcs.begin(), sensorType->frcs.end(), command) == sensorType->frcs.end()) {
+			return false;
+		}
+		auto send = doc.find("responseFrcSend");
+		std::vector<uint8_t> frcData;
+		if (send == doc.end() || !checkResponse(*send, "0d", {"80", "82"}, -2, frcData)) {
+			return false;
+		}
+		// skip FRC status
+		frcData.erase(frcData.begin());
+		auto extra = doc.find("responseFrcExtraResult");
+		if (extra != doc.end()) {
+			std::vector<uint8_t> extraData;
+			if (!checkResponse(*extra, "0d", {"81"}, -1, extraData)) {
+				return false;
+			}
+			frcData.insert(frcData.end(), extraData.begin(), extraData.end());
+		}
+		std::string out = "{\"sensors\":[";
+		size_t nextIndex = 0;
+		for (const auto &[index, frcValue] : parseFrcValues(command, frcData)) {
+			bool defined;
+			double value;
+			if (!decodeFrcValue(sensorType->type, command, frcValue, defined, value)) {
+				return false;
+			}
+			// nodes without value are array holes
+			for (; nextIndex < index; ++nextIndex) {
+				out += nextIndex > 0 ? ",null" : "null";
+			}
+			if (index > 0) {
+				out += ',';
+			}
+			appendSensor(out, *sensorType, defined ? &value : nullptr);
+			nextIndex = index + 1;
+		}
+		out += "]}";
+		ret = std::move(out);
+		return true;
+	}
+
+	bool NativeDrivers::binaryOutputEnumerate(const std::string &params, std::string &ret) {
+		json doc;
+		std::vector<uint8_t> data;
+		if (!parseParams(params, doc) || !checkResponse(doc, "4b", {"be"}, 1, data)) {
+			return false;
+		}
+		ret = "{\"binOuts\":" + std::to_string(data[0]) + "}";
+		return true;
+	}
+
+	bool NativeDrivers::binaryOutputSetOutput(const std::string &params, std::string &ret) {
+		json doc;
+		std::vector<uint8_t> data;
+		if (!parseParams(params, doc) || !checkResponse(doc, "4b", {"80"}, 4, data)) {
+			return false;
+		}
+		uint32_t bitmap = data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24;
+		std::string out = "{\"prevVals\":[";
+		for (int index = 0; index < 32; ++index) {
+			if (index > 0) {
+				out += ',';
+			}
+			out += (bitmap & (1u << index)) != 0 ? "true" : "false";
+		}
+		out += "]}";
+		ret = std::move(out);
+		return true;
+	}
+
+	/// Native functions requiring specific driver code
+	struct NativeFunctionSet {
+		/// Hashes of required driver code
+		std::vector<const char *> requiredHashes;
+		/// Native functions by driver function name
+		std::vector<std::pair<const char *, NativeDrivers::Function>> functions;
+	};
+
+	std::shared_ptr<const NativeDrivers::FunctionMap> NativeDrivers::select(const std::set<std::string> &driverHashes) {
+		static const std::vector<NativeFunctionSet> functionSets = {
+			{
+				{LIBRARY_V0_HASH, SENSOR_V15_HASH, DAEMON_WRAPPER_HASH},
+				{
+					{"iqrf.sensor.Enumerate_Response_rsp", &NativeDrivers::sensorEnumerate},
+					{"iqrf.sensor.ReadSensorsWithTypes_Response_rsp", &NativeDrivers::sensorReadSensorsWithTypes},
+				}
+			},
+			{
+				{LIBRARY_V0_HASH, EMBED_FRC_V0_HASH, SENSOR_V15_HASH, DAEMON_WRAPPER_HASH},
+				{
+					{"iqrf.sensor.Frc_Response_rsp", &NativeDrivers::sensorFrc},
+				}
+			},
+			{
+				{LIBRARY_V0_HASH, BINARY_OUTPUT_V4_HASH, DAEMON_WRAPPER_HASH},
+				{
+					{"iqrf.binaryoutput.Enumerate_Response_rsp", &NativeDrivers::binaryOutputEnumerate},
+					{"iqrf.binaryoutput.SetOutput_Response_rsp", &NativeDrivers::binaryOutputSetOutput},
+				}
+			},
+		};
+		auto functions = std::make_shared<FunctionMap>();
+		for (const auto &functionSet : functionSets) {
+			bool matches = std::all_of(functionSet.requiredHashes.begin(), functionSet.requiredHashes.end(), [&](const char *hash) {
+				return driverHashes.count(hash) > 0;
+			});
+			if (matches) {
+				functions->insert(functionSet.functions.begin(), functionSet.functions.end());
+			}
+		}
+		return functions;
+	}
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+namespace iqrf {
+	/**
+	 * Native implementations of hot standard driver functions
+	 *
+	 * Each function reproduces the JSON result of a specific driver code, identified by SHA-256 hash of the code,
+	 * byte for byte. A function declines calls it cannot reproduce exactly, i.e. calls the driver code would fail
+	 * on or decode with a driver specific quirk, such calls are left to the driver code.
+	 */
+	class NativeDrivers {
+	public:
+		/**
+		 * Native driver function
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @return true if call was handled, false if call has to be handled by driver code
+		 */
+		typedef bool (*Function)(const std::string &params, std::string &ret);
+
+		/// Native functions by driver function name
+		typedef std::unordered_map<std::string, Function> FunctionMap;
+
+		/// Hash of library driver version 0
+		static const char *LIBRARY_V0_HASH;
+		/// Hash of embedded FRC peripheral driver version 0
+		static const char *EMBED_FRC_V0_HASH;
+		/// Hash of standard sensor driver version 15
+		static const char *SENSOR_V15_HASH;
+		/// Hash of standard binary output driver version 4
+		static const char *BINARY_OUTPUT_V4_HASH;
+		/// Hash of daemon wrapper
+		static const char *DAEMON_WRAPPER_HASH;
+
+		/**
+		 * Selects native functions matching driver code loaded in a context
+		 * @param driverHashes Hashes of all driver code loaded in the context
+		 * @return Native functions, empty if there is no native function for loaded drivers
+		 */
+		static std::shared_ptr<const FunctionMap> select(const std::set<std::string> &driverHashes);
+
+		/**
+		 * Native iqrf.sensor.Enumerate_Response_rsp
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @return true if call was handled
+		 */
+		static bool sensorEnumerate(const std::string &params, std::string &ret);
+
+		/**
+		 * Native iqrf.sensor.ReadSensorsWithTypes_Response_rsp
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @return true if call was handled
+		 */
+		static bool sensorReadSensorsWithTypes(const std::string &params, std::string &ret);
+
+		/**
+		 * Native iqrf.sensor.Frc_Response_rsp
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @return true if call was handled
+		 */
+		static bool sensorFrc(const std::string &params, std::string &ret);
+
+		/**
+		 * Native iqrf.binaryoutput.Enumerate_Response_rsp
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @return true if call was handled
+		 */
+		static bool binaryOutputEnumerate(const std::string &params, std::string &ret);
+
+		/**
+		 * Native iqrf.binaryoutput.SetOutput_Response_rsp
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @return true if call was handled
+		 */
+		static bool binaryOutputSetOutput(const std::string &params, std::string &ret);
+
+		/**
+		 * Appends number formatted the way JavaScript JSON.stringify formats it
+		 * @param out String to append to
+		 * @param value Number, NaN and infinities are formatted as null
+		 */
+		static void appendJsonNumber(std::string &out, double value);
+	};
+}
@@ -0,0 +1,302 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuickJsContext.h"
+#include "DpaPerExceptions.h"
+#include "StringUtils.h"
+
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+namespace iqrf {
+
+	namespace {
+		/**
+		 * Frees value when leaving scope
+		 */
+		class ScopedValue {
+		public:
+			/**
+			 * Constructor
+			 * @param ctx Context of value
+			 * @param value Value to free
+			 */
+			ScopedValue(JSContext *ctx, JSValue value) : m_ctx(ctx), m_value(value) {}
+
+			/**
+			 * Destructor
+			 */
+			~ScopedValue() {
+				JS_FreeValue(m_ctx, m_value);
+			}
+
+			ScopedValue(const ScopedValue &) = delete;
+			ScopedValue &operator=(const ScopedValue &) = delete;
+
+			/**
+			 * Returns guarded value
+			 * @return Value
+			 */
+			JSValue get() const {
+				return m_value;
+			}
+		private:
+			/// Context of value
+			JSContext *m_ctx;
+			/// Guarded value
+			JSValue m_value;
+		};
+	}
+
+	QuickJsContext::QuickJsContext(size_t heapLimit) : m_heapLimit(heapLimit) {
+		m_rt = JS_NewRuntime();
+		if (m_rt == nullptr) {
+			std::cerr << "Failed to create a QuickJS runtime." << std::endl;
+			throw std::logic_error("Failed to create a QuickJS runtime.\n");
+		}
+		if (m_heapLimit > 0) {
+			// unlike Duktape heap, the limit covers loaded driver code as well
+			JS_SetMemoryLimit(m_rt, m_heapLimit);
+		}
+		m_ctx = JS_NewContext(m_rt);
+		if (m_ctx == nullptr) {
+			JS_FreeRuntime(m_rt);
+			std::cerr << "Failed to create a QuickJS context." << std::endl;
+			throw std::logic_error("Failed to create a QuickJS context.\n");
+		}
+	}
+
+	QuickJsContext::~QuickJsContext() {
+		releaseFunctions();
+		JS_FreeContext(m_ctx);
+		JS_FreeRuntime(m_rt);
+	}
+
+	size_t QuickJsContext::getHeapSize() const {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		JSMemoryUsage usage;
+		JS_ComputeMemoryUsage(m_rt, &usage);
+		return static_cast<size_t>(usage.memory_used_size);
+	}
+
+	JsEngineContext::MemoryStats QuickJsContext::getMemoryStats() const {
+		MemoryStats stats;
+		{
+			std::lock_guard<std::mutex> lck(m_mtx);
+			JSMemoryUsage usage;
+			JS_ComputeMemoryUsage(m_rt, &usage);
+			stats.liveBytes = static_cast<size_t>(usage.memory_used_size);
+			stats.reservedBytes = static_cast<size_t>(usage.malloc_size);
+		}
+		stats.peakBytes = updatePeak(stats.liveBytes);
+		stats.limitBytes = m_heapLimit;
+		stats.limitHits = m_limitHits.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	void QuickJsContext::loadCode(const std::string &js, std::vector<char> *bytecode) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		JSValue compiled = JS_Eval(m_ctx, js.c_str(), js.length(), "drivers", JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+		if (JS_IsException(compiled)) {
+			std::string errstr = takeException();
+			std::cerr << "Error in driver scripts: " << errstr << std::endl;
+			throw std::logic_error(errstr);
+		}
+		if (bytecode != nullptr) {
+			size_t size = 0;
+			uint8_t *buffer = JS_WriteObject(m_ctx, &size, compiled, JS_WRITE_OBJ_BYTECODE);
+			if (buffer == nullptr) {
+				JS_FreeValue(m_ctx, compiled);
+				throw std::logic_error("Failed to store driver bytecode: " + takeException());
+			}
+			bytecode->assign(reinterpret_cast<const char *>(buffer), reinterpret_cast<const char *>(buffer) + size);
+			js_free(m_ctx, buffer);
+		}
+		runCode(compiled);
+	}
+
+	void QuickJsContext::loadBytecode(const std::vector<char> &bytecode) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		// bytecode is not validated by QuickJS, callers are responsible for its integrity
+		JSValue compiled = JS_ReadObject(m_ctx, reinterpret_cast<const uint8_t *>(bytecode.data()), bytecode.size(), JS_READ_OBJ_BYTECODE);
+		if (JS_IsException(compiled)) {
+			throw std::logic_error("Failed to load driver bytecode: " + takeException());
+		}
+		runCode(compiled);
+	}
+
+	void QuickJsContext::runCode(JSValue compiled) {
+		JSValue result = JS_EvalFunction(m_ctx, compiled);
+		if (JS_IsException(result)) {
+			std::string errstr = takeException();
+			std::cerr << "Error in driver scripts: " << errstr << std::endl;
+			throw std::logic_error(errstr);
+		}
+		JS_FreeValue(m_ctx, result);
+		// functions resolved from previous code are stale
+		releaseFunctions();
+		JSMemoryUsage usage;
+		JS_ComputeMemoryUsage(m_rt, &usage);
+		updatePeak(static_cast<size_t>(usage.memory_used_size));
+	}
+
+	JSValue QuickJsContext::findFunction(const std::string &name) {
+		auto pos = name.find_last_of('.');
+		if (pos == std::string::npos) {
+			throw std::logic_error("Invalid namespace and function format: " + name);
+		}
+		std::string ns = name.substr(0, pos);
+		std::string object = name.substr(pos + 1);
+		JSValue current = JS_GetGlobalObject(m_ctx);
+		for (const auto &item : StringUtils::split(ns, ".")) {
+			JSValue next = JS_GetPropertyStr(m_ctx, current, item.c_str());
+			JS_FreeValue(m_ctx, current);
+			if (JS_IsException(next)) {
+				throw std::logic_error(takeException());
+			}
+			if (JS_IsUndefined(next)) {
+				throw PeripheralException("Peripheral " + item + " namespace not found.");
+			}
+			current = next;
+		}
+		ScopedValue parent(m_ctx, current);
+		if (StringUtils::endsWith(object, "_req") || StringUtils::endsWith(object, "_rsp")) {
+			std::string fn = object.substr(0, object.length() - 4);
+			ScopedValue command(m_ctx, JS_GetPropertyStr(m_ctx, parent.get(), fn.c_str()));
+			if (JS_IsException(command.get())) {
+				throw std::logic_error(takeException());
+			}
+			if (JS_IsUndefined(command.get())) {
+				throw PeripheralCommandException("Peripheral " + ns + " namespace object " + fn + " not found.");
+			}
+		}
+		JSValue function = JS_GetPropertyStr(m_ctx, parent.get(), object.c_str());
+		if (JS_IsException(function)) {
+			throw std::logic_error(takeException());
+		}
+		if (JS_IsUndefined(function)) {
+			throw std::logic_error("Cannot find driver function: " + ns + '.' + object);
+		}
+		return function;
+	}
+
+	JSValue QuickJsContext::getFunction(int handle, const std::string &name) {
+		if (handle < 0) {
+			throw std::logic_error("Invalid function handle: " + std::to_string(handle));
+		}
+		size_t index = static_cast<size_t>(handle);
+		if (index < m_functions.size() && !JS_IsUndefined(m_functions[index])) {
+			return m_functions[index];
+		}
+		JSValue function = findFunction(name);
+		if (index >= m_functions.size()) {
+			m_functions.resize(index + 1, JS_UNDEFINED);
+		}
+		m_functions[index] = function;
+		return function;
+	}
+
+	void QuickJsContext::releaseFunctions() {
+		for (auto &function : m_functions) {
+			JS_FreeValue(m_ctx, function);
+		}
+		m_functions.clear();
+	}
+
+	void QuickJsContext::callFunction(const std::string &name, const std::string &params, std::string &ret) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		ScopedValue function(m_ctx, findFunction(name));
+		callJson(function.get(), params, ret);
+	}
+
+	void QuickJsContext::callFunction(int handle, const std::string &name, const std::string &params, std::string &ret) {
+		std::lock_guard<std::mutex> lck(m_mtx);
+		callJson(getFunction(handle, name), params, ret);
+	}
+
+	void QuickJsContext::callFunction(int handle, const std::string &name, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) {
+		rapidjson::StringBuffer buffer;
+		rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+		params.Accept(writer);
+		std::string result;
+		{
+			std::lock_guard<std::mutex> lck(m_mtx);
+			callJson(getFunction(handle, name), buffer.GetString(), result);
+		}
+		rapidjson::Document doc(&allocator);
+		doc.Parse(result);
+		if (doc.HasParseError()) {
+			throw std::logic_error("Invalid result of driver function: " + name);
+		}
+		ret = static_cast<rapidjson::Value &>(doc);
+	}
+
+	void QuickJsContext::callJson(JSValue function, const std::string &params, std::string &ret) {
+		// parser requires terminated input, std::string provides it
+		ScopedValue arg(m_ctx, JS_ParseJSON(m_ctx, params.c_str(), params.length(), "params"));
+		if (JS_IsException(arg.get())) {
+			throw std::logic_error(takeException());
+		}
+		JSValue argv[] = {arg.get()};
+		ScopedValue result(m_ctx, JS_Call(m_ctx, function, JS_UNDEFINED, 1, argv));
+		if (JS_IsException(result.get())) {
+			throw std::logic_error(takeException());
+		}
+		ScopedValue json(m_ctx, JS_JSONStringify(m_ctx, result.get(), JS_UNDEFINED, JS_UNDEFINED));
+		if (JS_IsException(json.get())) {
+			throw std::logic_error(takeException());
+		}
+		if (JS_IsUndefined(json.get())) {
+			// functions and undefined have no JSON text
+			ret = "null";
+		} else {
+			size_t length = 0;
+			const char *str = JS_ToCStringLen(m_ctx, &length, json.get());
+			if (str == nullptr) {
+				throw std::logic_error(takeException());
+			}
+			ret.assign(str, length);
+			JS_FreeCString(m_ctx, str);
+		}
+	}
+
+	std::string QuickJsContext::takeException() {
+		JSValue exception = JS_GetException(m_ctx);
+		std::string message = "Unknown error";
+		const char *str = JS_ToCString(m_ctx, exception);
+		if (str != nullptr) {
+			message = str;
+			JS_FreeCString(m_ctx, str);
+		}
+		JS_FreeValue(m_ctx, exception);
+		if (m_heapLimit > 0 && message.find("out of memory") != std::string::npos) {
+			m_limitHits.fetch_add(1, std::memory_order_relaxed);
+		}
+		return message;
+	}
+
+	size_t QuickJsContext::updatePeak(size_t live) const {
+		size_t peak = m_peakBytes.load(std::memory_order_relaxed);
+		while (live > peak && !m_peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+		}
+		return std::max(peak, live);
+	}
+}
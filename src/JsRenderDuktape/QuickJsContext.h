@@ -0,0 +1,169 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "JsEngineContext.h"
+#include "quickjs.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace iqrf {
+	/**
+	 * QuickJS driver context
+	 *
+	 * Each context owns a QuickJS runtime, runtimes are not thread safe and calls to the same context are
+	 * serialized by context mutex. Different contexts can be used concurrently.
+	 */
+	class QuickJsContext : public JsEngineContext {
+	public:
+		/**
+		 * Constructor
+		 * @param heapLimit Limit of memory allocated by runtime in bytes, 0 for unlimited
+		 */
+		explicit QuickJsContext(size_t heapLimit = 0);
+
+		/**
+		 * Destructor
+		 */
+		~QuickJsContext() override;
+
+		QuickJsContext(const QuickJsContext &) = delete;
+		QuickJsContext &operator=(const QuickJsContext &) = delete;
+
+		/**
+		 * Loads code to context runtime
+		 * @param js JavaScript code to load
+		 * @param bytecode If not null, compiled code bytecode is stored here
+		 */
+		void loadCode(const std::string &js, std::vector<char> *bytecode = nullptr) override;
+
+		/**
+		 * Loads code compiled by loadCode to context runtime
+		 * @param bytecode Compiled code bytecode
+		 */
+		void loadBytecode(const std::vector<char> &bytecode) override;
+
+		/**
+		 * Returns memory allocated by context runtime
+		 *
+		 * QuickJS computes the usage by walking the runtime, the call is not as cheap as with Duktape heap.
+		 * @return Allocated bytes
+		 */
+		size_t getHeapSize() const override;
+
+		/**
+		 * Returns memory statistics of context runtime
+		 * @return Memory statistics
+		 */
+		MemoryStats getMemoryStats() const override;
+
+		/**
+		 * Call context function
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 */
+		void callFunction(const std::string &name, const std::string &params, std::string &ret) override;
+
+		/**
+		 * Call context function by handle
+		 * @param handle Function handle, small non-negative integer unique for function name
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 */
+		void callFunction(int handle, const std::string &name, const std::string &params, std::string &ret) override;
+
+		/**
+		 * Call context function by handle, parameters and result are passed as values
+		 *
+		 * Values are passed through JSON text, QuickJS parses and serializes JSON natively.
+		 * @param handle Function handle, small non-negative integer unique for function name
+		 * @param name Function name
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 * @param allocator Allocator of return value
+		 */
+		void callFunction(int handle, const std::string &name, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) override;
+	private:
+		/**
+		 * Runs compiled code and releases functions resolved from previous code
+		 * @param compiled Compiled code, freed by the call
+		 */
+		void runCode(JSValue compiled);
+
+		/**
+		 * Finds function by name
+		 * @param name Function name
+		 * @return Function, to be freed by caller
+		 */
+		JSValue findFunction(const std::string &name);
+
+		/**
+		 * Returns function stored by handle, function is found by name and stored on the first call
+		 * @param handle Function handle
+		 * @param name Function name
+		 * @return Function owned by context
+		 */
+		JSValue getFunction(int handle, const std::string &name);
+
+		/**
+		 * Calls function with parameters in JSON text
+		 * @param function Function to call
+		 * @param params Function parameters
+		 * @param ret Return value to store
+		 */
+		void callJson(JSValue function, const std::string &params, std::string &ret);
+
+		/**
+		 * Releases functions resolved by handle
+		 */
+		void releaseFunctions();
+
+		/**
+		 * Takes pending exception and returns its message
+		 * @return Exception message
+		 */
+		std::string takeException();
+
+		/**
+		 * Updates peak memory statistics
+		 * @param live Memory used by runtime now
+		 * @return Peak memory used by runtime
+		 */
+		size_t updatePeak(size_t live) const;
+
+		/// Context runtime mutex
+		mutable std::mutex m_mtx;
+		/// Memory limit of runtime, 0 if unlimited
+		const size_t m_heapLimit;
+		/// Context runtime
+		JSRuntime *m_rt = nullptr;
+		/// Context of runtime
+		JSContext *m_ctx = nullptr;
+		/// Functions resolved by handle, undefined if not resolved yet
+		std::vector<JSValue> m_functions;
+		/// Maximal memory used by runtime, sampled on code load and statistics query
+		mutable std::atomic<size_t> m_peakBytes{0};
+		/// Calls failed on memory limit
+		std::atomic<size_t> m_limitHits{0};
+	};
+}
@@ -107,58 +107,84 @@ namespace iqrf {
 		rapidjson::Document response;
 		std::unique_ptr<BaseMsg> msg;
 
-		if (msgType.m_type == "iqrfDb_Enumerate") {
-			std::unique_lock<std::mutex> lock(m_enumerateMutex);
-			if (m_enumerateMsg) {
-				sendEnumerationErrorResponse(
-					messaging,
-					IIqrfDb::EnumerationError::Errors::AlreadyRunning,
-					std::move(request)
-				);
-			} else {
-				m_enumerateMsg = std::make_unique<EnumerateMsg>(EnumerateMsg(request));
-				m_enumerateMsg->setMessaging(messaging);
-				m_enumerateMsg->handleMsg(m_dbService);
+		using MsgType = IMessagingSplitterService::MsgType;
+		switch (msgType.m_typeHash) {
+			case MsgType::hash("iqrfDb_Enumerate"): {
+				std::unique_lock<std::mutex> lock(m_enumerateMutex);
+				if (m_enumerateMsg) {
+					sendEnumerationErrorResponse(
+						messaging,
+						IIqrfDb::EnumerationError::Errors::AlreadyRunning,
+						std::move(request)
+					);
+				} else {
+					m_enumerateMsg = std::make_unique<EnumerateMsg>(EnumerateMsg(request));
+					m_enumerateMsg->setMessaging(messaging);
+					m_enumerateMsg->handleMsg(m_dbService);
+				}
+				return;
 			}
-			return;
-		} else if (msgType.m_type == "infoDaemon_Enumeration") {
-			msg = std::make_unique<LegacyEnumerateMsg>(LegacyEnumerateMsg(request));
-		} else if (msgType.m_type == "iqrfDb_GetBinaryOutputs") {
-			msg = std::make_unique<GetBinaryOutputsMsg>(GetBinaryOutputsMsg(request));
-		} else if (msgType.m_type == "iqrfDb_GetDevice") {
-			msg = std::make_unique<GetDeviceMsg>(GetDeviceMsg(request));
-		} else if (msgType.m_type == "iqrfDb_GetDevices") {
-			msg = std::make_unique<GetDevicesMsg>(GetDevicesMsg(request));
-		} else if (msgType.m_type == "iqrfDb_GetNetworkTopology") {
-			msg = std::make_unique<GetNetworkTopologyMsg>(GetNetworkTopologyMsg(request));
-		} else if (msgType.m_type == "iqrfDb_GetLights") {
-			msg = std::make_unique<GetLightsMsg>(GetLightsMsg(request));
-		} else if (msgType.m_type == "iqrfDb_GetSensors") {
-			msg = std::make_unique<GetSensorsMsg>(GetSensorsMsg(request));
-		} else if (msgType.m_type == "iqrfDb_GetDeviceMetadata") {
-			msg = std::make_unique<GetDeviceMetadataMsg>(GetDeviceMetadataMsg(request));
-		} else if (msgType.m_type == "iqrfDb_MetadataAnnotation" || msgType.m_type == "infoDaemon_MidMetaDataAnnotate") {
-			msg = std::make_unique<MetadataAnnotation>(MetadataAnnotation(request));
-		} else if (msgType.m_type == "iqrfDb_SetDeviceMetadata") {
-			msg = std::make_unique<SetDeviceMetadataMsg>(SetDeviceMetadataMsg(request));
-		} else if (msgType.m_type == "iqrfDb_Reset" || msgType.m_type == "infoDaemon_Reset") { // Legacy API messages
-			msg = std::make_unique<ResetMsg>(ResetMsg(request));
-		} else if (msgType.m_type == "infoDaemon_GetBinaryOutputs") {
-			msg = std::make_unique<LegacyGetBinaryOutputsMsg>(LegacyGetBinaryOutputsMsg(request));
-		} else if (msgType.m_type == "infoDaemon_GetLights") {
-			msg = std::make_unique<LegacyGetLightsMsg>(LegacyGetLightsMsg(request));
-		} else if (msgType.m_type == "infoDaemon_GetMidMetaData") {
-			msg = std::make_unique<LegacyGetMidMetaDataMsg>(LegacyGetMidMetaDataMsg(request));
-		} else if (msgType.m_type == "infoDaemon_GetNodeMetaData") {
-			msg = std::make_unique<LegacyGetNodeMetaDataMsg>(LegacyGetNodeMetaDataMsg(request));
-		} else if (msgType.m_type == "infoDaemon_GetNodes") {
-			msg = std::make_unique<LegacyGetNodesMsg>(LegacyGetNodesMsg(request));
-		} else if (msgType.m_type == "infoDaemon_GetSensors") {
-			msg = std::make_unique<LegacyGetSensorsMsg>(LegacyGetSensorsMsg(request, m_cacheService));
-		} else if (msgType.m_type == "infoDaemon_SetMidMetaData") {
-			msg = std::make_unique<LegacySetMidMetaDataMsg>(LegacySetMidMetaDataMsg(request));
-		} else if (msgType.m_type == "infoDaemon_SetNodeMetaData") {
-			msg = std::make_unique<LegacySetNodeMetaDataMsg>(LegacySetNodeMetaDataMsg(request));
+			case MsgType::hash("infoDaemon_Enumeration"):
+				msg = std::make_unique<LegacyEnumerateMsg>(LegacyEnumerateMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_GetBinaryOutputs"):
+				msg = std::make_unique<GetBinaryOutputsMsg>(GetBinaryOutputsMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_GetDevice"):
+				msg = std::make_unique<GetDeviceMsg>(GetDeviceMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_GetDevices"):
+				msg = std::make_unique<GetDevicesMsg>(GetDevicesMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_GetNetworkTopology"):
+				msg = std::make_unique<GetNetworkTopologyMsg>(GetNetworkTopologyMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_GetLights"):
+				msg = std::make_unique<GetLightsMsg>(GetLightsMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_GetSensors"):
+				msg = std::make_unique<GetSensorsMsg>(GetSensorsMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_GetDeviceMetadata"):
+				msg = std::make_unique<GetDeviceMetadataMsg>(GetDeviceMetadataMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_MetadataAnnotation"):
+			case MsgType::hash("infoDaemon_MidMetaDataAnnotate"):
+				msg = std::make_unique<MetadataAnnotation>(MetadataAnnotation(request));
+				break;
+			case MsgType::hash("iqrfDb_SetDeviceMetadata"):
+				msg = std::make_unique<SetDeviceMetadataMsg>(SetDeviceMetadataMsg(request));
+				break;
+			case MsgType::hash("iqrfDb_Reset"):
+			case MsgType::hash("infoDaemon_Reset"): // Legacy API messages
+				msg = std::make_unique<ResetMsg>(ResetMsg(request));
+				break;
+			case MsgType::hash("infoDaemon_GetBinaryOutputs"):
+				msg = std::make_unique<LegacyGetBinaryOutputsMsg>(LegacyGetBinaryOutputsMsg(request));
+				break;
+			case MsgType::hash("infoDaemon_GetLights"):
+				msg = std::make_unique<LegacyGetLightsMsg>(LegacyGetLightsMsg(request));
+				break;
+			case MsgType::hash("infoDaemon_GetMidMetaData"):
+				msg = std::make_unique<LegacyGetMidMetaDataMsg>(LegacyGetMidMetaDataMsg(request));
+				break;
+			case MsgType::hash("infoDaemon_GetNodeMetaData"):
+				msg = std::make_unique<LegacyGetNodeMetaDataMsg>(LegacyGetNodeMetaDataMsg(request));
+				break;
+			case MsgType::hash("infoDaemon_GetNodes"):
+				msg = std::make_unique<LegacyGetNodesMsg>(LegacyGetNodesMsg(request));
+				break;
+			case MsgType::hash("infoDaemon_GetSensors"):
+				msg = std::make_unique<LegacyGetSensorsMsg>(LegacyGetSensorsMsg(request, m_cacheService));
+				break;
+			case MsgType::hash("infoDaemon_SetMidMetaData"):
+				msg = std::make_unique<LegacySetMidMetaDataMsg>(LegacySetMidMetaDataMsg(request));
+				break;
+			case MsgType::hash("infoDaemon_SetNodeMetaData"):
+				msg = std::make_unique<LegacySetNodeMetaDataMsg>(LegacySetNodeMetaDataMsg(request));
+				break;
+			default:
+				break;
 		}
 
 		try {
@@ -29,6 +29,7 @@
 
 #include "Messages/MngBaseMsg.h"
 #include "Messages/MngExitMsg.h"
+#include "Messages/MngJsProfileMsg.h"
 #include "Messages/MngModeMsg.h"
 #include "Messages/MngUpdateCacheMsg.h"
 #include "Messages/MngVersionMsg.h"
@@ -70,6 +71,8 @@ namespace iqrf {
 		IMessagingSplitterService *m_iMessagingSplitterService = nullptr;
 		/// JsCache service
 		IJsCacheService *m_cacheService = nullptr;
+		/// JsRender service
+		IJsRenderService *m_renderService = nullptr;
 		/// UDP service
 		IUdpConnectorService *m_iUdpConnectorService = nullptr;
 		/// API message filters
@@ -95,6 +98,8 @@ namespace iqrf {
 			std::unique_ptr<MngBaseMsg> msg;
 			if (msgType.m_type == "mngDaemon_Exit") {
 				msg = std::make_unique<MngExitMsg>(MngExitMsg(doc, m_iSchedulerService));
+			} else if (msgType.m_type == "mngDaemon_JsProfile") {
+				msg = std::make_unique<MngJsProfileMsg>(MngJsProfileMsg(doc, m_renderService));
 			} else if (msgType.m_type == "mngDaemon_Mode") {
 				msg = std::make_unique<MngModeMsg>(MngModeMsg(doc, m_iUdpConnectorService));
 			} else if (msgType.m_type == "mngDaemon_UpdateCache") {
@@ -232,6 +237,16 @@ namespace iqrf {
 			}
 		}
 
+		void attachInterface(IJsRenderService *iface) {
+			m_renderService = iface;
+		}
+
+		void detachInterface(IJsRenderService *iface) {
+			if (m_renderService == iface) {
+				m_renderService = nullptr;
+			}
+		}
+
 		void attachInterface(IUdpConnectorService *iface) {
 			m_iUdpConnectorService = iface;
 		}
@@ -324,6 +339,14 @@ namespace iqrf {
 		m_imp->detachInterface(iface);
 	}
 
+	void JsonMngApi::attachInterface(IJsRenderService *iface) {
+		m_imp->attachInterface(iface);
+	}
+
+	void JsonMngApi::detachInterface(IJsRenderService *iface) {
+		m_imp->detachInterface(iface);
+	}
+
 	void JsonMngApi::attachInterface(IUdpConnectorService *iface) {
 		m_imp->attachInterface(iface);
 	}
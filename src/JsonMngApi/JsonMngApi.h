@@ -21,6 +21,7 @@
 #include "IIqrfDb.h"
 #include "ISchedulerService.h"
 #include "IJsCacheService.h"
+#include "IJsRenderService.h"
 #include "IUdpConnectorService.h"
 #include "IMessagingSplitterService.h"
 #include "ShapeProperties.h"
@@ -52,6 +53,9 @@ namespace iqrf {
 		void attachInterface(IJsCacheService *iface);
 		void detachInterface(IJsCacheService *iface);
 
+		void attachInterface(IJsRenderService *iface);
+		void detachInterface(IJsRenderService *iface);
+
 		void attachInterface(IUdpConnectorService *iface);
 		void detachInterface(IUdpConnectorService *iface);
 
@@ -0,0 +1,72 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "MngJsProfileMsg.h"
+
+namespace iqrf {
+
+	MngJsProfileMsg::MngJsProfileMsg(const Document &doc, IJsRenderService *renderService) : MngBaseMsg(doc) {
+		m_renderService = renderService;
+		const Value *val = Pointer("/data/req/enable").Get(doc);
+		if (val != nullptr && val->IsBool()) {
+			m_setEnabled = true;
+			m_enable = val->GetBool();
+		}
+		val = Pointer("/data/req/reset").Get(doc);
+		if (val != nullptr && val->IsBool()) {
+			m_reset = val->GetBool();
+		}
+	}
+
+	void MngJsProfileMsg::handleMsg() {
+		if (!m_renderService) {
+			throw std::logic_error("JsRenderService not active.");
+		}
+		// profile collected so far is returned before it is cleared
+		m_profile = m_renderService->getProfile();
+		if (m_reset) {
+			m_renderService->resetProfile();
+		}
+		if (m_setEnabled) {
+			m_renderService->setProfiling(m_enable);
+		}
+		m_enabled = m_renderService->isProfiling();
+	}
+
+	void MngJsProfileMsg::createResponsePayload(Document &doc) {
+		if (getStatus() == 0) {
+			auto &allocator = doc.GetAllocator();
+			Value functions(kArrayType);
+			for (const auto &[contextId, contextProfile] : m_profile) {
+				for (const auto &[name, profile] : contextProfile) {
+					Value function(kObjectType);
+					function.AddMember("contextId", contextId, allocator);
+					function.AddMember("function", Value(name.c_str(), allocator), allocator);
+					function.AddMember("calls", profile.calls, allocator);
+					function.AddMember("errors", profile.errors, allocator);
+					function.AddMember("totalTimeNs", profile.totalTimeNs, allocator);
+					function.AddMember("maxTimeNs", profile.maxTimeNs, allocator);
+					function.AddMember("heapGrowthBytes", profile.heapGrowthBytes, allocator);
+					function.AddMember("maxHeapGrowthBytes", profile.maxHeapGrowthBytes, allocator);
+					functions.PushBack(function, allocator);
+				}
+			}
+			Pointer("/data/rsp/enabled").Set(doc, m_enabled);
+			Pointer("/data/rsp/functions").Set(doc, functions);
+		}
+		MngBaseMsg::createResponsePayload(doc);
+	}
+}
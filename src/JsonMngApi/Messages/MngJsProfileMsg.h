@@ -0,0 +1,72 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "MngBaseMsg.h"
+
+#include "IJsRenderService.h"
+
+#include <map>
+#include <string>
+
+namespace iqrf {
+
+	/**
+	 * Driver function profile request message
+	 */
+	class MngJsProfileMsg : public MngBaseMsg {
+	public:
+		/// Delete base constructor
+		MngJsProfileMsg() = delete;
+
+		/**
+		 * Request document constructor
+		 * @param doc Request document
+		 * @param renderService JS render service interface
+		 */
+		MngJsProfileMsg(const Document &doc, IJsRenderService *renderService);
+
+		/**
+		 * Destructor
+		 */
+		virtual ~MngJsProfileMsg() {};
+
+		/**
+		 * Handles driver function profile request
+		 */
+		void handleMsg() override;
+
+		/**
+		 * Populates response document
+		 * @param doc Response document
+		 */
+		void createResponsePayload(Document &doc) override;
+	private:
+		/// JS render service interface
+		IJsRenderService *m_renderService = nullptr;
+		/// Enable or disable profiling
+		bool m_setEnabled = false;
+		/// Requested profiling state
+		bool m_enable = false;
+		/// Clear profile after it is read
+		bool m_reset = false;
+		/// Profiling enabled
+		bool m_enabled = false;
+		/// Function profiles by context ID and function name
+		std::map<int, std::map<std::string, IJsRenderService::FunctionProfile>> m_profile;
+	};
+}
@@ -39,6 +39,9 @@ protected:
     NetworkQueueInactive,
     NetworkQueueFull,
     UnexpectedAuth,
+    RateLimited,
+    DuplicateMsgId,
+    CoalescedTimeout,
   };
 
   /**
@@ -221,3 +224,66 @@ public:
     return doc;
   }
 };
+
+/**
+ * Rate limit exceeded messageError class
+ */
+class RateLimitedErrorMsg : protected BaseErrorMsg {
+public:
+
+  /**
+   * Populate rate limit exceeded error message
+   * @param msgId Message ID
+   * @param mType Ignored message type
+   * @return Rate limit exceeded messageError document
+   */
+  static rapidjson::Document createMessage(const std::string &msgId, const std::string &mType) {
+    auto doc = BaseErrorMsg::createMessage(msgId);
+    rapidjson::Pointer("/data/rsp/ignoredMessage").Set(doc, mType);
+    rapidjson::Pointer("/data/status").Set(doc, ErrorMsgCodes::RateLimited);
+    rapidjson::Pointer("/data/statusStr").Set(doc, "Messaging rate limit exceeded.");
+    return doc;
+  }
+};
+
+/**
+ * Duplicate message ID messageError class
+ */
+class DuplicateMsgIdErrorMsg : protected BaseErrorMsg {
+public:
+
+  /**
+   * Populate duplicate message ID error message
+   * @param msgId Message ID
+   * @param mType Ignored message type
+   * @return Duplicate message ID messageError document
+   */
+  static rapidjson::Document createMessage(const std::string &msgId, const std::string &mType) {
+    auto doc = BaseErrorMsg::createMessage(msgId);
+    rapidjson::Pointer("/data/rsp/ignoredMessage").Set(doc, mType);
+    rapidjson::Pointer("/data/status").Set(doc, ErrorMsgCodes::DuplicateMsgId);
+    rapidjson::Pointer("/data/statusStr").Set(doc, "Message ID is used by pending request.");
+    return doc;
+  }
+};
+
+/**
+ * Coalesced request timeout messageError class
+ */
+class CoalescedTimeoutErrorMsg : protected BaseErrorMsg {
+public:
+
+  /**
+   * Populate coalesced request timeout error message
+   * @param msgId Message ID
+   * @param mType Unanswered message type
+   * @return Coalesced request timeout messageError document
+   */
+  static rapidjson::Document createMessage(const std::string &msgId, const std::string &mType) {
+    auto doc = BaseErrorMsg::createMessage(msgId);
+    rapidjson::Pointer("/data/rsp/ignoredMessage").Set(doc, mType);
+    rapidjson::Pointer("/data/status").Set(doc, ErrorMsgCodes::CoalescedTimeout);
+    rapidjson::Pointer("/data/statusStr").Set(doc, "Identical request has not been answered in time.");
+    return doc;
+  }
+};
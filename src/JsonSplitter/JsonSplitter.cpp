@@ -32,21 +32,29 @@
 
 #include "ApiMsg.h"
 #include "ErrorMessages.h"
+#include "FairTaskQueue.h"
 #include "JsonSplitter.h"
-#include "TaskQueue.h"
+#include "MessageTypeRegistry.h"
+#include "RequestCoalescer.h"
+#include "TokenBucket.h"
 #include "Trace.h"
 
 #include <dirent.h>
 #include <sys/stat.h>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
 #include <fstream>
 #include <filesystem>
+#include <functional>
 #include <algorithm>
 #include <vector>
 #include <map>
 #include <unordered_map>
 #include <set>
 #include <locale>
+#include <memory>
+#include <optional>
 
 #ifdef TRC_CHANNEL
 #undef TRC_CHANNEL
@@ -79,11 +87,19 @@ namespace iqrf {
   private:
     /// Messaging ID and message pair
     typedef std::pair<MessagingInstance, std::vector<uint8_t>> MsgIdMsg;
+    /// Message queue fairly shared by messaging instances
+    typedef FairTaskQueue<std::string, MsgIdMsg> MsgQueue;
+    /// Token bucket rate limit, refill rate and burst
+    typedef std::pair<double, double> RateLimit;
 
     /// Start network queue message type
     static constexpr const char* MsgStartQueue = "mngDaemon_StartNetworkQueue";
     /// Stop network queue message type
     static constexpr const char* MsgStopQueue = "mngDaemon_StopNetworkQueue";
+    /// Period of coalesced request expiry checks in seconds
+    static constexpr unsigned CoalescingExpiryPeriod = 1;
+    /// Default time to answer coalesced request in seconds
+    static constexpr unsigned DefaultCoalescingTimeout = 60;
     /// Instance ID
     std::string m_insId = "iqrfgd2-default";
     /// Validate responses
@@ -98,20 +114,38 @@ namespace iqrf {
     mutable std::mutex m_filterMessageHandlerFuncMapMux;
     /// Registered message handlers
     std::map<std::string, FilteredMessageHandlerFunc> m_filterMessageHandlerFuncMap;
-    /// Map of requests and validation schemas
-    std::unordered_map<std::string, valijson::Schema> m_requestSchemaCache;
-    /// Map of responses and validation schemas
-    std::unordered_map<std::string, valijson::Schema> m_responseSchemaCache;
-    /// Message type to handle
-    std::map<std::string, MsgType> m_msgTypeToHandle;
+    /// Resolved message handlers by message type ID, reset on handler (un)registration
+    mutable std::vector<std::optional<FilteredMessageHandlerFunc>> m_resolvedHandlers;
+    /// Request validation schemas by message type ID
+    std::vector<std::unique_ptr<valijson::Schema>> m_requestSchemaCache;
+    /// Response validation schemas by message type ID
+    std::vector<std::unique_ptr<valijson::Schema>> m_responseSchemaCache;
+    /// Supported message types
+    MessageTypeRegistry m_msgTypes;
+    /// Management queue flags by message type ID, built from whitelist at schema load
+    std::vector<bool> m_managementQueueTypes;
     /// Management queue capacity
     size_t m_managementQueueCapacity = 32;
+    /// Management queue capacity per messaging instance, 0 for no limit
+    size_t m_managementQueueSourceCapacity = 0;
     /// Management message queue
-    TaskQueue<MsgIdMsg>* m_managementQueue = nullptr;
+    MsgQueue* m_managementQueue = nullptr;
     /// Network queue capacity
     size_t m_networkQueueCapacity = 32;
+    /// Network queue capacity per messaging instance, 0 for no limit
+    size_t m_networkQueueSourceCapacity = 0;
     /// Network message queue
-    TaskQueue<MsgIdMsg>* m_networkQueue = nullptr;
+    MsgQueue* m_networkQueue = nullptr;
+    /// Queue quanta of specific messaging instances, number of messages handled per round
+    std::map<std::string, size_t> m_queueQuanta;
+    /// Default rate limit of messaging instances
+    RateLimit m_defaultRateLimit = {0, 1};
+    /// Rate limits of specific messaging instances
+    std::map<std::string, RateLimit> m_rateLimits;
+    /// Rate limiter mutex
+    mutable std::mutex m_tokenBucketMtx;
+    /// Rate limiters of messaging instances
+    mutable std::map<std::string, TokenBucket> m_tokenBuckets;
     /// Launch service interface
     shape::ILaunchService* m_iLaunchService = nullptr;
     /// Management queue message whitelist
@@ -130,6 +164,7 @@ namespace iqrf {
       "iqrfSensorData_SetConfig",
       "iqrfSensorData_Status",
       "mngDaemon_Exit",
+      "mngDaemon_JsProfile",
       "mngDaemon_Mode",
       "mngDaemon_StartNetworkQueue",
       "mngDaemon_StopNetworkQueue",
@@ -145,6 +180,32 @@ namespace iqrf {
       "mngScheduler_StopTask",
       "ntfDaemon_InvokeMonitor"
     };
+    /// Default idempotent message types eligible for coalescing
+    const std::set<std::string> m_defaultIdempotentMessages = {
+      "iqrfDb_GetBinaryOutputs",
+      "iqrfDb_GetDevice",
+      "iqrfDb_GetDevices",
+      "iqrfDb_GetDeviceMetadata",
+      "iqrfDb_GetLights",
+      "iqrfDb_GetNetworkTopology",
+      "iqrfDb_GetSensors",
+      "iqrfSensorData_Status",
+      "iqrfSensor_ReadSensorsWithTypes",
+      "mngDaemon_Version",
+      "mngScheduler_List"
+    };
+    /// Request coalescer
+    mutable RequestCoalescer m_coalescer;
+    /// Time to answer coalesced request after its handling started
+    std::chrono::seconds m_coalescingTimeout = std::chrono::seconds(DefaultCoalescingTimeout);
+    /// Coalesced request expiry thread run
+    bool m_coalescingExpiryRun = false;
+    /// Coalesced request expiry thread
+    std::thread m_coalescingExpiryThread;
+    /// Coalesced request expiry mutex
+    std::mutex m_coalescingExpiryMtx;
+    /// Coalesced request expiry condition variable
+    std::condition_variable m_coalescingExpiryCv;
   public:
     static bool isAuthMessage(const rapidjson::Document& doc) {
       auto typeItr = doc.FindMember("type");
@@ -162,38 +223,80 @@ namespace iqrf {
       return buffer.GetString();
     }
 
-    MsgType getMessageType(const rapidjson::Document& doc) const {
-      std::string mType;
-      std::string ver;
-
+    const MsgType &getMessageType(const rapidjson::Document& doc) const {
       //default version
       int major = 1;
       int minor = 0;
       int micro = 0;
 
+      if (!doc.IsObject()) {
+        THROW_EXC_TRC_WAR(std::logic_error, "Missing message type");
+      }
+
       // get message type
-      if (const Value* mTypeVal = rapidjson::Pointer("/mType").Get(doc)) {
-        mType = mTypeVal->GetString();
-      } else {
+      auto mTypeItr = doc.FindMember("mType");
+      if (mTypeItr == doc.MemberEnd() || !mTypeItr->value.IsString()) {
         THROW_EXC_TRC_WAR(std::logic_error, "Missing message type");
       }
+      std::string_view mType(mTypeItr->value.GetString(), mTypeItr->value.GetStringLength());
 
       // get version
-      if (const Value* verVal = rapidjson::Pointer("/ver").Get(doc)) {
-        ver = verVal->GetString();
-        std::replace(ver.begin(), ver.end(), '.', ' ');
-        std::istringstream istr(ver);
-        istr >> major >> minor >> micro;
+      auto verItr = doc.FindMember("ver");
+      if (verItr != doc.MemberEnd() && verItr->value.IsString()) {
+        MessageTypeRegistry::parseVersion(
+          std::string_view(verItr->value.GetString(), verItr->value.GetStringLength()),
+          major,
+          minor,
+          micro
+        );
       }
 
-      std::string key = mType + '.' + std::to_string(major) + '.' + std::to_string(minor) + '.' + std::to_string(micro);
-
-      auto handled = m_msgTypeToHandle.find(key);
-      if (handled == m_msgTypeToHandle.end()) {
+      const MsgType *handled = m_msgTypes.find(m_msgTypes.getTypeId(mType), major, minor, micro);
+      if (handled == nullptr) {
         THROW_EXC_TRC_WAR(std::logic_error, "Unsupported message type: " << mType);
       }
 
-      return handled->second;
+      return *handled;
+    }
+
+    /**
+     * Checks if message type is handled by management queue
+     * @param msgType Message type
+     * @return true if message is handled by management queue, false otherwise
+     */
+    bool isManagementMessage(const MsgType &msgType) const {
+      return msgType.m_typeId < m_managementQueueTypes.size() && m_managementQueueTypes[msgType.m_typeId];
+    }
+
+    /**
+     * Returns handler of message type
+     *
+     * Handler registered with the longest filter contained in message type name is selected.
+     * Resolved handlers are cached by message type ID.
+     * @param msgType Message type
+     * @return Message handler, empty if there is no handler for message type
+     */
+    FilteredMessageHandlerFunc getMessageHandler(const MsgType &msgType) const {
+      std::lock_guard<std::mutex> lck(m_filterMessageHandlerFuncMapMux);
+      if (msgType.m_typeId < m_resolvedHandlers.size() && m_resolvedHandlers[msgType.m_typeId]) {
+        return *m_resolvedHandlers[msgType.m_typeId];
+      }
+      size_t len = 0;
+      FilteredMessageHandlerFunc selected;
+      for (const auto & filter : m_filterMessageHandlerFuncMap) {
+        // best fit
+        if (len < filter.first.size() && std::string::npos != msgType.m_type.find(filter.first)) {
+          selected = filter.second;
+          len = filter.first.size();
+        }
+      }
+      if (msgType.m_typeId != MsgType::UnknownId) {
+        if (msgType.m_typeId >= m_resolvedHandlers.size()) {
+          m_resolvedHandlers.resize(msgType.m_typeId + 1);
+        }
+        m_resolvedHandlers[msgType.m_typeId] = selected;
+      }
+      return selected;
     }
 
     void sendMessage(const MessagingInstance& messaging, rapidjson::Document doc) const {
@@ -202,6 +305,16 @@ namespace iqrf {
     }
 
     void sendMessage(const std::list<MessagingInstance>& messagingList, rapidjson::Document doc) const {
+      sendMessage(messagingList, std::move(doc), true);
+    }
+
+    /**
+     * Sends message to messagings
+     * @param messagingList Messaging instances
+     * @param doc Message
+     * @param fanOut Send copies of response to requesters attached to the answered request, false for the copies
+     */
+    void sendMessage(const std::list<MessagingInstance>& messagingList, rapidjson::Document doc, bool fanOut) const {
       using namespace rapidjson;
 
       // Include instance ID in messages
@@ -210,17 +323,51 @@ namespace iqrf {
       TRC_INFORMATION("Outgoing message: " << std::endl << JsonToStr(doc));
 
       // Check if message is allowed or supported
-      MsgType mType = getMessageType(doc);
+      const MsgType &mType = getMessageType(doc);
+
+      // Release requesters attached to the answered request before anything can fail
+      std::list<RequestCoalescer::Waiter> waiters;
+      if (fanOut && m_coalescer.getPendingCount() > 0) {
+        std::string msgId = Pointer("/data/msgId").GetWithDefault(doc, "unknown").GetString();
+        if (messagingList.empty()) {
+          waiters = m_coalescer.releaseBroadcast(msgId, [&](const MessagingInstance &messaging) {
+            return m_messagingList.empty() || std::find(m_messagingList.begin(), m_messagingList.end(), messaging) != m_messagingList.end();
+          });
+        }
+        for (const auto &messaging : messagingList) {
+          waiters.splice(waiters.end(), m_coalescer.release(messaging, msgId));
+        }
+      }
 
       // Validate generated response
       if (m_validateResponse) {
-        validate(mType, doc, m_responseSchemaCache, "response");
+        try {
+          validate(mType, doc, m_responseSchemaCache, "response");
+        } catch (const std::exception &e) {
+          auto msgStr = JsonToStr(doc);
+          for (const auto &waiter : waiters) {
+            try {
+              sendMessage(waiter.messaging, GeneralErrorMsg::createMessage(waiter.msgId, msgStr, e.what()));
+            } catch (const std::exception &ee) {
+              TRC_WARNING("Failed to send general error response: " << ee.what());
+            }
+          }
+          throw;
+        }
       }
 
       StringBuffer buffer;
       Writer<StringBuffer> writer(buffer);
       doc.Accept(writer);
 
+      for (const auto &waiter : waiters) {
+        Document waiterDoc;
+        waiterDoc.CopyFrom(doc, waiterDoc.GetAllocator());
+        Pointer("/data/msgId").Set(waiterDoc, waiter.msgId);
+        TRC_INFORMATION("Sending coalesced response to: " << waiter.messaging.to_string() << " " << PAR(waiter.msgId));
+        sendMessage({waiter.messaging}, std::move(waiterDoc), false);
+      }
+
       // Send responses out
       if (messagingList.empty() && m_messagingList.empty()) {
         // Service and splitter messaging lists empty, send to all
@@ -282,6 +429,7 @@ namespace iqrf {
       for (const auto & ft : msgTypeFilters) {
         m_filterMessageHandlerFuncMap.insert(std::make_pair(ft, handlerFunc));
       }
+      m_resolvedHandlers.clear();
     }
 
     void unregisterFilteredMsgHandler(const std::vector<std::string>& msgTypeFilters) {
@@ -289,6 +437,7 @@ namespace iqrf {
       for (const auto & ft : msgTypeFilters) {
         m_filterMessageHandlerFuncMap.erase(ft);
       }
+      m_resolvedHandlers.clear();
     }
 
     int getManagementQueueLen() const {
@@ -305,16 +454,67 @@ namespace iqrf {
       return -1;
     }
 
+    std::map<std::string, size_t> getManagementQueueOccupancy() const {
+      if (m_managementQueue) {
+        return m_managementQueue->getOccupancy();
+      }
+      return {};
+    }
+
+    std::map<std::string, size_t> getNetworkQueueOccupancy() const {
+      if (m_networkQueue) {
+        return m_networkQueue->getOccupancy();
+      }
+      return {};
+    }
+
+    /**
+     * Returns queue source identifier of messaging instance, topics appended to instance name are ignored
+     * @param messaging Messaging instance
+     * @return Source identifier
+     */
+    static std::string getSource(const MessagingInstance &messaging) {
+      auto source = messaging.to_string();
+      size_t pos = source.find_first_of('/');
+      if (pos != std::string::npos) {
+        source = source.substr(0, pos);
+      }
+      return source;
+    }
+
+    /**
+     * Checks messaging instance rate limit and consumes token
+     *
+     * Default rate limit does not apply to internal scheduler messaging, it is limited only by specific rate limit.
+     * @param messaging Messaging instance
+     * @return true if request exceeds rate limit, false otherwise
+     */
+    bool isRateLimited(const MessagingInstance &messaging) const {
+      auto source = getSource(messaging);
+      std::lock_guard<std::mutex> lock(m_tokenBucketMtx);
+      auto bucket = m_tokenBuckets.find(source);
+      if (bucket == m_tokenBuckets.end()) {
+        auto limit = m_rateLimits.find(source);
+        RateLimit rateLimit = {0, 1};
+        if (limit != m_rateLimits.end()) {
+          rateLimit = limit->second;
+        } else if (messaging.type != MessagingType::SCHEDULER) {
+          rateLimit = m_defaultRateLimit;
+        }
+        bucket = m_tokenBuckets.emplace(source, TokenBucket(rateLimit.first, rateLimit.second)).first;
+      }
+      return !bucket->second.tryConsume();
+    }
+
     void validate(const IMessagingSplitterService::MsgType & msgType, const Document& doc,
-      const std::unordered_map<std::string, valijson::Schema>& schemas, const std::string& direction) const {
+      const std::vector<std::unique_ptr<valijson::Schema>>& schemas, const std::string& direction) const {
       TRC_FUNCTION_ENTER(PAR(msgType.m_type));
-      auto found = schemas.find(msgType.getKey());
-      if (found != schemas.end()) {
+      if (msgType.m_id < schemas.size() && schemas[msgType.m_id]) {
         valijson::Validator validator(valijson::Validator::kStrongTypes);
         valijson::ValidationResults errors;
         valijson::adapters::RapidJsonAdapter adapter(doc);
 
-        if (!validator.validate(found->second, adapter, &errors)) {
+        if (!validator.validate(*schemas[msgType.m_id], adapter, &errors)) {
           valijson::ValidationResults::Error error;
           while (errors.popError(error)) {
             std::string context;
@@ -341,6 +541,8 @@ namespace iqrf {
 
       std::string msgStr((char*)message.data(), message.size());
       std::string msgId("unknown");
+      // request registered as queued by coalescer
+      bool coalesced = false;
 
       try {
         Document doc;
@@ -349,13 +551,13 @@ namespace iqrf {
         // Check for invalid json
         if (doc.HasParseError()) {
           TRC_WARNING("Failed to parse JSON message: error " << doc.GetParseError() << " at position " << doc.GetErrorOffset());
-          sendMessage(messaging, JsonParseErrorMsg::createMessage(msgStr, doc.GetParseError(), doc.GetErrorOffset()));
+          sendMessage({messaging}, JsonParseErrorMsg::createMessage(msgStr, doc.GetParseError(), doc.GetErrorOffset()), false);
           return;
         }
 
         if (isAuthMessage(doc)) {
           TRC_WARNING("Received unexpected websocket authentication message.");
-          sendMessage(messaging, UnexpectedAuthMsg::createMessage());
+          sendMessage({messaging}, UnexpectedAuthMsg::createMessage(), false);
           return;
         }
 
@@ -364,21 +566,50 @@ namespace iqrf {
         // Check for missing mType
         if (!doc.HasMember("mType")) {
           TRC_WARNING("mType missing in JSON message: " << msgStr);
-          sendMessage(messaging, MissingMTypeMsg::createMessage(msgId, msgStr));
+          sendMessage({messaging}, MissingMTypeMsg::createMessage(msgId, msgStr), false);
+          return;
+        }
+
+        // Check messaging rate limit
+        if (isRateLimited(messaging)) {
+          std::string mType = doc["mType"].IsString() ? doc["mType"].GetString() : "unknown";
+          TRC_WARNING("Rate limit of " << messaging.to_string() << " exceeded, message " << mType << ":" << msgId << " discarded.");
+          sendMessage({messaging}, RateLimitedErrorMsg::createMessage(msgId, mType), false);
           return;
         }
 
         /// Validate request message
-        MsgType msgType = getMessageType(doc);
+        const MsgType &msgType = getMessageType(doc);
         try {
           validate(msgType, doc, m_requestSchemaCache, "request");
         } catch (const std::logic_error &e) {
           TRC_WARNING("Failed to validate JSON request: " << e.what());
-          sendMessage(messaging, ValidationErrorMsg::createMessage(msgId, msgStr, e.what()));
+          sendMessage({messaging}, ValidationErrorMsg::createMessage(msgId, msgStr, e.what()), false);
           return;
         }
 
-        if (m_managementQueueWhitelist.find(msgType.m_type) != m_managementQueueWhitelist.end()) {
+        // Attach to identical queued request
+        auto admission = RequestCoalescer::Admission::Queue;
+        if (m_coalescer.isCoalescable(msgType.m_type)) {
+          admission = m_coalescer.attach(RequestCoalescer::createKey(doc), msgType.m_type, messaging, msgId);
+          coalesced = admission == RequestCoalescer::Admission::Queue;
+        } else if (m_coalescer.isTracked(messaging, msgId)) {
+          // response would be taken for response of the tracked request
+          admission = RequestCoalescer::Admission::DuplicateId;
+        }
+        switch (admission) {
+          case RequestCoalescer::Admission::Attached:
+            TRC_INFORMATION("Request " << msgType.m_type << ":" << msgId << " coalesced with identical queued request.");
+            return;
+          case RequestCoalescer::Admission::DuplicateId:
+            TRC_WARNING("Request " << msgType.m_type << ":" << msgId << " reuses message ID of pending request, message discarded.");
+            sendMessage({messaging}, DuplicateMsgIdErrorMsg::createMessage(msgId, msgType.m_type), false);
+            return;
+          case RequestCoalescer::Admission::Queue:
+            break;
+        }
+
+        if (isManagementMessage(msgType)) {
           handleManagementMessageFromMessaging(messaging, message, msgType.m_type, msgId);
         } else {
           handleNetworkMessageFromMessaging(messaging, message, msgType.m_type, msgId);
@@ -386,25 +617,75 @@ namespace iqrf {
       } catch (const std::exception &e) {
         TRC_WARNING("Failed to process request from messaging: " << e.what());
         try {
-          sendMessage(messaging, GeneralErrorMsg::createMessage(msgId, msgStr, e.what()));
+          sendMessage({messaging}, GeneralErrorMsg::createMessage(msgId, msgStr, e.what()), false);
+        } catch (const std::exception &ee) {
+          TRC_WARNING("Failed to send general error response: " << ee.what());
+        }
+        try {
+          // request has not been queued, requesters attached to it would never get response
+          if (coalesced) {
+            releaseCoalesced(messaging, msgId, [&](const std::string &waiterMsgId) {
+              return GeneralErrorMsg::createMessage(waiterMsgId, msgStr, e.what());
+            });
+          }
         } catch (const std::exception &ee) {
           TRC_WARNING("Failed to send general error response: " << ee.what());
         }
       }
     }
 
+    void releaseCoalesced(const MessagingInstance &messaging, const std::string &msgId,
+      const std::function<rapidjson::Document(const std::string &)> &createError) const {
+      for (const auto &waiter : m_coalescer.release(messaging, msgId)) {
+        sendMessage(waiter.messaging, createError(waiter.msgId));
+      }
+    }
+
+    /**
+     * Answers requesters of coalesced requests that have not been answered in time
+     */
+    void coalescingExpiryWorker() {
+      std::unique_lock<std::mutex> lock(m_coalescingExpiryMtx);
+      while (m_coalescingExpiryRun) {
+        m_coalescingExpiryCv.wait_for(lock, std::chrono::seconds(CoalescingExpiryPeriod));
+        if (!m_coalescingExpiryRun) {
+          break;
+        }
+        auto waiters = m_coalescer.expire(RequestCoalescer::Clock::now() - m_coalescingTimeout);
+        lock.unlock();
+        for (const auto &waiter : waiters) {
+          TRC_WARNING("Coalesced request " << waiter.mType << ":" << waiter.msgId << " of " << waiter.messaging.to_string() << " has not been answered in time.");
+          try {
+            sendMessage({waiter.messaging}, CoalescedTimeoutErrorMsg::createMessage(waiter.msgId, waiter.mType), false);
+          } catch (const std::exception &e) {
+            TRC_WARNING("Failed to send coalesced request timeout response: " << e.what());
+          }
+        }
+        lock.lock();
+      }
+    }
+
     void handleManagementMessageFromMessaging(const MessagingInstance &messaging, const std::vector<uint8_t> &message, const std::string &mType, const std::string &msgId) const {
       if (!m_managementQueue) {
         TRC_WARNING("Management message queue has not been initialized.");
         sendMessage(messaging, MessageQueueNotInitializedErrorMsg::createMessage(msgId, mType, false));
+        releaseCoalesced(messaging, msgId, [&](const std::string &waiterMsgId) {
+          return MessageQueueNotInitializedErrorMsg::createMessage(waiterMsgId, mType, false);
+        });
         return;
       }
+      auto source = getSource(messaging);
       auto queueLen = m_managementQueue->size();
-      if (queueLen < m_managementQueueCapacity) {
-        m_managementQueue->pushToQueue(std::make_pair(messaging, message));
+      bool sourceFull = m_managementQueueSourceCapacity > 0 && m_managementQueue->size(source) >= m_managementQueueSourceCapacity;
+      if (queueLen < m_managementQueueCapacity && !sourceFull) {
+        m_managementQueue->pushToQueue(source, std::make_pair(messaging, message));
       } else {
-        TRC_WARNING("Management queue full, message " << mType << ":" << msgId << " discarded.");
-        sendMessage(messaging, MessageQueueFullErrorMsg::createMessage(msgId, mType, false, m_managementQueueCapacity));
+        size_t capacity = sourceFull ? m_managementQueueSourceCapacity : m_managementQueueCapacity;
+        TRC_WARNING("Management queue " << (sourceFull ? "share of " + source + " " : "") << "full, message " << mType << ":" << msgId << " discarded.");
+        sendMessage(messaging, MessageQueueFullErrorMsg::createMessage(msgId, mType, false, capacity));
+        releaseCoalesced(messaging, msgId, [&](const std::string &waiterMsgId) {
+          return MessageQueueFullErrorMsg::createMessage(waiterMsgId, mType, false, capacity);
+        });
       }
       TRC_FUNCTION_LEAVE(PAR(queueLen))
     }
@@ -413,14 +694,23 @@ namespace iqrf {
       if (!m_networkQueue) {
         TRC_WARNING("Network message queue has not been initialized.");
         sendMessage(messaging, MessageQueueNotInitializedErrorMsg::createMessage(msgId, mType, true));
+        releaseCoalesced(messaging, msgId, [&](const std::string &waiterMsgId) {
+          return MessageQueueNotInitializedErrorMsg::createMessage(waiterMsgId, mType, true);
+        });
         return;
       }
+      auto source = getSource(messaging);
       auto queueLen = m_networkQueue->size();
-      if (queueLen < m_networkQueueCapacity) {
-        m_networkQueue->pushToQueue(std::make_pair(messaging, message));
+      bool sourceFull = m_networkQueueSourceCapacity > 0 && m_networkQueue->size(source) >= m_networkQueueSourceCapacity;
+      if (queueLen < m_networkQueueCapacity && !sourceFull) {
+        m_networkQueue->pushToQueue(source, std::make_pair(messaging, message));
       } else {
-        TRC_WARNING("Network queue full, message " << mType << ":" << msgId << " discarded.");
-        sendMessage(messaging, MessageQueueFullErrorMsg::createMessage(msgId, mType, true, m_networkQueueCapacity));
+        size_t capacity = sourceFull ? m_networkQueueSourceCapacity : m_networkQueueCapacity;
+        TRC_WARNING("Network queue " << (sourceFull ? "share of " + source + " " : "") << "full, message " << mType << ":" << msgId << " discarded.");
+        sendMessage(messaging, MessageQueueFullErrorMsg::createMessage(msgId, mType, true, capacity));
+        releaseCoalesced(messaging, msgId, [&](const std::string &waiterMsgId) {
+          return MessageQueueFullErrorMsg::createMessage(waiterMsgId, mType, true, capacity);
+        });
       }
       TRC_FUNCTION_LEAVE(PAR(queueLen))
     }
@@ -429,6 +719,7 @@ namespace iqrf {
       using namespace rapidjson;
 
       std::string msgId("unknown");
+      std::string mType;
       std::string str((char*)message.data(), message.size());
       StringStream sstr(str.data());
       Document doc;
@@ -436,42 +727,37 @@ namespace iqrf {
 
       try {
         msgId = Pointer("/data/msgId").GetWithDefault(doc, "unknown").GetString();
-        MsgType msgType = getMessageType(doc);
+        const MsgType &msgType = getMessageType(doc);
+        mType = msgType.m_type;
+        // identical requests received from now on are handled separately
+        m_coalescer.dequeued(messaging, msgId);
 
-        std::map<std::string, FilteredMessageHandlerFunc > bestFitMap;
-        { //lock scope
-          //std::lock_guard<std::mutex> lck(m_filterMessageHandlerFuncMapMux);
-          if (msgType.m_type == "mngDaemon_Exit") {
-            m_networkQueue->stopQueue();
-          }
-          for (const auto & filter : m_filterMessageHandlerFuncMap) {
-            // best fit
-            if (std::string::npos != msgType.m_type.find(filter.first)) {
-              bestFitMap.insert(filter);
-            }
-          }
-          if (!bestFitMap.empty()) {
-            size_t len = 0;
-            FilteredMessageHandlerFunc selected;
-            for (const auto & fit : bestFitMap) {
-              if (len < fit.first.size()) {
-                selected = fit.second;
-                len = fit.first.size();
-              }
-            }
-            // invoke handling
-            try {
-              selected(messaging, msgType, std::move(doc));
-              TRC_INFORMATION("Incoming message successfully handled.");
-            } catch (std::exception &e) {
-              THROW_EXC_TRC_WAR(std::logic_error, "Unhandled exception: " << e.what());
-            }
-          } else {
-            THROW_EXC_TRC_WAR(std::logic_error, "Unsupported: " << NAME_PAR(mType.version, msgType.getKey()));
+        if (msgType.m_typeHash == MsgType::hash("mngDaemon_Exit")) {
+          m_networkQueue->stopQueue();
+        }
+        FilteredMessageHandlerFunc selected = getMessageHandler(msgType);
+        if (selected) {
+          // invoke handling
+          try {
+            selected(messaging, msgType, std::move(doc));
+            TRC_INFORMATION("Incoming message successfully handled.");
+          } catch (std::exception &e) {
+            THROW_EXC_TRC_WAR(std::logic_error, "Unhandled exception: " << e.what());
           }
+        } else {
+          THROW_EXC_TRC_WAR(std::logic_error, "Unsupported: " << NAME_PAR(mType.version, msgType.getKey()));
         }
       } catch (const std::logic_error &e) {
         TRC_WARNING("Error while handling incoming message:" << e.what());
+        try {
+          if (!mType.empty()) {
+            releaseCoalesced(messaging, msgId, [&](const std::string &waiterMsgId) {
+              return GeneralErrorMsg::createMessage(waiterMsgId, str, e.what());
+            });
+          }
+        } catch (const std::logic_error &ee) {
+          TRC_WARNING("Cannot create error response:" << ee.what());
+        }
         try {
           sendMessage(messaging, GeneralErrorMsg::createMessage(msgId, str, e.what()));
         } catch (const std::logic_error &ee) {
@@ -602,25 +888,30 @@ namespace iqrf {
             THROW_EXC_TRC_WAR(std::logic_error, "Invalid schema: " << PAR(fname));
           }
 
-          valijson::Schema schema;
+          auto schema = std::make_unique<valijson::Schema>();
           valijson::SchemaParser parser;
           valijson::adapters::RapidJsonAdapter adapter(sd);
           try {
-            parser.populateSchema(adapter, schema, fetchDocument, freeDocument);
+            parser.populateSchema(adapter, *schema, fetchDocument, freeDocument);
           } catch (const std::exception &e) {
             THROW_EXC_TRC_WAR(std::runtime_error, "Failed to populate schema document :" << mType);
           }
 
-          MsgType msgType(mType, major, minor, micro, possibleDriverFunction);
+          auto id = m_msgTypes.intern(MsgType(mType, major, minor, micro, possibleDriverFunction));
+          const MsgType &msgType = m_msgTypes.get(id);
           auto key = msgType.getKey();
 
-          if (direction == "request") {
-            m_requestSchemaCache.insert(std::make_pair(key, std::move(schema)));
-          } else if (direction == "response") {
-            m_responseSchemaCache.insert(std::make_pair(key, std::move(schema)));
+          if (direction == "request" || direction == "response") {
+            auto &schemas = direction == "request" ? m_requestSchemaCache : m_responseSchemaCache;
+            if (schemas.size() <= id) {
+              schemas.resize(id + 1);
+            }
+            if (!schemas[id]) {
+              schemas[id] = std::move(schema);
+            }
           }
-          m_msgTypeToHandle.insert(std::make_pair(key, msgType));
           TRC_DEBUG("Added: "
+            << PAR(id)
             << PAR(key)
             << PAR(msgType.m_type)
             << " ver" << msgType.m_major << '.' << msgType.m_minor << '.' << msgType.m_micro
@@ -649,12 +940,25 @@ namespace iqrf {
       TRC_INFORMATION("loading schemes from: " << PAR(m_schemesDir));
       loadJsonSchemesRequest(m_schemesDir);
 
-      m_managementQueue = shape_new TaskQueue<MsgIdMsg>([&](const MsgIdMsg &msgIdMsg) {
+      m_managementQueueTypes.assign(m_msgTypes.getTypeCount(), false);
+      for (const auto &mType : m_managementQueueWhitelist) {
+        auto typeId = m_msgTypes.getTypeId(mType);
+        if (typeId != MsgType::UnknownId) {
+          m_managementQueueTypes[typeId] = true;
+        }
+      }
+      TRC_INFORMATION("Loaded message types: " << NAME_PAR(names, m_msgTypes.getTypeCount()) << NAME_PAR(versions, m_msgTypes.size()));
+
+      m_managementQueue = shape_new MsgQueue([&](const MsgIdMsg &msgIdMsg) {
         handleMessageFromSplitterQueue(msgIdMsg.first, msgIdMsg.second);
       });
-      m_networkQueue = shape_new TaskQueue<MsgIdMsg>([&](const MsgIdMsg& msgIdMsg) {
+      m_networkQueue = shape_new MsgQueue([&](const MsgIdMsg& msgIdMsg) {
         handleMessageFromSplitterQueue(msgIdMsg.first, msgIdMsg.second);
       });
+      setQueueQuanta({});
+
+      m_coalescingExpiryRun = true;
+      m_coalescingExpiryThread = std::thread([&]() { coalescingExpiryWorker(); });
 
       registerFilteredMsgHandler(
         {
@@ -697,7 +1001,132 @@ namespace iqrf {
       if (val && val->IsUint64()) {
         m_networkQueueCapacity = val->GetUint64();
       }
-      TRC_INFORMATION(PAR(m_validateResponse));
+      // Queue capacities per messaging instance
+      val = Pointer("/managementQueueSourceCapacity").Get(doc);
+      if (val && val->IsUint64()) {
+        m_managementQueueSourceCapacity = val->GetUint64();
+      }
+      val = Pointer("/networkQueueSourceCapacity").Get(doc);
+      if (val && val->IsUint64()) {
+        m_networkQueueSourceCapacity = val->GetUint64();
+      }
+      // Rate limits
+      val = Pointer("/defaultRateLimit").Get(doc);
+      if (val && val->IsObject()) {
+        m_defaultRateLimit = parseRateLimit(*val);
+      }
+      m_rateLimits.clear();
+      val = Pointer("/rateLimits").Get(doc);
+      if (val && val->IsArray()) {
+        for (auto itr = val->Begin(); itr != val->End(); ++itr) {
+          const Value *type = Pointer("/type").Get(*itr);
+          const Value *instance = Pointer("/instance").Get(*itr);
+          if (!type || !type->IsString() || !instance || !instance->IsString()) {
+            TRC_WARNING("Rate limit without messaging type and instance ignored.");
+            continue;
+          }
+          try {
+            MessagingInstance messaging(type->GetString(), instance->GetString());
+            m_rateLimits[messaging.to_string()] = parseRateLimit(*itr);
+          } catch (const std::domain_error &e) {
+            TRC_WARNING("Rate limit of unknown messaging type " << type->GetString() << " ignored.");
+          }
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_tokenBucketMtx);
+        m_tokenBuckets.clear();
+      }
+      // Queue quanta
+      std::map<std::string, size_t> queueQuanta;
+      val = Pointer("/queueQuanta").Get(doc);
+      if (val && val->IsArray()) {
+        for (auto itr = val->Begin(); itr != val->End(); ++itr) {
+          const Value *type = Pointer("/type").Get(*itr);
+          const Value *instance = Pointer("/instance").Get(*itr);
+          const Value *quantum = Pointer("/quantum").Get(*itr);
+          if (!type || !type->IsString() || !instance || !instance->IsString()) {
+            TRC_WARNING("Queue quantum without messaging type and instance ignored.");
+            continue;
+          }
+          if (!quantum || !quantum->IsUint() || quantum->GetUint() == 0) {
+            TRC_WARNING("Invalid queue quantum of " << type->GetString() << ":" << instance->GetString() << " ignored.");
+            continue;
+          }
+          try {
+            MessagingInstance messaging(type->GetString(), instance->GetString());
+            queueQuanta[messaging.to_string()] = quantum->GetUint();
+          } catch (const std::domain_error &e) {
+            TRC_WARNING("Queue quantum of unknown messaging type " << type->GetString() << " ignored.");
+          }
+        }
+      }
+      std::swap(m_queueQuanta, queueQuanta);
+      if (m_managementQueue && m_networkQueue) {
+        setQueueQuanta(queueQuanta);
+      }
+      // Request coalescing
+      bool coalescing = false;
+      std::set<std::string> idempotentMessages = m_defaultIdempotentMessages;
+      val = Pointer("/requestCoalescing").Get(doc);
+      if (val && val->IsBool()) {
+        coalescing = val->GetBool();
+      }
+      val = Pointer("/idempotentMessages").Get(doc);
+      if (val && val->IsArray()) {
+        idempotentMessages.clear();
+        for (auto itr = val->Begin(); itr != val->End(); ++itr) {
+          if (itr->IsString()) {
+            idempotentMessages.insert(itr->GetString());
+          }
+        }
+      }
+      m_coalescer.configure(coalescing, idempotentMessages);
+      unsigned coalescingTimeout = DefaultCoalescingTimeout;
+      val = Pointer("/coalescingTimeout").Get(doc);
+      if (val && val->IsUint() && val->GetUint() > 0) {
+        coalescingTimeout = val->GetUint();
+      }
+      {
+        std::lock_guard<std::mutex> lock(m_coalescingExpiryMtx);
+        m_coalescingTimeout = std::chrono::seconds(coalescingTimeout);
+      }
+      TRC_INFORMATION(PAR(m_validateResponse) << PAR(coalescing) << PAR(coalescingTimeout));
+    }
+
+    /**
+     * Sets configured quanta of messaging instances to queues
+     * @param previous Previously configured quanta, reset to default
+     */
+    void setQueueQuanta(const std::map<std::string, size_t> &previous) {
+      for (const auto &[source, quantum] : previous) {
+        if (m_queueQuanta.find(source) == m_queueQuanta.end()) {
+          m_managementQueue->setQuantum(source, 1);
+          m_networkQueue->setQuantum(source, 1);
+        }
+      }
+      for (const auto &[source, quantum] : m_queueQuanta) {
+        m_managementQueue->setQuantum(source, quantum);
+        m_networkQueue->setQuantum(source, quantum);
+      }
+    }
+
+    /**
+     * Parses rate limit configuration object
+     * @param val Rate limit object
+     * @return Rate limit
+     */
+    static RateLimit parseRateLimit(const Value &val) {
+      RateLimit rateLimit = {0, 1};
+      auto rate = val.FindMember("rate");
+      if (rate != val.MemberEnd() && rate->value.IsNumber()) {
+        rateLimit.first = rate->value.GetDouble();
+      }
+      auto burst = val.FindMember("burst");
+      if (burst != val.MemberEnd() && burst->value.IsNumber()) {
+        rateLimit.second = burst->value.GetDouble();
+      }
+      return rateLimit;
     }
 
     void deactivate()
@@ -709,6 +1138,15 @@ namespace iqrf {
         "******************************"
       );
 
+      {
+        std::lock_guard<std::mutex> lock(m_coalescingExpiryMtx);
+        m_coalescingExpiryRun = false;
+      }
+      m_coalescingExpiryCv.notify_all();
+      if (m_coalescingExpiryThread.joinable()) {
+        m_coalescingExpiryThread.join();
+      }
+
       delete m_networkQueue;
       delete m_managementQueue;
 
@@ -791,6 +1229,14 @@ namespace iqrf {
     return m_imp->getNetworkQueueLen();
   }
 
+  std::map<std::string, size_t> JsonSplitter::getManagementQueueOccupancy() const {
+    return m_imp->getManagementQueueOccupancy();
+  }
+
+  std::map<std::string, size_t> JsonSplitter::getNetworkQueueOccupancy() const {
+    return m_imp->getNetworkQueueOccupancy();
+  }
+
   void JsonSplitter::activate(const shape::Properties *props)
   {
     m_imp->activate(props);
@@ -35,6 +35,8 @@ namespace iqrf {
     void unregisterFilteredMsgHandler(const std::vector<std::string>& msgTypeFilters) override;
     int getManagementQueueLen() const override;
     int getNetworkQueueLen() const override;
+    std::map<std::string, size_t> getManagementQueueOccupancy() const override;
+    std::map<std::string, size_t> getNetworkQueueOccupancy() const override;
 
     void activate(const shape::Properties *props = 0);
     void deactivate();
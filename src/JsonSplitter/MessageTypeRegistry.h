@@ -0,0 +1,183 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "IMessagingSplitterService.h"
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace iqrf {
+
+  /**
+   * Registry of message types known from API schemas
+   *
+   * Message type names are interned into dense type IDs and every supported version of a message type
+   * into a dense ID, so per-message data (schemas, queue selection, handlers) can be kept in flat tables
+   * indexed by ID. The registry is populated at schema load and read-only afterwards, references to registered
+   * message types stay valid.
+   */
+  class MessageTypeRegistry {
+  public:
+    typedef IMessagingSplitterService::MsgType MsgType;
+
+    /**
+     * Interns message type and assigns its IDs
+     * @param msgType Message type
+     * @return ID of versioned message type
+     */
+    uint32_t intern(const MsgType &msgType) {
+      uint32_t typeId = internName(msgType.m_type);
+      for (uint32_t id : m_versions[typeId]) {
+        const auto &known = m_msgTypes[id];
+        if (known.m_major == msgType.m_major && known.m_minor == msgType.m_minor && known.m_micro == msgType.m_micro) {
+          return id;
+        }
+      }
+      uint32_t id = static_cast<uint32_t>(m_msgTypes.size());
+      m_msgTypes.push_back(msgType);
+      m_msgTypes.back().m_typeId = typeId;
+      m_msgTypes.back().m_id = id;
+      m_versions[typeId].push_back(id);
+      return id;
+    }
+
+    /**
+     * Returns type ID of message type name
+     *
+     * Names are looked up by hash, so that looking up name of incoming message does not allocate.
+     * @param mType Message type name
+     * @return Type ID, MsgType::UnknownId if message type is not known
+     */
+    uint32_t getTypeId(std::string_view mType) const {
+      auto found = m_typeIds.find(MsgType::hash(mType));
+      if (found == m_typeIds.end() || m_typeNames[found->second] != mType) {
+        return MsgType::UnknownId;
+      }
+      return found->second;
+    }
+
+    /**
+     * Finds versioned message type
+     * @param typeId Type ID
+     * @param major Major version
+     * @param minor Minor version
+     * @param micro Micro version
+     * @return Message type, nullptr if version is not known
+     */
+    const MsgType *find(uint32_t typeId, int major, int minor, int micro) const {
+      if (typeId >= m_versions.size()) {
+        return nullptr;
+      }
+      for (uint32_t id : m_versions[typeId]) {
+        const auto &known = m_msgTypes[id];
+        if (known.m_major == major && known.m_minor == minor && known.m_micro == micro) {
+          return &known;
+        }
+      }
+      return nullptr;
+    }
+
+    /**
+     * Returns versioned message type by ID
+     * @param id ID of versioned message type
+     * @return Message type
+     */
+    const MsgType &get(uint32_t id) const {
+      return m_msgTypes.at(id);
+    }
+
+    /**
+     * Returns number of interned message type names
+     * @return Number of type IDs
+     */
+    size_t getTypeCount() const {
+      return m_typeNames.size();
+    }
+
+    /**
+     * Returns number of interned versioned message types
+     * @return Number of IDs
+     */
+    size_t size() const {
+      return m_msgTypes.size();
+    }
+
+    /**
+     * Parses message version string in format major.minor.micro
+     *
+     * Parsing stops at the first invalid component, remaining components keep their values.
+     * @param ver Version string
+     * @param major Major version
+     * @param minor Minor version
+     * @param micro Micro version
+     */
+    static void parseVersion(std::string_view ver, int &major, int &minor, int &micro) {
+      const char *ptr = ver.data();
+      const char *end = ver.data() + ver.size();
+      int *parts[] = {&major, &minor, &micro};
+      for (size_t i = 0; i < 3; ++i) {
+        if (i > 0) {
+          if (ptr == end || *ptr != '.') {
+            return;
+          }
+          ++ptr;
+        }
+        auto result = std::from_chars(ptr, end, *parts[i]);
+        if (result.ec != std::errc()) {
+          return;
+        }
+        ptr = result.ptr;
+      }
+    }
+
+  private:
+    /**
+     * Interns message type name
+     * @param mType Message type name
+     * @return Type ID
+     */
+    uint32_t internName(const std::string &mType) {
+      uint64_t hash = MsgType::hash(mType);
+      auto found = m_typeIds.find(hash);
+      if (found != m_typeIds.end()) {
+        if (m_typeNames[found->second] != mType) {
+          throw std::logic_error("Message type hash collision: " + mType + " and " + m_typeNames[found->second]);
+        }
+        return found->second;
+      }
+      uint32_t typeId = static_cast<uint32_t>(m_typeNames.size());
+      m_typeIds.insert(std::make_pair(hash, typeId));
+      m_typeNames.push_back(mType);
+      m_versions.emplace_back();
+      return typeId;
+    }
+
+    /// Type IDs by message type name hash
+    std::unordered_map<uint64_t, uint32_t> m_typeIds;
+    /// Message type names by type ID
+    std::vector<std::string> m_typeNames;
+    /// IDs of known versions by type ID
+    std::vector<std::vector<uint32_t>> m_versions;
+    /// Versioned message types by ID
+    std::vector<MsgType> m_msgTypes;
+  };
+}
@@ -0,0 +1,333 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "MessagingCommon.h"
+
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace iqrf {
+
+  /**
+   * Request coalescer
+   *
+   * Tracks requests of idempotent message types waiting in splitter queues. A request semantically identical
+   * to one that is still queued is not queued again, its requester is attached to the queued request instead
+   * and receives a copy of its response with own message ID.
+   *
+   * Requests are identified by messaging instance and message ID, any response with message ID of a tracked
+   * request releases its requesters regardless of the response message type. Requesters of a request that has
+   * not been answered in time after its handling started can be expired and answered by the caller.
+   */
+  class RequestCoalescer {
+  public:
+    typedef std::chrono::steady_clock Clock;
+
+    /// Result of request admission
+    enum class Admission {
+      /// Request has been registered as queued, it has to be pushed to a queue
+      Queue,
+      /// Request has been attached to identical queued request and must not be queued
+      Attached,
+      /// Request reuses identifier of a tracked request, its response could not be told apart
+      DuplicateId,
+    };
+
+    /// Requester waiting for response of coalesced request
+    struct Waiter {
+      /// Messaging instance to send response to
+      MessagingInstance messaging;
+      /// Message ID of the original request
+      std::string msgId;
+      /// Message type of the original request
+      std::string mType;
+    };
+
+    /**
+     * Configures coalescer
+     * @param enabled Coalescing enabled
+     * @param idempotentTypes Message types that can be coalesced
+     */
+    void configure(bool enabled, const std::set<std::string> &idempotentTypes) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      m_enabled = enabled;
+      m_idempotentTypes = idempotentTypes;
+    }
+
+    /**
+     * Checks if requests of message type can be coalesced
+     * @param mType Message type
+     * @return true if coalescing is enabled and message type is idempotent, false otherwise
+     */
+    bool isCoalescable(const std::string &mType) const {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      return m_enabled && m_idempotentTypes.find(mType) != m_idempotentTypes.end();
+    }
+
+    /**
+     * Creates request content key
+     *
+     * Object members are serialized in sorted order and message ID is omitted, so that requests differing
+     * only in member order or message ID produce the same key.
+     * @param doc Request document
+     * @return Request content key
+     */
+    static std::string createKey(const rapidjson::Document &doc) {
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+      writeCanonical(doc, writer, true);
+      return std::string(buffer.GetString(), buffer.GetSize());
+    }
+
+    /**
+     * Attaches request to identical queued request
+     *
+     * If there is no identical request queued, the request is registered as queued and the caller is expected
+     * to push it to a queue and to release it if it is not queued. Responses are matched to requests by messaging
+     * instance and message ID, a request reusing message ID of a tracked request is therefore not admitted, its response
+     * would be sent to requesters attached to the tracked request.
+     * @param key Request content key
+     * @param mType Message type
+     * @param messaging Messaging instance the request came from
+     * @param msgId Message ID
+     * @return Admission result
+     */
+    Admission attach(const std::string &key, const std::string &mType, const MessagingInstance &messaging, const std::string &msgId) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      auto queued = m_queuedByKey.find(key);
+      if (queued != m_queuedByKey.end()) {
+        m_pending.at(queued->second).waiters.push_back({messaging, msgId, mType});
+        return Admission::Attached;
+      }
+      auto id = createId(messaging, msgId);
+      if (m_pending.find(id) != m_pending.end()) {
+        return Admission::DuplicateId;
+      }
+      m_queuedByKey.insert(std::make_pair(key, id));
+      m_pending.insert(std::make_pair(id, Pending{key, messaging, msgId, {}, std::nullopt}));
+      return Admission::Queue;
+    }
+
+    /**
+     * Checks if message ID of messaging instance is used by tracked request
+     * @param messaging Messaging instance
+     * @param msgId Message ID
+     * @return true if request is tracked, false otherwise
+     */
+    bool isTracked(const MessagingInstance &messaging, const std::string &msgId) const {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      return m_pending.find(createId(messaging, msgId)) != m_pending.end();
+    }
+
+    /**
+     * Marks request as taken from queue, identical requests received from now on are queued separately
+     * @param messaging Messaging instance the request came from
+     * @param msgId Message ID
+     */
+    void dequeued(const MessagingInstance &messaging, const std::string &msgId) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      auto pending = m_pending.find(createId(messaging, msgId));
+      if (pending == m_pending.end()) {
+        return;
+      }
+      auto queued = m_queuedByKey.find(pending->second.key);
+      if (queued != m_queuedByKey.end() && queued->second == pending->first) {
+        m_queuedByKey.erase(queued);
+      }
+      if (pending->second.waiters.empty()) {
+        m_pending.erase(pending);
+      } else {
+        pending->second.started = Clock::now();
+      }
+    }
+
+    /**
+     * Releases request and returns requesters waiting for its response
+     * @param messaging Messaging instance the request came from
+     * @param msgId Message ID
+     * @return Waiting requesters
+     */
+    std::list<Waiter> release(const MessagingInstance &messaging, const std::string &msgId) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      auto pending = m_pending.find(createId(messaging, msgId));
+      if (pending == m_pending.end()) {
+        return {};
+      }
+      return erase(pending);
+    }
+
+    /**
+     * Releases requests answered by broadcast response
+     * @param msgId Message ID of the response
+     * @param isRecipient Checks if messaging instance receives the response
+     * @return Waiting requesters
+     */
+    std::list<Waiter> releaseBroadcast(const std::string &msgId, const std::function<bool(const MessagingInstance &)> &isRecipient) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      std::list<Waiter> waiters;
+      for (auto pending = m_pending.begin(); pending != m_pending.end(); ) {
+        auto current = pending++;
+        if (current->second.msgId == msgId && isRecipient(current->second.messaging)) {
+          waiters.splice(waiters.end(), erase(current));
+        }
+      }
+      return waiters;
+    }
+
+    /**
+     * Releases requests whose handling started before deadline and returns their requesters
+     *
+     * Handler of a request may never respond with its message ID, its requesters are expired instead of waiting
+     * indefinitely.
+     * @param deadline Handling start deadline
+     * @return Requesters of expired requests
+     */
+    std::list<Waiter> expire(Clock::time_point deadline) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      std::list<Waiter> waiters;
+      for (auto pending = m_pending.begin(); pending != m_pending.end(); ) {
+        auto current = pending++;
+        if (current->second.started && *current->second.started < deadline) {
+          waiters.splice(waiters.end(), erase(current));
+        }
+      }
+      return waiters;
+    }
+
+    /**
+     * Returns number of tracked requests
+     * @return Number of tracked requests
+     */
+    size_t getPendingCount() const {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      return m_pending.size();
+    }
+
+  private:
+    /// Tracked request
+    struct Pending {
+      /// Request content key
+      std::string key;
+      /// Messaging instance the request came from
+      MessagingInstance messaging;
+      /// Message ID
+      std::string msgId;
+      /// Attached requesters
+      std::list<Waiter> waiters;
+      /// Handling start, unset while the request is queued
+      std::optional<Clock::time_point> started;
+    };
+
+    /**
+     * Creates identifier of a request from its origin
+     * @param messaging Messaging instance the request came from
+     * @param msgId Message ID
+     * @return Request identifier
+     */
+    static std::string createId(const MessagingInstance &messaging, const std::string &msgId) {
+      return messaging.to_string() + '|' + msgId;
+    }
+
+    /**
+     * Stops tracking request, caller holds the mutex
+     * @param pending Tracked request
+     * @return Waiting requesters
+     */
+    std::list<Waiter> erase(std::map<std::string, Pending>::iterator pending) {
+      auto queued = m_queuedByKey.find(pending->second.key);
+      if (queued != m_queuedByKey.end() && queued->second == pending->first) {
+        m_queuedByKey.erase(queued);
+      }
+      std::list<Waiter> waiters = std::move(pending->second.waiters);
+      m_pending.erase(pending);
+      return waiters;
+    }
+
+    /**
+     * Writes value with object members in sorted order
+     * @param val Value to write
+     * @param writer Writer
+     * @param root Value is document root
+     */
+    static void writeCanonical(const rapidjson::Value &val, rapidjson::Writer<rapidjson::StringBuffer> &writer, bool root) {
+      if (val.IsObject()) {
+        std::vector<const rapidjson::Value::Member *> members;
+        members.reserve(val.MemberCount());
+        for (auto itr = val.MemberBegin(); itr != val.MemberEnd(); ++itr) {
+          members.push_back(&(*itr));
+        }
+        std::sort(members.begin(), members.end(), [](const rapidjson::Value::Member *a, const rapidjson::Value::Member *b) {
+          return std::string(a->name.GetString(), a->name.GetStringLength()) < std::string(b->name.GetString(), b->name.GetStringLength());
+        });
+        writer.StartObject();
+        for (const auto *member : members) {
+          writer.Key(member->name.GetString(), member->name.GetStringLength());
+          if (root && member->value.IsObject() && std::string(member->name.GetString()) == "data") {
+            writeData(member->value, writer);
+          } else {
+            writeCanonical(member->value, writer, false);
+          }
+        }
+        writer.EndObject();
+      } else if (val.IsArray()) {
+        writer.StartArray();
+        for (auto itr = val.Begin(); itr != val.End(); ++itr) {
+          writeCanonical(*itr, writer, false);
+        }
+        writer.EndArray();
+      } else {
+        val.Accept(writer);
+      }
+    }
+
+    /**
+     * Writes request data object without message ID
+     * @param data Data object
+     * @param writer Writer
+     */
+    static void writeData(const rapidjson::Value &data, rapidjson::Writer<rapidjson::StringBuffer> &writer) {
+      rapidjson::Document copy(rapidjson::kObjectType);
+      copy.CopyFrom(data, copy.GetAllocator());
+      copy.RemoveMember("msgId");
+      writeCanonical(copy, writer, false);
+    }
+
+    /// Mutex
+    mutable std::mutex m_mtx;
+    /// Coalescing enabled
+    bool m_enabled = false;
+    /// Coalescable message types
+    std::set<std::string> m_idempotentTypes;
+    /// Queued requests by content key
+    std::map<std::string, std::string> m_queuedByKey;
+    /// Tracked requests by identifier
+    std::map<std::string, Pending> m_pending;
+  };
+}
@@ -169,16 +169,23 @@ namespace iqrf {
     int dpaQueueLen = -1;
     int managementQueueLen = -1;
     int networkQueueLen = -1;
+    std::map<std::string, size_t> managementQueueOccupancy;
+    std::map<std::string, size_t> networkQueueOccupancy;
     IIqrfChannelService::State iqrfChannelState = IIqrfChannelService::State::NotReady;
     IIqrfDpaService::DpaState dpaChannelState = IIqrfDpaService::DpaState::NotReady;
     IUdpConnectorService::Mode operMode = IUdpConnectorService::Mode::Unknown;
+    std::map<int, IJsRenderService::ContextMemoryStats> jsContextStats;
+    std::map<int, std::map<std::string, IJsRenderService::FunctionProfile>> jsProfile;
+    bool jsProfiling = false;
     bool enumRunning = false;
     bool dataReadRunning = false;
+    IIqrfDb::SensorStoreStats sensorStoreStats;
 
     using namespace rapidjson;
 
     if (m_dbService) {
       enumRunning = m_dbService->isRunning();
+      sensorStoreStats = m_dbService->getSensorStoreStats();
     }
 
     if (m_dpaService) {
@@ -194,6 +201,16 @@ namespace iqrf {
     if (m_splitterService) {
       managementQueueLen = m_splitterService->getManagementQueueLen();
       networkQueueLen = m_splitterService->getNetworkQueueLen();
+      managementQueueOccupancy = m_splitterService->getManagementQueueOccupancy();
+      networkQueueOccupancy = m_splitterService->getNetworkQueueOccupancy();
+    }
+
+    if (m_jsRenderService) {
+      jsContextStats = m_jsRenderService->getContextMemoryStats();
+      jsProfiling = m_jsRenderService->isProfiling();
+      if (jsProfiling) {
+        jsProfile = m_jsRenderService->getProfile();
+      }
     }
 
     if (m_udpConnectorService) {
@@ -214,9 +231,73 @@ namespace iqrf {
     Pointer("/data/managementQueueLen").Set(doc, managementQueueLen);
     Pointer("/data/networkQueueLen").Set(doc, networkQueueLen);
     Pointer("/data/msgQueueLen").Set(doc, networkQueueLen);
+    Value managementOccupancy(kObjectType);
+    for (const auto &[source, count] : managementQueueOccupancy) {
+      managementOccupancy.AddMember(Value(source.c_str(), doc.GetAllocator()), Value(static_cast<uint64_t>(count)), doc.GetAllocator());
+    }
+    Pointer("/data/managementQueueOccupancy").Set(doc, managementOccupancy);
+    Value networkOccupancy(kObjectType);
+    for (const auto &[source, count] : networkQueueOccupancy) {
+      networkOccupancy.AddMember(Value(source.c_str(), doc.GetAllocator()), Value(static_cast<uint64_t>(count)), doc.GetAllocator());
+    }
+    Pointer("/data/networkQueueOccupancy").Set(doc, networkOccupancy);
     Pointer("/data/operMode").Set(doc, ModeStringConvertor::enum2str(operMode));
     Pointer("/data/enumInProgress").Set(doc, enumRunning);
     Pointer("/data/dataReadingInProgress").Set(doc, dataReadRunning);
+    if (sensorStoreStats.writeBehind) {
+      auto &allocator = doc.GetAllocator();
+      Value sensorStore(kObjectType);
+      sensorStore.AddMember("dirtyValues", static_cast<uint64_t>(sensorStoreStats.dirtyValues), allocator);
+      sensorStore.AddMember("pendingAgeMs", sensorStoreStats.pendingAgeMs, allocator);
+      sensorStore.AddMember("flushes", sensorStoreStats.flushes, allocator);
+      sensorStore.AddMember("failedFlushes", sensorStoreStats.failedFlushes, allocator);
+      sensorStore.AddMember("flushedValues", sensorStoreStats.flushedValues, allocator);
+      sensorStore.AddMember("lastFlushDurationUs", sensorStoreStats.lastFlushDurationUs, allocator);
+      sensorStore.AddMember("maxFlushDurationUs", sensorStoreStats.maxFlushDurationUs, allocator);
+      sensorStore.AddMember("lastFlushLatencyMs", sensorStoreStats.lastFlushLatencyMs, allocator);
+      sensorStore.AddMember("maxFlushLatencyMs", sensorStoreStats.maxFlushLatencyMs, allocator);
+      Pointer("/data/sensorStore").Set(doc, sensorStore);
+    }
+    if (m_jsRenderService) {
+      auto &allocator = doc.GetAllocator();
+      Value jsContexts(kArrayType);
+      for (const auto &[contextId, stats] : jsContextStats) {
+        Value drivers(kArrayType);
+        for (auto driverId : stats.driverIds) {
+          drivers.PushBack(driverId, allocator);
+        }
+        Value context(kObjectType);
+        context.AddMember("contextId", contextId, allocator);
+        context.AddMember("drivers", drivers, allocator);
+        context.AddMember("heapUsers", static_cast<uint64_t>(stats.heapUsers), allocator);
+        context.AddMember("liveBytes", static_cast<uint64_t>(stats.liveBytes), allocator);
+        context.AddMember("peakBytes", static_cast<uint64_t>(stats.peakBytes), allocator);
+        context.AddMember("reservedBytes", static_cast<uint64_t>(stats.reservedBytes), allocator);
+        context.AddMember("limitBytes", static_cast<uint64_t>(stats.limitBytes), allocator);
+        context.AddMember("limitHits", static_cast<uint64_t>(stats.limitHits), allocator);
+        jsContexts.PushBack(context, allocator);
+      }
+      Pointer("/data/jsContexts").Set(doc, jsContexts);
+    }
+    if (jsProfiling) {
+      auto &allocator = doc.GetAllocator();
+      Value functions(kArrayType);
+      for (const auto &[contextId, contextProfile] : jsProfile) {
+        for (const auto &[name, profile] : contextProfile) {
+          Value function(kObjectType);
+          function.AddMember("contextId", contextId, allocator);
+          function.AddMember("function", Value(name.c_str(), allocator), allocator);
+          function.AddMember("calls", profile.calls, allocator);
+          function.AddMember("errors", profile.errors, allocator);
+          function.AddMember("totalTimeNs", profile.totalTimeNs, allocator);
+          function.AddMember("maxTimeNs", profile.maxTimeNs, allocator);
+          function.AddMember("heapGrowthBytes", profile.heapGrowthBytes, allocator);
+          function.AddMember("maxHeapGrowthBytes", profile.maxHeapGrowthBytes, allocator);
+          functions.PushBack(function, allocator);
+        }
+      }
+      Pointer("/data/jsProfile").Set(doc, functions);
+    }
     return doc;
   }
 
@@ -296,6 +377,16 @@ namespace iqrf {
     }
   }
 
+  void MonitorService::attachInterface(IJsRenderService* iface) {
+    m_jsRenderService = iface;
+  }
+
+  void MonitorService::detachInterface(IJsRenderService* iface) {
+    if (m_jsRenderService == iface) {
+      m_jsRenderService = nullptr;
+    }
+  }
+
   void MonitorService::attachInterface(IMessagingSplitterService* iface) {
     m_splitterService = iface;
     m_splitterService->registerFilteredMsgHandler(
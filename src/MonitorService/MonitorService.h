@@ -21,6 +21,7 @@
 #include "IIqrfDb.h"
 #include "IIqrfDpaService.h"
 #include "IIqrfSensorData.h"
+#include "IJsRenderService.h"
 #include "IMessagingSplitterService.h"
 #include "IUdpConnectorService.h"
 #include "ILaunchService.h"
@@ -129,6 +130,18 @@ namespace iqrf {
      */
     void detachInterface(iqrf::IIqrfSensorData* iface);
 
+    /**
+     * Attaches JS render service interface
+     * @param iface JS render service interface
+     */
+    void attachInterface(iqrf::IJsRenderService* iface);
+
+    /**
+     * Detaches JS render service interface
+     * @param iface JS render service interface
+     */
+    void detachInterface(iqrf::IJsRenderService* iface);
+
     /**
      * Attaches splitter service interface
      * @param iface Splitter service interface
@@ -211,6 +224,8 @@ namespace iqrf {
     IIqrfDpaService *m_dpaService = nullptr;
     /// Sensor data service interface
     IIqrfSensorData *m_sensorDataService = nullptr;
+    /// JS render service interface
+    IJsRenderService *m_jsRenderService = nullptr;
     /// Splitter service interface
     IMessagingSplitterService *m_splitterService = nullptr;
     /// UDP connector service
@@ -1,5 +1,6 @@
 #include <boost/program_options.hpp>
-#include <cpr/cpr.h>
+#include "CurlUtils.h"
+#include "ZipUtils.h"
 #include <nlohmann/json.hpp>
 #include <valijson/adapters/nlohmann_json_adapter.hpp>
 #include <valijson/utils/nlohmann_json_utils.hpp>
@@ -7,7 +8,6 @@
 #include <valijson/schema_parser.hpp>
 #include <valijson/validation_results.hpp>
 #include <valijson/validator.hpp>
-#include <zip.h>
 #include <iostream>
 #include <fstream>
 #include <string>
@@ -31,82 +31,35 @@ static void free_document(const json *adapter) {
   delete adapter;
 }
 
-void get_server_check(const std::string &url) {
-  cpr::Response rsp = cpr::Get(
-    cpr::Url{url + "/server"},
-    cpr::Header{{"accept", "application/json"}}
-  );
-  if (rsp.status_code != 200) {
-    throw std::logic_error("Cannot get server state file, status code: " + std::to_string(rsp.status_code));
+void download_cache(const std::string &url) {
+  // server state and archive are fetched concurrently, interrupted transfers are resumed
+  try {
+    iqrf::CurlUtils::downloadFiles({
+      {url + "/server", "serverCheck.json", {{"accept", "application/json"}}},
+      {url + "/zip", "cache.zip", {{"accept", "application/zip"}}},
+    });
+  } catch (const std::runtime_error &e) {
+    throw std::logic_error("Cannot download cache: " + std::string(e.what()));
+  }
+  json doc;
+  {
+    std::ifstream file("serverCheck.json");
+    doc = json::parse(file);
   }
-  json doc = json::parse(rsp.text);
   std::ofstream file("serverCheck.json");
   file << doc;
-}
-
-void download_cache(const std::string &url) {
-  cpr::Response rsp = cpr::Get(
-    cpr::Url{url + "/zip"},
-    cpr::Header{{"accept", "application/zip"}}
-  );
-  if (rsp.status_code != 200) {
-    throw std::logic_error("Cannot download zip file, status code: " + std::to_string(rsp.status_code));
-  }
-  std::ofstream file("cache.zip", std::ios::binary);
-  file << rsp.text;
+  file.close();
   // extract
-  constexpr zip_uint64_t BUF_SIZE = 8196;
-  char buf[BUF_SIZE];
-  int err = 0;
-  zip_t *archive = zip_open("cache.zip", 0, &err);
-  if (archive == nullptr) {
-    zip_error_t error;
-    zip_error_init_with_code(&error, err);
-    const std::string errorMessage = zip_error_strerror(&error);
-    zip_error_fini(&error);
-    throw std::logic_error("Cannot open zip archive, error: " + errorMessage);
-  }
   if (std::filesystem::exists("cache")) {
     std::filesystem::remove_all("cache");
   }
   if (!std::filesystem::create_directory("cache")) {
     throw std::logic_error("Cannot create cache directory.");
   }
-  zip_int64_t num_entries = zip_get_num_entries(archive, 0);
-  auto current_path = std::filesystem::current_path();
-  for (zip_uint64_t i = 0; i < static_cast<zip_uint64_t>(num_entries); ++i) {
-    std::string name = zip_get_name(archive, i, 0);
-
-    zip_stat_t zip_stat;
-    err = zip_stat_index(archive, i, 0, &zip_stat);
-    if (err != 0) {
-      throw std::logic_error("Cannot obtain information about file in zip: " + name);
-    }
-    zip_file_t *zip_file = zip_fopen_index(archive, i, 0);
-    if (!zip_file) {
-      throw std::logic_error("Cannot open file in zip: " + name);
-    }
-    std::string extracted_file_name = current_path.string() + "/cache/" + name;
-    auto extracted_file_path = std::filesystem::path(extracted_file_name);
-    if (!std::filesystem::exists(extracted_file_path.parent_path())) {
-      if (!std::filesystem::create_directories(extracted_file_path.parent_path())) {
-        throw std::logic_error("Cannot create cache directory tree structure: " + extracted_file_path.parent_path().string());
-      }
-    }
-    std::ofstream extracted(extracted_file_name, std::ofstream::binary | std::ios::trunc);
-    zip_uint64_t sum = 0;
-    zip_int64_t len = 0;
-    while (sum != zip_stat.size) {
-      len = zip_fread(zip_file, buf, BUF_SIZE);
-      if (len < 0) {
-        throw std::logic_error("cannot read file " + name);
-      }
-      extracted.write(buf, len);
-      sum += len;
-    }
-
-    extracted.close();
-    zip_fclose(zip_file);
+  try {
+    iqrf::ZipUtils::extractArchive("cache.zip", "cache");
+  } catch (const std::runtime_error &e) {
+    throw std::logic_error(e.what());
   }
 }
 
@@ -397,7 +350,6 @@ int main(int argc, char** argv) {
     }
     std::filesystem::current_path(std::filesystem::path(path));
     const std::string url = dev ? DEV_API_URL : API_URL;
-    get_server_check(url);
     download_cache(url);
     validate_companies_file();
     validate_manufacturers_file();
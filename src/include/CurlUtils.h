@@ -17,15 +17,38 @@
 #pragma once
 
 #include <cpr/cpr.h>
+#include <curl/curl.h>
 
+#include <algorithm>
+#include <cctype>
 #include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace iqrf {
 
 	class CurlUtils {
 	public:
+		/// File download
+		struct Download {
+			/// File URL
+			std::string url;
+			/// Target file path
+			std::string filePath;
+			/// Request headers
+			std::map<std::string, std::string> headers;
+		};
+
 		static void downloadFile(const std::string &url, const std::string &filePath, std::map<std::string, std::string> headers = {}) {
 			cpr::Response rsp = cpr::Get(
 					cpr::Url(url),
@@ -47,7 +70,312 @@ namespace iqrf {
 			file.close();
 		}
 
+		/**
+		 * Downloads file, interrupted transfer is resumed from the already downloaded part
+		 *
+		 * Response is streamed to partial file next to the target file, which is replaced once the transfer
+		 * completes. Failed transfers are retried and each attempt requests only the missing range. Partial
+		 * file is kept across calls, it is resumed only if the server identified the file by ETag or
+		 * Last-Modified header, and the server sends the whole file again if it changed meanwhile. Partial content
+		 * not starting at the end of partial file is discarded together with the partial file.
+		 * @param url File URL
+		 * @param filePath Target file path
+		 * @param headers Request headers
+		 * @param attempts Maximum number of transfer attempts
+		 * @param retryDelay Delay before the second attempt, doubled with each following attempt
+		 */
+		static void downloadFileResumable(
+			const std::string &url,
+			const std::string &filePath,
+			const std::map<std::string, std::string> &headers = {},
+			unsigned int attempts = 5,
+			std::chrono::milliseconds retryDelay = std::chrono::seconds(1)
+		) {
+			try {
+				createDirectory(filePath);
+			} catch (const std::filesystem::filesystem_error &e) {
+				throw std::runtime_error("Unable to create parent directory for file: " + std::string(e.what()));
+			}
+			const std::string partPath = filePath + ".part";
+			const std::string tagPath = filePath + ".part.tag";
+			std::string error = "no attempt";
+			for (unsigned int attempt = 0; attempt < attempts; ++attempt) {
+				if (attempt > 0) {
+					std::this_thread::sleep_for(retryDelay * (1 << std::min(attempt - 1, 5u)));
+				}
+				Transfer transfer(partPath, tagPath);
+				TransferStatus status = transfer.perform(url, headers, error);
+				if (status == TransferStatus::COMPLETE) {
+					std::error_code ec;
+					std::filesystem::remove(tagPath, ec);
+					std::filesystem::rename(partPath, filePath, ec);
+					if (ec) {
+						throw std::runtime_error("Unable to create file " + filePath + ":" + ec.message());
+					}
+					return;
+				}
+				if (status == TransferStatus::FAILED) {
+					break;
+				}
+			}
+			throw std::runtime_error("Unable to download file " + url + ":" + error);
+		}
+
+		/**
+		 * Downloads independent files concurrently
+		 * @param downloads Files to download
+		 * @param attempts Maximum number of transfer attempts of each file
+		 * @param retryDelay Delay before the second attempt, doubled with each following attempt
+		 */
+		static void downloadFiles(
+			const std::vector<Download> &downloads,
+			unsigned int attempts = 5,
+			std::chrono::milliseconds retryDelay = std::chrono::seconds(1)
+		) {
+			std::vector<std::exception_ptr> errors(downloads.size());
+			std::vector<std::thread> threads;
+			for (size_t i = 0; i < downloads.size(); ++i) {
+				threads.emplace_back([&, i]() {
+					try {
+						downloadFileResumable(downloads[i].url, downloads[i].filePath, downloads[i].headers, attempts, retryDelay);
+					} catch (...) {
+						errors[i] = std::current_exception();
+					}
+				});
+			}
+			for (auto &thread : threads) {
+				thread.join();
+			}
+			for (const auto &error : errors) {
+				if (error) {
+					std::rethrow_exception(error);
+				}
+			}
+		}
+
 	private:
+		/// Result of single transfer attempt
+		enum class TransferStatus {
+			/// File is downloaded
+			COMPLETE,
+			/// Transfer can be retried
+			INTERRUPTED,
+			/// Transfer failed permanently
+			FAILED
+		};
+
+		/// Single transfer attempt streaming response to partial file
+		class Transfer {
+		public:
+			Transfer(const std::string &partPath, const std::string &tagPath) : m_partPath(partPath), m_tagPath(tagPath) {
+				// partial file without validator cannot be resumed safely
+				std::error_code ec;
+				std::ifstream tagFile(m_tagPath);
+				if (std::getline(tagFile, m_resumeTag) && !m_resumeTag.empty()) {
+					auto size = std::filesystem::file_size(m_partPath, ec);
+					m_offset = ec ? 0 : size;
+				}
+				if (m_offset == 0) {
+					m_resumeTag.clear();
+					std::filesystem::remove(m_partPath, ec);
+					std::filesystem::remove(m_tagPath, ec);
+				}
+			}
+
+			TransferStatus perform(const std::string &url, const std::map<std::string, std::string> &headers, std::string &error) {
+				// libcurl global state is initialized once for all transfers
+				static const CURLcode globalInit = curl_global_init(CURL_GLOBAL_DEFAULT);
+				if (globalInit != CURLE_OK) {
+					error = curl_easy_strerror(globalInit);
+					return TransferStatus::FAILED;
+				}
+				m_curl = curl_easy_init();
+				if (m_curl == nullptr) {
+					error = "Unable to initialize transfer";
+					return TransferStatus::FAILED;
+				}
+				curl_slist *headerList = nullptr;
+				for (const auto &[name, value] : headers) {
+					headerList = curl_slist_append(headerList, (name + ": " + value).c_str());
+				}
+				// unlike resume option, range request accepts full response sent when the file changed
+				const std::string range = std::to_string(m_offset) + "-";
+				if (m_offset > 0) {
+					headerList = curl_slist_append(headerList, ("If-Range: " + m_resumeTag).c_str());
+					curl_easy_setopt(m_curl, CURLOPT_RANGE, range.c_str());
+				}
+				char errorBuffer[CURL_ERROR_SIZE] = {0};
+				curl_easy_setopt(m_curl, CURLOPT_URL, url.c_str());
+				curl_easy_setopt(m_curl, CURLOPT_HTTPHEADER, headerList);
+				curl_easy_setopt(m_curl, CURLOPT_FOLLOWLOCATION, 1L);
+				curl_easy_setopt(m_curl, CURLOPT_NOSIGNAL, 1L);
+				curl_easy_setopt(m_curl, CURLOPT_ERRORBUFFER, errorBuffer);
+				curl_easy_setopt(m_curl, CURLOPT_CONNECTTIMEOUT, CONNECT_TIMEOUT);
+				// stalled transfer is interrupted and resumed by the next attempt
+				curl_easy_setopt(m_curl, CURLOPT_LOW_SPEED_LIMIT, 1L);
+				curl_easy_setopt(m_curl, CURLOPT_LOW_SPEED_TIME, STALL_TIMEOUT);
+				curl_easy_setopt(m_curl, CURLOPT_WRITEFUNCTION, &Transfer::writeCallback);
+				curl_easy_setopt(m_curl, CURLOPT_WRITEDATA, this);
+				curl_easy_setopt(m_curl, CURLOPT_HEADERFUNCTION, &Transfer::headerCallback);
+				curl_easy_setopt(m_curl, CURLOPT_HEADERDATA, this);
+
+				CURLcode res = curl_easy_perform(m_curl);
+				long code = 0;
+				curl_easy_getinfo(m_curl, CURLINFO_RESPONSE_CODE, &code);
+				curl_easy_cleanup(m_curl);
+				curl_slist_free_all(headerList);
+				m_curl = nullptr;
+				if (m_file.is_open()) {
+					m_file.close();
+				}
+
+				if (res == CURLE_OK && (code == 200 || code == 206)) {
+					if (!m_started) {
+						// empty response body
+						std::ofstream(m_partPath, std::ios::binary | std::ios::trunc);
+					}
+					return TransferStatus::COMPLETE;
+				}
+				std::error_code ec;
+				if (m_rangeMismatch) {
+					// partial content does not continue partial file, start over
+					std::filesystem::remove(m_partPath, ec);
+					std::filesystem::remove(m_tagPath, ec);
+					error = "unexpected content range";
+					return TransferStatus::INTERRUPTED;
+				}
+				if (code == 416 && m_unsatisfiedSize == m_offset) {
+					// partial file was complete already
+					return TransferStatus::COMPLETE;
+				}
+				if (code == 416) {
+					// range of partial file does not exist anymore, start over
+					std::filesystem::remove(m_partPath, ec);
+					std::filesystem::remove(m_tagPath, ec);
+					error = "requested range not satisfiable";
+					return TransferStatus::INTERRUPTED;
+				}
+				if (code >= 400 && code < 500) {
+					std::filesystem::remove(m_partPath, ec);
+					std::filesystem::remove(m_tagPath, ec);
+					error = "HTTP status " + std::to_string(code);
+					return TransferStatus::FAILED;
+				}
+				if (res != CURLE_OK) {
+					error = errorBuffer[0] != '\0' ? std::string(errorBuffer) : std::string(curl_easy_strerror(res));
+				} else {
+					error = "HTTP status " + std::to_string(code);
+				}
+				// keep downloaded part for the next attempt
+				if (m_accepted && !m_tag.empty()) {
+					std::ofstream tagFile(m_tagPath, std::ios::trunc);
+					tagFile << m_tag;
+				}
+				return TransferStatus::INTERRUPTED;
+			}
+
+		private:
+			static size_t writeCallback(char *data, size_t size, size_t count, void *userdata) {
+				auto *transfer = static_cast<Transfer *>(userdata);
+				const size_t length = size * count;
+				if (!transfer->m_started) {
+					transfer->m_started = true;
+					long code = 0;
+					curl_easy_getinfo(transfer->m_curl, CURLINFO_RESPONSE_CODE, &code);
+					if (code == 206) {
+						if (transfer->m_rangeStart != transfer->m_offset) {
+							transfer->m_rangeMismatch = true;
+							return 0;
+						}
+						transfer->m_file.open(transfer->m_partPath, std::ios::binary | std::ios::app);
+					} else if (code == 200) {
+						// range was not honored or file changed, whole file follows
+						transfer->m_file.open(transfer->m_partPath, std::ios::binary | std::ios::trunc);
+					} else {
+						return length;
+					}
+					if (!transfer->m_file.is_open()) {
+						return 0;
+					}
+					transfer->m_accepted = true;
+				}
+				if (!transfer->m_accepted) {
+					// error response body is not stored
+					return length;
+				}
+				transfer->m_file.write(data, static_cast<std::streamsize>(length));
+				return transfer->m_file ? length : 0;
+			}
+
+			static size_t headerCallback(char *data, size_t size, size_t count, void *userdata) {
+				auto *transfer = static_cast<Transfer *>(userdata);
+				const size_t length = size * count;
+				std::string header(data, length);
+				while (!header.empty() && (header.back() == '\r' || header.back() == '\n')) {
+					header.pop_back();
+				}
+				if (header.rfind("HTTP/", 0) == 0) {
+					// status line of next response (redirect), validators of previous one do not apply
+					transfer->m_etag.clear();
+					transfer->m_lastModified.clear();
+					transfer->m_rangeStart = UINT64_MAX;
+				}
+				auto colon = header.find(':');
+				if (colon != std::string::npos) {
+					std::string name = header.substr(0, colon);
+					std::transform(name.begin(), name.end(), name.begin(), [](unsigned char c) { return std::tolower(c); });
+					size_t valueStart = header.find_first_not_of(' ', colon + 1);
+					std::string value = valueStart == std::string::npos ? std::string() : header.substr(valueStart);
+					// weak entity tags cannot be used in If-Range
+					if (name == "etag" && value.rfind("W/", 0) != 0) {
+						transfer->m_etag = value;
+					} else if (name == "last-modified") {
+						transfer->m_lastModified = value;
+					} else if (name == "content-range" && value.rfind("bytes */", 0) == 0) {
+						transfer->m_unsatisfiedSize = std::strtoull(value.c_str() + 8, nullptr, 10);
+					} else if (name == "content-range" && value.rfind("bytes ", 0) == 0 && std::isdigit(static_cast<unsigned char>(value[6]))) {
+						transfer->m_rangeStart = std::strtoull(value.c_str() + 6, nullptr, 10);
+					}
+				}
+				transfer->m_tag = !transfer->m_etag.empty() ? transfer->m_etag : transfer->m_lastModified;
+				return length;
+			}
+
+			/// Connection timeout in seconds
+			static constexpr long CONNECT_TIMEOUT = 30;
+			/// Transfer without received data for this number of seconds is interrupted
+			static constexpr long STALL_TIMEOUT = 60;
+
+			/// Transfer handle
+			CURL *m_curl = nullptr;
+			/// Partial file path
+			std::string m_partPath;
+			/// Partial file validator path
+			std::string m_tagPath;
+			/// Validator of partial file
+			std::string m_resumeTag;
+			/// Size of partial file to resume from
+			uint64_t m_offset = 0;
+			/// Partial file
+			std::ofstream m_file;
+			/// Response body started
+			bool m_started = false;
+			/// Response body is stored to partial file
+			bool m_accepted = false;
+			/// Entity tag of response
+			std::string m_etag;
+			/// Last modification time of response
+			std::string m_lastModified;
+			/// Validator of response
+			std::string m_tag;
+			/// File size reported with unsatisfiable range
+			uint64_t m_unsatisfiedSize = UINT64_MAX;
+			/// Start of partial content, UINT64_MAX if not reported
+			uint64_t m_rangeStart = UINT64_MAX;
+			/// Partial content does not continue partial file
+			bool m_rangeMismatch = false;
+		};
+
 		static void createDirectory(const std::string &path) {
 			if (std::filesystem::exists(path)) {
 				return;
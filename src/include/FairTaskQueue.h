@@ -0,0 +1,260 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <optional>
+#include <queue>
+
+/// \class FairTaskQueue
+/// \brief Maintain per-source queues of tasks and invoke sequential processing
+/// \details
+/// Provide asynchronous processing of incoming tasks of type T in dedicated worker thread.
+/// Tasks are stored in FIFO sub-queues per source of type K and the sub-queues are served
+/// by deficit round-robin, so a source flooding the queue cannot starve the other sources.
+/// Every task costs one unit, the quantum of a source sets the number of tasks it may have
+/// processed per round. Processing function is passed as parameter in constructor.
+template <class K, class T>
+class FairTaskQueue {
+public:
+  /// Processing function type
+  typedef std::function<void(T)> ProcessTaskFunc;
+
+  /// \brief constructor
+  /// \param [in] processTaskFunc processing function
+  /// \details
+  /// Processing function is used in dedicated worker thread to process incoming queued tasks.
+  /// The function must be thread safe. The worker thread is started.
+  FairTaskQueue(ProcessTaskFunc processTaskFunc): m_processTaskFunc(processTaskFunc) {
+    m_taskPushed = false;
+    m_runWorkerThread = true;
+    m_workerThread = std::thread(&FairTaskQueue::worker, this);
+  }
+
+  /// \brief destructor
+  /// \details
+  /// Stops working thread
+  virtual ~FairTaskQueue() {
+    stopQueue();
+  }
+
+  /// \brief Push task to source queue
+  /// \param [in] source task source
+  /// \param [in] task object to push to queue
+  /// \return size of source queue
+  /// \details
+  /// Pushes task to source queue to be processed in worker thread. The task type T has to be copyable
+  /// as the copy is pushed to queue container
+  size_t pushToQueue(const K& source, const T& task) {
+    size_t retval = 0;
+    {
+      std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+      auto &sourceQueue = m_sourceQueues[source];
+      if (sourceQueue.tasks.empty()) {
+        sourceQueue.deficit = 0;
+        m_activeSources.push_back(source);
+      }
+      sourceQueue.tasks.push(task);
+      retval = sourceQueue.tasks.size();
+      ++m_size;
+      m_taskPushed = true;
+    }
+    m_conditionVariable.notify_all();
+    return retval;
+  }
+
+  /// \brief Set source quantum
+  /// \param [in] source task source
+  /// \param [in] quantum number of tasks processed per round, at least 1
+  void setQuantum(const K& source, size_t quantum) {
+    std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+    m_quanta[source] = quantum > 0 ? quantum : 1;
+  }
+
+  /// @brief Start queue
+  /// \details
+  /// Starts worker thread
+  void startQueue() {
+    if (m_runWorkerThread) {
+      return;
+    }
+
+    m_taskPushed = size() > 0;
+    m_runWorkerThread = true;
+    m_workerThread = std::thread(&FairTaskQueue::worker, this);
+
+    if (m_taskPushed) {
+      m_conditionVariable.notify_all();
+    }
+  }
+
+  /// \brief Stop queue
+  /// \details
+  /// Stops worker thread
+  void stopQueue() {
+    {
+      std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+      m_runWorkerThread = false;
+      m_taskPushed = true;
+    }
+    m_conditionVariable.notify_all();
+
+    if (m_workerThread.joinable()) {
+      m_workerThread.join();
+    }
+  }
+
+  /// \brief Clear queue
+  /// \details
+  /// Clears tasks of all sources
+  void clearQueue() {
+    std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+    m_sourceQueues.clear();
+    m_activeSources.clear();
+    m_size = 0;
+  }
+
+  /// \brief Get actual queue size
+  /// \return number of tasks of all sources
+  size_t size() {
+    std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+    return m_size;
+  }
+
+  /// \brief Get actual source queue size
+  /// \param [in] source task source
+  /// \return number of tasks of source
+  size_t size(const K& source) {
+    std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+    auto found = m_sourceQueues.find(source);
+    return found != m_sourceQueues.end() ? found->second.tasks.size() : 0;
+  }
+
+  /// \brief Get occupancy of source queues
+  /// \return map of sources with queued tasks and their task counts
+  std::map<K, size_t> getOccupancy() {
+    std::map<K, size_t> occupancy;
+    std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+    for (const auto &source : m_activeSources) {
+      occupancy[source] = m_sourceQueues[source].tasks.size();
+    }
+    return occupancy;
+  }
+
+  /// \brief Get queue active state
+  /// \return Queue active state
+  bool isActive() {
+    std::unique_lock<std::mutex> lock(m_taskQueueMutex);
+    return m_runWorkerThread;
+  }
+
+private:
+  /// Source sub-queue
+  struct SourceQueue {
+    /// Queued tasks
+    std::queue<T> tasks;
+    /// Unused quantum carried over from previous visit
+    size_t deficit = 0;
+  };
+
+  /// \brief Take next task in deficit round-robin order
+  /// \return next task, empty if all source queues are empty
+  /// \details
+  /// Must be called with queue mutex locked
+  std::optional<T> takeNext() {
+    while (!m_activeSources.empty()) {
+      const K source = m_activeSources.front();
+      auto &sourceQueue = m_sourceQueues[source];
+      if (sourceQueue.tasks.empty()) {
+        m_activeSources.pop_front();
+        m_sourceQueues.erase(source);
+        continue;
+      }
+      if (sourceQueue.deficit == 0) {
+        auto quantum = m_quanta.find(source);
+        sourceQueue.deficit = quantum != m_quanta.end() ? quantum->second : 1;
+      }
+      std::optional<T> task(std::move(sourceQueue.tasks.front()));
+      sourceQueue.tasks.pop();
+      --sourceQueue.deficit;
+      --m_size;
+      if (sourceQueue.tasks.empty()) {
+        // idle source loses its deficit
+        m_activeSources.pop_front();
+        m_sourceQueues.erase(source);
+      } else if (sourceQueue.deficit == 0) {
+        // quantum spent, move to the end of round
+        m_activeSources.pop_front();
+        m_activeSources.push_back(source);
+      }
+      return task;
+    }
+    return std::nullopt;
+  }
+
+  /// Worker thread function
+  void worker() {
+    std::unique_lock<std::mutex> lock(m_taskQueueMutex, std::defer_lock);
+
+    while (m_runWorkerThread) {
+
+      //wait for something in the queue
+      lock.lock();
+      m_conditionVariable.wait(lock, [&] { return m_taskPushed; }); //lock is released in wait
+      //lock is reacquired here
+      m_taskPushed = false;
+
+      while (m_runWorkerThread) {
+        auto task = takeNext();
+        if (task) {
+          lock.unlock();
+          m_processTaskFunc(std::move(*task));
+        } else {
+          lock.unlock();
+          break;
+        }
+        lock.lock(); //lock for next iteration
+      }
+    }
+  }
+
+  /// Mutex
+  std::mutex m_taskQueueMutex;
+  /// Condition variable
+  std::condition_variable m_conditionVariable;
+  /// Source queues
+  std::map<K, SourceQueue> m_sourceQueues;
+  /// Sources with queued tasks in round-robin order
+  std::list<K> m_activeSources;
+  /// Source quanta
+  std::map<K, size_t> m_quanta;
+  /// Number of tasks of all sources
+  size_t m_size = 0;
+  /// Task pushed to queue, ready to be handled
+  bool m_taskPushed;
+  /// Run worker thread
+  bool m_runWorkerThread;
+  /// Worker thread
+  std::thread m_workerThread;
+  /// Task function
+  ProcessTaskFunc m_processTaskFunc;
+};
@@ -163,6 +163,32 @@ namespace iqrf {
     /// Enumeration handler type
     typedef std::function<void(EnumerationProgress)> EnumerationHandler;
 
+    /**
+     * Write-behind sensor value store statistics
+     */
+    struct SensorStoreStats {
+      /// Sensor values are kept in memory and written periodically
+      bool writeBehind = false;
+      /// Number of values not written to database yet
+      size_t dirtyValues = 0;
+      /// Time the oldest value not written to database waits in milliseconds
+      uint64_t pendingAgeMs = 0;
+      /// Number of flushes
+      uint64_t flushes = 0;
+      /// Number of failed flushes
+      uint64_t failedFlushes = 0;
+      /// Number of values written by flushes
+      uint64_t flushedValues = 0;
+      /// Duration of last flush in microseconds
+      uint64_t lastFlushDurationUs = 0;
+      /// Maximal duration of flush in microseconds
+      uint64_t maxFlushDurationUs = 0;
+      /// Time the oldest value written by last flush waited in memory in milliseconds
+      uint64_t lastFlushLatencyMs = 0;
+      /// Maximal time a written value waited in memory in milliseconds
+      uint64_t maxFlushLatencyMs = 0;
+    };
+
     /**
      * Check if enumeration is in progress
      * @return true if enumeration is in progress, false otherwise
@@ -187,6 +213,8 @@ namespace iqrf {
 
     /**
      * Reloads all drivers
+     *
+     * Contexts with unchanged code are kept, running driver calls are not interrupted.
      */
     virtual void reloadDrivers() = 0;
 
@@ -431,5 +459,11 @@ namespace iqrf {
      * @param clientId Handler owner
      */
     virtual void unregisterEnumerationHandler(const std::string &clientId) = 0;
+
+    /**
+     * Returns statistics of write-behind sensor value store
+     * @return Sensor value store statistics
+     */
+    virtual SensorStoreStats getSensorStoreStats() = 0;
 	};
 }
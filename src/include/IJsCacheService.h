@@ -111,8 +111,8 @@ namespace iqrf {
         int id,
         const std::string &name,
         double version,
-        const std::shared_ptr<std::string> &driver,
-        const std::shared_ptr<std::string> &notes,
+        const std::shared_ptr<const std::string> &driver,
+        const std::shared_ptr<const std::string> &notes,
         int verFlags
       ):
         m_id(id),
@@ -124,8 +124,8 @@ namespace iqrf {
       {}
 
       const std::string & getName() const { return m_name; }
-      const std::shared_ptr<std::string> & getDriver() const { return m_driver; }
-      const std::shared_ptr<std::string> & getNotes() const { return m_notes; }
+      const std::shared_ptr<const std::string> & getDriver() const { return m_driver; }
+      const std::shared_ptr<const std::string> & getNotes() const { return m_notes; }
       int getVersionFlags() const { return m_versionFlags; }
       double getVersion() const { return m_version; }
       int getId() const { return m_id; }
@@ -134,8 +134,8 @@ namespace iqrf {
       double m_version = 0;
       int m_versionFlags = 0;
       std::string m_name;
-      std::shared_ptr<std::string> m_driver;
-      std::shared_ptr<std::string> m_notes;
+      std::shared_ptr<const std::string> m_driver;
+      std::shared_ptr<const std::string> m_notes;
     };
 
     ///// Standard /////
@@ -164,7 +164,7 @@ namespace iqrf {
         const std::string &os,
         const std::string &dpa,
         const std::string &notes,
-        const std::string &driver,
+        const std::shared_ptr<const std::string> &driver,
         const std::vector<StdDriver> &driverVect
       ):
         m_packageId(packageId),
@@ -187,7 +187,8 @@ namespace iqrf {
       std::string m_os;
       std::string m_dpa;
       std::string m_notes;
-      std::string m_driver;
+      /// Custom driver source, never null, shared by all packages with identical source
+      std::shared_ptr<const std::string> m_driver;
       std::vector<StdDriver> m_stdDriverVect;
     };
 
@@ -280,19 +281,20 @@ namespace iqrf {
       UPDATE_FAILED,
     };
 
-    virtual std::shared_ptr<StdDriver> getDriver(int id, double ver) const = 0;
-    virtual std::shared_ptr<StdDriver> getLatestDriver(int id) const = 0;
-    virtual std::shared_ptr<Manufacturer> getManufacturer(uint16_t hwpid) const = 0;
-    virtual std::shared_ptr<Product> getProduct(uint16_t hwpid) const = 0;
-    virtual const metadata::Metadata* getProductMetadata(uint16_t hwpid, uint16_t hwpidVer) const = 0;
-    virtual std::shared_ptr<Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, const std::string& os, const std::string& dpa) const = 0;
-    virtual std::shared_ptr<Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, uint16_t os, uint16_t dpa) const = 0;
+    // Entries are shared read-only aliases into the cache content, they stay valid after cache reload
+    virtual std::shared_ptr<const StdDriver> getDriver(int id, double ver) const = 0;
+    virtual std::shared_ptr<const StdDriver> getLatestDriver(int id) const = 0;
+    virtual std::shared_ptr<const Manufacturer> getManufacturer(uint16_t hwpid) const = 0;
+    virtual std::shared_ptr<const Product> getProduct(uint16_t hwpid) const = 0;
+    virtual std::shared_ptr<const metadata::Metadata> getProductMetadata(uint16_t hwpid, uint16_t hwpidVer) const = 0;
+    virtual std::shared_ptr<const Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, const std::string& os, const std::string& dpa) const = 0;
+    virtual std::shared_ptr<const Package> getPackage(uint16_t hwpid, uint16_t hwpidVer, uint16_t os, uint16_t dpa) const = 0;
     virtual std::map<int, std::map<double, std::vector<std::pair<int,int>>>> getDrivers(const std::string& os, const std::string& dpa) const = 0;
     virtual std::map<int, std::map<int, std::string>> getCustomDrivers(const std::string& os, const std::string& dpa) const = 0;
     virtual MapOsListDpa getOsDpa() const = 0;
-    virtual std::shared_ptr<OsDpa> getOsDpa(int id) const = 0;
-    virtual std::shared_ptr<OsDpa> getOsDpa(const std::string& os, const std::string& dpa) const = 0;
-    virtual std::shared_ptr<Quantity> getQuantity(uint8_t type) const = 0;
+    virtual std::shared_ptr<const OsDpa> getOsDpa(int id) const = 0;
+    virtual std::shared_ptr<const OsDpa> getOsDpa(const std::string& os, const std::string& dpa) const = 0;
+    virtual std::shared_ptr<const Quantity> getQuantity(uint8_t type) const = 0;
     virtual ServerState getServerState() const = 0;
     virtual std::tuple<CacheStatus, std::string> invokeWorker() = 0;
 
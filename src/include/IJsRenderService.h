@@ -16,7 +16,11 @@
  */
 #pragma once
 
+#include "rapidjson/document.h"
+
+#include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
 #include <set>
@@ -32,6 +36,58 @@ namespace iqrf {
 		static const int HWPID_DEFAULT_MAPPING = -0x10000;
 		static const int HWPID_MAPPING_SPACE = -0x20000;
 
+		/**
+		 * Driver context heap statistics
+		 */
+		struct HeapStats {
+			/// Number of contexts
+			size_t contextCount = 0;
+			/// Number of heaps, contexts with identical code share a heap
+			size_t heapCount = 0;
+			/// Memory allocated by heaps
+			size_t heapBytes = 0;
+			/// Memory that separate heaps of contexts sharing a heap would allocate in addition
+			size_t savedBytes = 0;
+		};
+
+		/**
+		 * Driver context memory statistics
+		 */
+		struct ContextMemoryStats {
+			/// Context drivers
+			std::set<uint32_t> driverIds;
+			/// Number of contexts sharing the context heap
+			size_t heapUsers = 0;
+			/// Memory allocated by heap and not freed yet
+			size_t liveBytes = 0;
+			/// Maximal memory allocated by heap
+			size_t peakBytes = 0;
+			/// Memory taken from process heap by heap allocator
+			size_t reservedBytes = 0;
+			/// Memory limit of driver code, 0 if unlimited
+			size_t limitBytes = 0;
+			/// Number of allocations refused by limit
+			size_t limitHits = 0;
+		};
+
+		/**
+		 * Driver function call profile
+		 */
+		struct FunctionProfile {
+			/// Number of calls
+			uint64_t calls = 0;
+			/// Number of failed calls
+			uint64_t errors = 0;
+			/// Cumulative execution time in nanoseconds
+			uint64_t totalTimeNs = 0;
+			/// Maximal execution time of a call in nanoseconds
+			uint64_t maxTimeNs = 0;
+			/// Cumulative heap growth in bytes, negative if calls released more memory than they allocated
+			int64_t heapGrowthBytes = 0;
+			/// Maximal heap growth of a call in bytes
+			int64_t maxHeapGrowthBytes = 0;
+		};
+
 		/**
 		 * Destructor
 		 */
@@ -39,12 +95,17 @@ namespace iqrf {
 
 		/**
 		 * Creates a new context and loads code, or loads code for existing context
+		 *
+		 * Contexts loaded with identical code hash share a single heap. Loading code with the hash
+		 * the context is already loaded with keeps the context. New context replaces the previous one
+		 * once it is compiled, running calls finish in the previous context.
 		 * @param contextId Context ID
 		 * @param js Code to load
 		 * @param driverIdSet Context drivers
+		 * @param codeHash Hash of code used as key of compiled code cache, empty to always compile code
 		 * @return true if context code was successfully loaded, false otherwise
 		 */
-		virtual bool loadContextCode(int contextId, const std::string &js, const std::set<uint32_t> &driverIdSet) = 0;
+		virtual bool loadContextCode(int contextId, const std::string &js, const std::set<uint32_t> &driverIdSet, const std::string &codeHash = "") = 0;
 
 		/**
 		 * Assigns context ID for device address
@@ -53,6 +114,15 @@ namespace iqrf {
 		 */
 		virtual void mapAddressToContext(int address, int contextId) = 0;
 
+		/**
+		 * Sets hashes of driver code loaded in context, native implementations of functions are used for known drivers
+		 *
+		 * Reloading context code clears the hashes.
+		 * @param contextId Context ID
+		 * @param driverHashes Hashes of all driver code loaded in the context
+		 */
+		virtual void setContextDriverHashes(int contextId, const std::set<std::string> &driverHashes) = 0;
+
 		/**
 		 * Attempts to find suitable context and call function
 		 * @param address Address
@@ -63,6 +133,48 @@ namespace iqrf {
 		 */
 		virtual void callContext(int address, int hwpid, const std::string &fname, const std::string &params, std::string &ret) = 0;
 
+		/**
+		 * Resolves function name to handle
+		 *
+		 * Calls by handle skip function name parsing and lookup in contexts the function was already called in.
+		 * Handles are valid for the lifetime of the service and survive reloading of contexts.
+		 * @param fname Function name
+		 * @return Function handle
+		 */
+		virtual int resolveFunction(const std::string &fname) = 0;
+
+		/**
+		 * Attempts to find suitable context and call function by handle
+		 * @param address Address
+		 * @param hwpid HW profile ID
+		 * @param functionHandle Function handle returned by resolveFunction
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 */
+		virtual void callContext(int address, int hwpid, int functionHandle, const std::string &params, std::string &ret) = 0;
+
+		/**
+		 * Attempts to find suitable context and call function, parameters and result are passed without JSON text
+		 * @param address Address
+		 * @param hwpid HW profile ID
+		 * @param fname Function name
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 * @param allocator Allocator of return value
+		 */
+		virtual void callContext(int address, int hwpid, const std::string &fname, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) = 0;
+
+		/**
+		 * Attempts to find suitable context and call function by handle, parameters and result are passed without JSON text
+		 * @param address Address
+		 * @param hwpid HW profile ID
+		 * @param functionHandle Function handle returned by resolveFunction
+		 * @param params Function call parameters
+		 * @param ret Return value
+		 * @param allocator Allocator of return value
+		 */
+		virtual void callContext(int address, int hwpid, int functionHandle, const rapidjson::Value &params, rapidjson::Value &ret, rapidjson::Document::AllocatorType &allocator) = 0;
+
 		/**
 		 * Returns context driver IDs
 		 * @param contextId Context ID
@@ -77,6 +189,53 @@ namespace iqrf {
 		 */
 		virtual std::shared_ptr<int> getDeviceAddrProductId(int address) const = 0;
 
+		/**
+		 * Returns driver context heap statistics
+		 * @return Heap statistics
+		 */
+		virtual HeapStats getHeapStats() const = 0;
+
+		/**
+		 * Returns memory statistics of driver contexts
+		 *
+		 * Contexts sharing a heap report the same heap figures.
+		 * @return Memory statistics by context ID
+		 */
+		virtual std::map<int, ContextMemoryStats> getContextMemoryStats() const = 0;
+
+		/**
+		 * Enables or disables profiling of driver function calls, collected profile is kept
+		 * @param enabled Profiling enabled
+		 */
+		virtual void setProfiling(bool enabled) = 0;
+
+		/**
+		 * Checks if profiling of driver function calls is enabled
+		 * @return true if profiling is enabled, false otherwise
+		 */
+		virtual bool isProfiling() const = 0;
+
+		/**
+		 * Returns profile of driver function calls
+		 * @return Function profiles by context ID and function name
+		 */
+		virtual std::map<int, std::map<std::string, FunctionProfile>> getProfile() const = 0;
+
+		/**
+		 * Clears profile of driver function calls
+		 */
+		virtual void resetProfile() = 0;
+
+		/**
+		 * Removes contexts not listed and replaces address mapping
+		 *
+		 * Running calls finish in removed contexts. Addresses not listed, e.g. of devices removed from network,
+		 * and addresses mapped to removed contexts are unmapped.
+		 * @param contextIds IDs of contexts to keep
+		 * @param addressContexts Context IDs by device address mapped during reload
+		 */
+		virtual void retainContexts(const std::set<int> &contextIds, const std::map<int, int> &addressContexts) = 0;
+
 		/**
 		 * Clears all driver contexts, device and address mapping
 		 */
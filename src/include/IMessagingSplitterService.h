@@ -21,9 +21,13 @@
 #include "rapidjson/document.h"
 #include "MessagingCommon.h"
 
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <list>
+#include <map>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
 
@@ -47,18 +51,44 @@ namespace iqrf {
 
     class MsgType {
     public:
+      /// ID of message type not interned by splitter
+      static constexpr uint32_t UnknownId = std::numeric_limits<uint32_t>::max();
+
       MsgType(const std::string mtype, int major, int minor, int micro)
-        :m_type(mtype), m_major(major), m_minor(minor), m_micro(micro)
+        :m_type(mtype), m_major(major), m_minor(minor), m_micro(micro), m_typeHash(hash(mtype))
       {}
       MsgType(const std::string mtype, int major, int minor, int micro, const std::string& possibleDriverFunction)
-        :m_type(mtype), m_major(major), m_minor(minor), m_micro(micro), m_possibleDriverFunction(possibleDriverFunction)
+        :m_type(mtype), m_major(major), m_minor(minor), m_micro(micro), m_possibleDriverFunction(possibleDriverFunction), m_typeHash(hash(mtype))
       {}
+
+      /**
+       * Computes hash of message type name (64-bit FNV-1a)
+       *
+       * The function is constexpr, so handlers can switch on m_typeHash with case labels computed at compile time.
+       * @param mType Message type name
+       * @return Message type hash
+       */
+      static constexpr uint64_t hash(std::string_view mType) {
+        uint64_t val = 14695981039346656037ULL;
+        for (char c : mType) {
+          val ^= static_cast<uint8_t>(c);
+          val *= 1099511628211ULL;
+        }
+        return val;
+      }
+
       std::string m_type;
       int m_major = 1;
       int m_minor = 0;
       int m_micro = 0;
       std::string m_possibleDriverFunction;
       FilteredMessageHandlerFunc m_handlerFunc;
+      /// Hash of message type name
+      uint64_t m_typeHash = 0;
+      /// Dense ID of message type name assigned by splitter at schema load
+      uint32_t m_typeId = UnknownId;
+      /// Dense ID of versioned message type assigned by splitter at schema load
+      uint32_t m_id = UnknownId;
 
       std::string getKey() const {
         std::ostringstream os;
@@ -73,6 +103,10 @@ namespace iqrf {
     virtual void unregisterFilteredMsgHandler(const std::vector<std::string>& msgTypeFilters) = 0;
     virtual int getManagementQueueLen() const = 0;
     virtual int getNetworkQueueLen() const = 0;
+    /// Returns number of queued management messages per messaging instance
+    virtual std::map<std::string, size_t> getManagementQueueOccupancy() const = 0;
+    /// Returns number of queued network messages per messaging instance
+    virtual std::map<std::string, size_t> getNetworkQueueOccupancy() const = 0;
 
     virtual ~IMessagingSplitterService() {}
   };
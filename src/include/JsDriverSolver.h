@@ -37,15 +37,11 @@ namespace iqrf {
 
     // request processing
     rapidjson::Document m_requestParamDoc;
-    std::string m_requestParamStr;
     rapidjson::Document m_requestResultDoc;
-    std::string m_requestResultStr;
 
     // response processing
     rapidjson::Document m_responseParamDoc;
-    std::string m_responseParamStr;
     rapidjson::Document m_responseResultDoc;
-    std::string m_responseResultStr;
 
   public:
     virtual std::string functionName() const = 0;
@@ -62,15 +58,24 @@ namespace iqrf {
     void setRequestParamDoc(const rapidjson::Value & requestParamVal) { m_requestParamDoc.CopyFrom(requestParamVal, m_requestParamDoc.GetAllocator()); }
   public:
     const rapidjson::Document & getRequestParamDoc() const { return m_requestParamDoc; }
-    const std::string & getRequestParamStr() const { return m_requestParamStr; }
+    std::string getRequestParamStr() const { return jsonToStr(m_requestParamDoc); }
     const rapidjson::Document & getRequestResultDoc() const { return m_requestResultDoc; }
-    const std::string & getRequestResultStr() const { return m_requestResultStr; }
+    std::string getRequestResultStr() const { return jsonToStr(m_requestResultDoc); }
 
     // response processing
     const rapidjson::Document & getResponseParamDoc() const { return m_responseParamDoc; }
-    const std::string & getResponseParamStr() const { return m_responseParamStr; }
+    std::string getResponseParamStr() const { return jsonToStr(m_responseParamDoc); }
     const rapidjson::Document & getResponseResultDoc() const { return m_responseResultDoc; }
-    const std::string & getResponseResultStr() const { return m_responseResultStr; }
+    std::string getResponseResultStr() const { return jsonToStr(m_responseResultDoc); }
+
+    // JSON text of driver function parameters or result, drivers are called with values directly
+    static std::string jsonToStr(const rapidjson::Value & val)
+    {
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+      val.Accept(writer);
+      return buffer.GetString();
+    }
 
     JsDriverSolver() = delete;
     JsDriverSolver(IJsRenderService* iJsRenderService)
@@ -81,23 +86,16 @@ namespace iqrf {
     {
       TRC_FUNCTION_ENTER("");
 
-      using namespace rapidjson;
-
       std::string functionNameReq(functionName());
       functionNameReq += "_Request_req";
       TRC_DEBUG(PAR(functionNameReq));
 
       preRequest(m_requestParamDoc);
 
-      StringBuffer buffer;
-      Writer<rapidjson::StringBuffer> writer(buffer);
-      m_requestParamDoc.Accept(writer);
-      m_requestParamStr = buffer.GetString();
-
-      TRC_DEBUG(PAR(m_requestParamStr));
+      TRC_DEBUG(NAME_PAR(requestParam, jsonToStr(m_requestParamDoc)));
 
       try {
-        m_iJsRenderService->callContext(getNadrDrv(), getHwpidDrv(), functionNameReq, m_requestParamStr, m_requestResultStr);
+        m_iJsRenderService->callContext(getNadrDrv(), getHwpidDrv(), functionNameReq, m_requestParamDoc, m_requestResultDoc, m_requestResultDoc.GetAllocator());
       }
       catch (std::exception &e) {
         //TODO use dedicated exception to distinguish driver error (BAD_REQUEST)
@@ -105,9 +103,7 @@ namespace iqrf {
         THROW_EXC_TRC_WAR(std::logic_error, "Driver request failure: " << e.what());
       }
 
-      TRC_DEBUG(PAR(m_requestResultStr));
-
-      m_requestResultDoc.Parse(m_requestResultStr);
+      TRC_DEBUG(NAME_PAR(requestResult, jsonToStr(m_requestResultDoc)));
 
       postRequest(m_requestResultDoc);
 
@@ -118,24 +114,16 @@ namespace iqrf {
     {
       TRC_FUNCTION_ENTER("");
 
-      using namespace rapidjson;
-
       std::string functionNameRsp(functionName());
       functionNameRsp += "_Response_rsp";
       TRC_DEBUG(PAR(functionNameRsp));
 
       preResponse(m_responseParamDoc);
 
-      StringBuffer buffer;
-      Writer<rapidjson::StringBuffer> writer(buffer);
-      m_responseParamDoc.Accept(writer);
-      m_responseParamStr = buffer.GetString();
-
-      TRC_DEBUG(PAR(m_responseParamStr));
+      TRC_DEBUG(NAME_PAR(responseParam, jsonToStr(m_responseParamDoc)));
 
       try {
-        m_iJsRenderService->callContext(getNadrDrv(), getHwpidDrv(), functionNameRsp, m_responseParamStr, m_responseResultStr);
-
+        m_iJsRenderService->callContext(getNadrDrv(), getHwpidDrv(), functionNameRsp, m_responseParamDoc, m_responseResultDoc, m_responseResultDoc.GetAllocator());
       }
       catch (std::exception &e) {
         //TODO use dedicated exception to distinguish driver error (BAD_RESPONSE)
@@ -143,9 +131,7 @@ namespace iqrf {
         THROW_EXC_TRC_WAR(std::logic_error, "Driver response failure: " << e.what());
       }
 
-      TRC_DEBUG(PAR(m_responseResultStr));
-
-      m_responseResultDoc.Parse(m_responseResultStr);
+      TRC_DEBUG(NAME_PAR(responseResult, jsonToStr(m_responseResultDoc)));
 
       postResponse(m_responseResultDoc);
 
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+
+/// \class TokenBucket
+/// \brief Token bucket rate limiter
+/// \details
+/// Bucket holds up to burst tokens and is refilled continuously by rate tokens per second.
+/// Each admitted event consumes one token. Rate of zero disables limiting.
+/// The class is not thread safe.
+class TokenBucket {
+public:
+  /// Clock type
+  typedef std::chrono::steady_clock Clock;
+
+  /// \brief constructor
+  /// \param [in] rate refill rate in tokens per second, 0 disables limiting
+  /// \param [in] burst bucket capacity, at least 1
+  /// \param [in] now creation time
+  TokenBucket(double rate = 0, double burst = 1, Clock::time_point now = Clock::now())
+    : m_rate(rate), m_burst(std::max(burst, 1.0)), m_tokens(m_burst), m_updated(now)
+  {}
+
+  /// \brief Try to consume token
+  /// \param [in] now current time
+  /// \return true if token was consumed and event is admitted, false if event exceeds rate
+  bool tryConsume(Clock::time_point now = Clock::now()) {
+    if (m_rate <= 0) {
+      return true;
+    }
+    refill(now);
+    if (m_tokens < 1) {
+      return false;
+    }
+    m_tokens -= 1;
+    return true;
+  }
+
+  /// \brief Get available tokens
+  /// \param [in] now current time
+  /// \return number of tokens available
+  double getTokens(Clock::time_point now = Clock::now()) {
+    refill(now);
+    return m_tokens;
+  }
+
+  /// \brief Get refill rate
+  /// \return refill rate in tokens per second
+  double getRate() const {
+    return m_rate;
+  }
+
+  /// \brief Get bucket capacity
+  /// \return bucket capacity
+  double getBurst() const {
+    return m_burst;
+  }
+
+private:
+  /// \brief Add tokens accumulated since last update
+  /// \param [in] now current time
+  void refill(Clock::time_point now) {
+    if (now <= m_updated) {
+      return;
+    }
+    double elapsed = std::chrono::duration<double>(now - m_updated).count();
+    m_tokens = std::min(m_burst, m_tokens + elapsed * m_rate);
+    m_updated = now;
+  }
+
+  /// Refill rate
+  double m_rate;
+  /// Bucket capacity
+  double m_burst;
+  /// Available tokens
+  double m_tokens;
+  /// Last refill time
+  Clock::time_point m_updated;
+};
@@ -0,0 +1,113 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <zip.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace iqrf {
+
+	class ZipUtils {
+	public:
+		/**
+		 * Extracts all files of zip archive, entries are streamed to files through single buffer
+		 * @param archivePath Zip archive path
+		 * @param targetDir Directory to extract to
+		 * @return size_t Number of extracted files
+		 */
+		static size_t extractArchive(const std::string &archivePath, const std::string &targetDir) {
+			int err = 0;
+			std::unique_ptr<zip_t, ArchiveCloser> archive(zip_open(archivePath.c_str(), ZIP_RDONLY, &err));
+			if (!archive) {
+				zip_error_t error;
+				zip_error_init_with_code(&error, err);
+				const std::string errorMessage = zip_error_strerror(&error);
+				zip_error_fini(&error);
+				throw std::runtime_error("Cannot open zip archive " + archivePath + ": " + errorMessage);
+			}
+
+			const std::filesystem::path root(targetDir);
+			std::vector<char> buf(BUF_SIZE);
+			size_t extracted = 0;
+			zip_int64_t numEntries = zip_get_num_entries(archive.get(), 0);
+			for (zip_uint64_t i = 0; i < static_cast<zip_uint64_t>(numEntries); ++i) {
+				const char *entryName = zip_get_name(archive.get(), i, 0);
+				if (entryName == nullptr) {
+					throw std::runtime_error("Cannot read name of file in zip: " + std::to_string(i));
+				}
+				std::string name(entryName);
+				// entries are extracted only under target directory
+				auto relative = std::filesystem::path(name).lexically_normal();
+				if (relative.is_absolute() || relative.empty() || *relative.begin() == "..") {
+					throw std::runtime_error("Invalid file path in zip: " + name);
+				}
+				auto path = root / relative;
+				if (name.back() == '/') {
+					std::filesystem::create_directories(path);
+					continue;
+				}
+				std::filesystem::create_directories(path.parent_path());
+
+				std::unique_ptr<zip_file_t, FileCloser> file(zip_fopen_index(archive.get(), i, 0));
+				if (!file) {
+					throw std::runtime_error("Cannot open file in zip: " + name);
+				}
+				std::ofstream out(path, std::ios::binary | std::ios::trunc);
+				if (!out.is_open()) {
+					throw std::runtime_error("Cannot create file extracted from zip: " + path.string());
+				}
+				zip_int64_t len = 0;
+				while ((len = zip_fread(file.get(), buf.data(), buf.size())) > 0) {
+					out.write(buf.data(), len);
+				}
+				if (len < 0) {
+					throw std::runtime_error("Cannot read file in zip: " + name);
+				}
+				if (!out) {
+					throw std::runtime_error("Cannot write file extracted from zip: " + path.string());
+				}
+				++extracted;
+			}
+			return extracted;
+		}
+
+	private:
+		/// Closes zip archive
+		struct ArchiveCloser {
+			void operator()(zip_t *archive) const {
+				zip_discard(archive);
+			}
+		};
+
+		/// Closes file in zip archive
+		struct FileCloser {
+			void operator()(zip_file_t *file) const {
+				zip_fclose(file);
+			}
+		};
+
+		/// Extraction buffer size
+		static constexpr size_t BUF_SIZE = 256 * 1024;
+	};
+
+} // iqrf namespace
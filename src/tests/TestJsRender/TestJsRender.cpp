@@ -32,6 +32,9 @@
 #include <thread>
 #include <condition_variable>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
 
 #include "iqrf__TestJsRender.hxx"
 
@@ -214,4 +217,173 @@ namespace iqrf {
     ASSERT_EQ(expect, output);
   }
 
+  TEST_F(JsRenderTesting, callFunctionByHandle)
+  {
+    int handle = Imp::get().m_iJsRenderService->resolveFunction("test.convertUpperCase");
+    EXPECT_EQ(handle, Imp::get().m_iJsRenderService->resolveFunction("test.convertUpperCase"));
+    // first call resolves function in context, following calls use stored function
+    for (int i = 0; i < 3; ++i) {
+      std::string output;
+      Imp::get().m_iJsRenderService->callContext(0xFFFFFF, 0xFFFF, handle, "\"qwerty\"", output);
+      EXPECT_EQ("{\"out\":\"QWERTY\"}", output);
+    }
+    int missing = Imp::get().m_iJsRenderService->resolveFunction("test.convertLowerCase");
+    EXPECT_NE(handle, missing);
+    std::string output;
+    EXPECT_THROW(Imp::get().m_iJsRenderService->callContext(0xFFFFFF, 0xFFFF, missing, "\"QWERTY\"", output), std::logic_error);
+    EXPECT_THROW(Imp::get().m_iJsRenderService->callContext(0xFFFFFF, 0xFFFF, -1, "\"qwerty\"", output), std::logic_error);
+    EXPECT_THROW(Imp::get().m_iJsRenderService->resolveFunction("convertUpperCase"), std::logic_error);
+  }
+
+  TEST_F(JsRenderTesting, callFunctionValue)
+  {
+    rapidjson::Document params;
+    params.SetString("qwerty");
+    rapidjson::Document output;
+    Imp::get().m_iJsRenderService->callContext(0xFFFFFF, 0xFFFF, "test.convertUpperCase", params, output, output.GetAllocator());
+    ASSERT_TRUE(output.IsObject());
+    ASSERT_TRUE(output.HasMember("out") && output["out"].IsString());
+    EXPECT_EQ(std::string("QWERTY"), output["out"].GetString());
+    params.SetInt(1);
+    EXPECT_THROW(Imp::get().m_iJsRenderService->callContext(0xFFFFFF, 0xFFFF, "test.convertUpperCase", params, output, output.GetAllocator()), std::logic_error);
+  }
+
+  TEST_F(JsRenderTesting, loadContextCodeBytecodeCache)
+  {
+    std::ifstream jsFile("./TestJavaScript/test.js");
+    ASSERT_TRUE(jsFile.is_open());
+    std::ostringstream strStream;
+    strStream << jsFile.rdbuf();
+    std::string jsString = strStream.str();
+    std::string expect = "{\"out\":\"QWERTY\"}";
+    // first load compiles and caches bytecode, second load with identical code shares its heap
+    auto statsBefore = Imp::get().m_iJsRenderService->getHeapStats();
+    for (int contextId : { 0xFFFFFE, 0xFFFFFD }) {
+      ASSERT_TRUE(Imp::get().m_iJsRenderService->loadContextCode(contextId, jsString, { 1 }, "0123456789abcdef"));
+      Imp::get().m_iJsRenderService->mapAddressToContext(contextId, contextId);
+      std::string output;
+      Imp::get().m_iJsRenderService->callContext(contextId, 0xFFFF, "test.convertUpperCase", "\"qwerty\"", output);
+      EXPECT_EQ(expect, output);
+    }
+    auto statsAfter = Imp::get().m_iJsRenderService->getHeapStats();
+    EXPECT_EQ(statsBefore.contextCount + 2, statsAfter.contextCount);
+    EXPECT_EQ(statsBefore.heapCount + 1, statsAfter.heapCount);
+    EXPECT_LT(statsBefore.savedBytes, statsAfter.savedBytes);
+  }
+
+  TEST_F(JsRenderTesting, reloadContextCode)
+  {
+    std::ifstream jsFile("./TestJavaScript/test.js");
+    ASSERT_TRUE(jsFile.is_open());
+    std::ostringstream strStream;
+    strStream << jsFile.rdbuf();
+    std::string jsString = strStream.str();
+    const int contextId = 0xFFFFFC;
+    const std::string hash = "00112233445566778899aabbccddeeff";
+    ASSERT_TRUE(Imp::get().m_iJsRenderService->loadContextCode(contextId, jsString, { 1 }, hash));
+    Imp::get().m_iJsRenderService->mapAddressToContext(contextId, contextId);
+    auto heapsBefore = Imp::get().m_iJsRenderService->getHeapStats().heapCount;
+    // unchanged code keeps the loaded context, driver set is updated
+    ASSERT_TRUE(Imp::get().m_iJsRenderService->loadContextCode(contextId, jsString, { 1, 2 }, hash));
+    EXPECT_EQ(heapsBefore, Imp::get().m_iJsRenderService->getHeapStats().heapCount);
+    EXPECT_EQ(std::set<uint32_t>({ 1, 2 }), Imp::get().m_iJsRenderService->getDriverIdSet(contextId));
+    std::string output;
+    Imp::get().m_iJsRenderService->callContext(contextId, 0xFFFF, "test.convertUpperCase", "\"qwerty\"", output);
+    EXPECT_EQ("{\"out\":\"QWERTY\"}", output);
+
+    // contexts not retained are removed with their address mapping, other contexts stay
+    const int removedAddress = 0x7FFFFF;
+    Imp::get().m_iJsRenderService->mapAddressToContext(removedAddress, 0xFFFFFF);
+    std::set<int> retained;
+    std::map<int, int> addressContexts;
+    for (const auto &[id, stats] : Imp::get().m_iJsRenderService->getContextMemoryStats()) {
+      (void)stats;
+      retained.insert(id);
+      addressContexts.insert(std::make_pair(id, id));
+    }
+    retained.erase(contextId);
+    Imp::get().m_iJsRenderService->retainContexts(retained, addressContexts);
+    EXPECT_EQ(0u, Imp::get().m_iJsRenderService->getContextMemoryStats().count(contextId));
+    EXPECT_EQ(nullptr, Imp::get().m_iJsRenderService->getDeviceAddrProductId(contextId));
+    // address not mapped during reload is removed from mapping
+    EXPECT_EQ(nullptr, Imp::get().m_iJsRenderService->getDeviceAddrProductId(removedAddress));
+    EXPECT_NE(nullptr, Imp::get().m_iJsRenderService->getDeviceAddrProductId(0xFFFFFF));
+    EXPECT_TRUE(Imp::get().m_iJsRenderService->getDriverIdSet(contextId).empty());
+    Imp::get().m_iJsRenderService->callContext(0xFFFFFF, 0xFFFF, "test.convertUpperCase", "\"qwerty\"", output);
+    EXPECT_EQ("{\"out\":\"QWERTY\"}", output);
+  }
+
+  TEST_F(JsRenderTesting, profileFunctionCalls)
+  {
+    auto service = Imp::get().m_iJsRenderService;
+    service->resetProfile();
+    std::string output;
+    service->callContext(0xFFFFFF, 0xFFFF, "test.convertUpperCase", "\"qwerty\"", output);
+    EXPECT_TRUE(service->getProfile().empty());
+
+    service->setProfiling(true);
+    for (int i = 0; i < 3; ++i) {
+      service->callContext(0xFFFFFF, 0xFFFF, "test.convertUpperCase", "\"qwerty\"", output);
+    }
+    EXPECT_THROW(service->callContext(0xFFFFFF, 0xFFFF, "test.convertUpperCase", "1", output), std::logic_error);
+    service->setProfiling(false);
+
+    auto profile = service->getProfile();
+    ASSERT_EQ(1u, profile[0xFFFFFF].count("test.convertUpperCase"));
+    const auto &function = profile[0xFFFFFF]["test.convertUpperCase"];
+    EXPECT_EQ(4u, function.calls);
+    EXPECT_EQ(1u, function.errors);
+    EXPECT_LT(0u, function.maxTimeNs);
+    EXPECT_LE(function.maxTimeNs, function.totalTimeNs);
+    service->resetProfile();
+    EXPECT_TRUE(service->getProfile().empty());
+  }
+
+  TEST_F(JsRenderTesting, concurrentCallContextThroughput)
+  {
+    const int contextCount = 4;
+    const int callsPerThread = 2000;
+    const int baseId = 0x100000;
+    std::ifstream jsFile("./TestJavaScript/test.js");
+    ASSERT_TRUE(jsFile.is_open());
+    std::ostringstream strStream;
+    strStream << jsFile.rdbuf();
+    std::string jsString = strStream.str();
+    for (int i = 0; i < contextCount; i++) {
+      ASSERT_TRUE(Imp::get().m_iJsRenderService->loadContextCode(baseId + i, jsString, { 1 }));
+      Imp::get().m_iJsRenderService->mapAddressToContext(baseId + i, baseId + i);
+    }
+
+    // every thread calls its own context, threads do not share a Duktape heap
+    auto run = [&](int threadCount) {
+      std::atomic<int> failures(0);
+      std::vector<std::thread> threads;
+      auto start = std::chrono::steady_clock::now();
+      for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t]() {
+          std::string output;
+          for (int i = 0; i < callsPerThread; i++) {
+            Imp::get().m_iJsRenderService->callContext(baseId + t, 0xFFFF, "test.convertUpperCase", "\"qwerty\"", output);
+            if (output != "{\"out\":\"QWERTY\"}") {
+              ++failures;
+            }
+          }
+        });
+      }
+      for (auto &thread : threads) {
+        thread.join();
+      }
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      double throughput = threadCount * callsPerThread / elapsed.count();
+      RecordProperty("callsPerSecond" + std::to_string(threadCount) + "Threads", std::to_string(static_cast<long>(throughput)));
+      EXPECT_EQ(0, failures);
+      return throughput;
+    };
+
+    double single = run(1);
+    double concurrent = run(contextCount);
+    RecordProperty("concurrentSpeedup", std::to_string(concurrent / single));
+    RecordProperty("hardwareThreads", static_cast<int>(std::thread::hardware_concurrency()));
+  }
+
 }
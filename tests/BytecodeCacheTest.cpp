@@ -0,0 +1,84 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BytecodeCache.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace iqrf {
+
+  class BytecodeCacheTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      m_dir = (fs::temp_directory_path() / ("BytecodeCacheTest-" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()))).string();
+      m_cache.setDirectory(m_dir);
+    }
+
+    void TearDown() override {
+      fs::remove_all(m_dir);
+    }
+
+    void put(const std::string &hash) {
+      m_cache.put(hash, std::vector<char>{'b', 'c'});
+    }
+
+    bool hasFile(const std::string &hash) const {
+      return fs::exists(fs::path(m_dir) / (hash + ".dukbc"));
+    }
+
+    std::string m_dir;
+    BytecodeCache m_cache;
+  };
+
+  TEST_F(BytecodeCacheTest, persist) {
+    put("0a1b");
+    EXPECT_TRUE(hasFile("0a1b"));
+    m_cache.clear();
+    auto bytecode = m_cache.get("0a1b");
+    ASSERT_NE(nullptr, bytecode);
+    EXPECT_EQ((std::vector<char>{'b', 'c'}), *bytecode);
+    EXPECT_EQ(nullptr, m_cache.get("not-a-hash"));
+  }
+
+  TEST_F(BytecodeCacheTest, retain) {
+    put("0a1b");
+    put("2c3d");
+    put("4e5f");
+    fs::path other = fs::path(m_dir) / "notes.txt";
+    fs::copy_file(fs::path(m_dir) / "0a1b.dukbc", other);
+
+    m_cache.retain({"0a1b", "4e5f"});
+    EXPECT_TRUE(hasFile("0a1b"));
+    EXPECT_FALSE(hasFile("2c3d"));
+    EXPECT_TRUE(hasFile("4e5f"));
+    // files other than bytecode are left alone
+    EXPECT_TRUE(fs::exists(other));
+    EXPECT_EQ(nullptr, m_cache.get("2c3d"));
+    EXPECT_NE(nullptr, m_cache.get("4e5f"));
+
+    m_cache.retain({});
+    EXPECT_FALSE(hasFile("0a1b"));
+    EXPECT_FALSE(hasFile("4e5f"));
+  }
+
+}
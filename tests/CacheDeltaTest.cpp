@@ -0,0 +1,127 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CacheDelta.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace fs = std::filesystem;
+
+namespace iqrf {
+
+  class CacheDeltaTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      m_root = fs::temp_directory_path() / ("CacheDeltaTest-" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+      fs::remove_all(m_root);
+      m_downloaded = (m_root / "downloaded").string();
+      m_installed = (m_root / "installed").string();
+      for (const auto &dir : {m_downloaded, m_installed}) {
+        write(dir, "server/data.json", "{\"databaseChecksum\": 1}");
+        write(dir, "companies/data.json", "[]");
+        write(dir, "products/data.json", "[]");
+        write(dir, "standards/data.json", "[]");
+        write(dir, "standards/75/data.json", "{\"versions\": [1]}");
+        write(dir, "standards/75/1.00/data.json", "driver");
+        write(dir, "packages/id/10/data.json", "{}");
+        write(dir, "packages/id/11/data.json", "{}");
+      }
+    }
+
+    void TearDown() override {
+      fs::remove_all(m_root);
+    }
+
+    static void write(const std::string &root, const std::string &path, const std::string &content) {
+      fs::path filePath = fs::path(root) / path;
+      fs::create_directories(filePath.parent_path());
+      std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+      file << content;
+    }
+
+    fs::path m_root;
+    std::string m_downloaded;
+    std::string m_installed;
+  };
+
+  TEST_F(CacheDeltaTest, unchanged) {
+    auto delta = CacheDelta::compare(m_downloaded, m_installed);
+    EXPECT_FALSE(delta.isFull());
+    EXPECT_TRUE(delta.empty());
+    EXPECT_FALSE(delta.hasEntity("companies"));
+    EXPECT_FALSE(delta.hasStandard(75));
+    EXPECT_FALSE(delta.hasPackage(10));
+  }
+
+  TEST_F(CacheDeltaTest, changedEntities) {
+    write(m_downloaded, "server/data.json", "{\"databaseChecksum\": 2}");
+    // same size, different content
+    write(m_downloaded, "companies/data.json", "{}");
+    write(m_downloaded, "standards/75/1.00/data.json", "driveR");
+    write(m_downloaded, "packages/id/11/data.json", "{\"packageID\": 11}");
+    write(m_downloaded, "packages/id/12/data.json", "{}");
+    fs::remove_all(fs::path(m_downloaded) / "packages/id/10");
+
+    auto delta = CacheDelta::compare(m_downloaded, m_installed);
+    EXPECT_FALSE(delta.isFull());
+    EXPECT_TRUE(delta.hasEntity("server"));
+    EXPECT_TRUE(delta.hasEntity("companies"));
+    EXPECT_FALSE(delta.hasEntity("products"));
+    // standard version changed, standard list did not
+    EXPECT_FALSE(delta.hasEntity("standards"));
+    EXPECT_TRUE(delta.hasStandard(75));
+    EXPECT_EQ((std::set<unsigned int>{10, 11, 12}), delta.getPackages());
+    EXPECT_EQ((std::set<std::string>{"packages/id/10/data.json"}), delta.getRemovedFiles());
+    EXPECT_EQ(5u, delta.getChangedFiles().size());
+    EXPECT_EQ(1u, delta.getChangedFiles().count("standards/75/1.00/data.json"));
+  }
+
+  TEST_F(CacheDeltaTest, fullDelta) {
+    fs::remove_all(m_installed);
+    auto delta = CacheDelta::compare(m_downloaded, m_installed);
+    EXPECT_TRUE(delta.isFull());
+    EXPECT_EQ(8u, delta.getChangedFiles().size());
+    EXPECT_TRUE(delta.getRemovedFiles().empty());
+    // full delta reports every entity as changed
+    EXPECT_TRUE(delta.hasEntity("quantities"));
+    EXPECT_TRUE(delta.hasPackage(99));
+
+    // forced full delta replaces identical files too
+    auto forced = CacheDelta::compare(m_downloaded, m_downloaded, true);
+    EXPECT_TRUE(forced.isFull());
+    EXPECT_EQ(8u, forced.getChangedFiles().size());
+  }
+
+  TEST_F(CacheDeltaTest, classification) {
+    CacheDelta delta;
+    delta.addFile("standards/data.json");
+    delta.addFile("standards/16/data.json");
+    delta.addFile("packages/id/5/data.json", true);
+    delta.addFile("packages/id/x/data.json");
+    EXPECT_TRUE(delta.hasEntity("standards"));
+    EXPECT_EQ((std::set<int>{16}), delta.getStandards());
+    EXPECT_EQ((std::set<unsigned int>{5}), delta.getPackages());
+    // directory name which is not an ID marks the whole entity
+    EXPECT_TRUE(delta.hasEntity("packages"));
+    EXPECT_EQ(1u, delta.getRemovedFiles().size());
+  }
+
+}
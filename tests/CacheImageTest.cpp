@@ -0,0 +1,161 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CacheImage.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+namespace iqrf {
+
+  class CacheImageTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      m_fileName = (fs::temp_directory_path() / ("CacheImageTest-" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + ".img")).string();
+    }
+
+    void TearDown() override {
+      fs::remove(m_fileName);
+    }
+
+    void writeImage() {
+      CacheImageWriter writer;
+      writer.beginTable(1, 5);
+      writer.addUint(10);
+      writer.addString("driver");
+      writer.addString("");
+      writer.addUint(11);
+      writer.addString("driver");
+      writer.addString("notes");
+      writer.beginTable(2, 2);
+      writer.addInt(-5);
+      writer.addDouble(1.25);
+      writer.write(m_fileName, 3);
+    }
+
+    std::string m_fileName;
+  };
+
+  TEST_F(CacheImageTest, roundTrip) {
+    writeImage();
+    CacheImageReader reader(m_fileName, 3);
+    auto table = reader.getTable(1, 5);
+    ASSERT_EQ(2u, table.size());
+    EXPECT_EQ(10u, table.getUint(0, 0));
+    EXPECT_EQ("driver", table.getString(0, 1));
+    EXPECT_EQ("", table.getString(0, 3));
+    EXPECT_EQ(11u, table.getUint(1, 0));
+    EXPECT_EQ("notes", table.getString(1, 3));
+    // identical strings are stored once
+    EXPECT_EQ(table.getString(0, 1).data(), table.getString(1, 1).data());
+
+    auto numbers = reader.getTable(2, 2);
+    ASSERT_EQ(1u, numbers.size());
+    EXPECT_EQ(-5, numbers.getInt(0, 0));
+    EXPECT_DOUBLE_EQ(1.25, numbers.getDouble(0, 1));
+    EXPECT_THROW(numbers.getUint(1, 0), std::out_of_range);
+    EXPECT_THROW(numbers.getUint(0, 2), std::out_of_range);
+  }
+
+  TEST_F(CacheImageTest, invalidImage) {
+    writeImage();
+    EXPECT_THROW(CacheImageReader(m_fileName, 4), std::runtime_error);
+    {
+      CacheImageReader reader(m_fileName, 3);
+      EXPECT_THROW(reader.getTable(3, 1), std::runtime_error);
+      EXPECT_THROW(reader.getTable(1, 4), std::runtime_error);
+    }
+
+    // damaged content is detected by checksum
+    auto size = fs::file_size(m_fileName);
+    {
+      std::fstream file(m_fileName, std::ios::binary | std::ios::in | std::ios::out);
+      file.seekp(static_cast<std::streamoff>(size) - 2);
+      file.put('X');
+    }
+    EXPECT_THROW(CacheImageReader(m_fileName, 3), std::runtime_error);
+
+    fs::resize_file(m_fileName, size / 2);
+    EXPECT_THROW(CacheImageReader(m_fileName, 3), std::runtime_error);
+    fs::remove(m_fileName);
+    EXPECT_THROW(CacheImageReader(m_fileName, 3), std::runtime_error);
+  }
+
+  TEST_F(CacheImageTest, incompleteRow) {
+    CacheImageWriter writer;
+    EXPECT_THROW(writer.addUint(1), std::logic_error);
+    writer.beginTable(1, 2);
+    EXPECT_THROW(writer.beginTable(1, 2), std::logic_error);
+    writer.addUint(1);
+    EXPECT_THROW(writer.write(m_fileName, 1), std::logic_error);
+    EXPECT_FALSE(fs::exists(m_fileName));
+  }
+
+  TEST_F(CacheImageTest, loadPackages) {
+    std::string dir = std::string(std::getenv("TESTS_DATA_DIR")) + "../src/tests/TestJsCache/iqrfRepoCache0/packages";
+    std::vector<std::string> files;
+    for (const auto &entry : fs::directory_iterator(dir)) {
+      if (entry.is_directory()) {
+        files.emplace_back((entry.path() / "data.json").string());
+      }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::pair<unsigned int, std::string>> parsed;
+    for (const auto &fileName : files) {
+      std::ifstream file(fileName);
+      json doc = json::parse(file);
+      parsed.emplace_back(doc["packageID"], doc["driver"]);
+    }
+    auto parseTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    CacheImageWriter writer;
+    writer.beginTable(1, 3);
+    for (const auto &[id, driver] : parsed) {
+      writer.addUint(id);
+      writer.addString(driver);
+    }
+    writer.write(m_fileName, 1);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<std::pair<unsigned int, std::string>> loaded;
+    {
+      CacheImageReader reader(m_fileName, 1);
+      auto table = reader.getTable(1, 3);
+      for (size_t i = 0; i < table.size(); ++i) {
+        loaded.emplace_back(static_cast<unsigned int>(table.getUint(i, 0)), std::string(table.getString(i, 1)));
+      }
+    }
+    auto imageTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_EQ(parsed, loaded);
+    RecordProperty("packageFiles", static_cast<int>(files.size()));
+    RecordProperty("parseTimeUs", std::to_string(parseTime));
+    RecordProperty("imageTimeUs", std::to_string(imageTime));
+  }
+
+}
@@ -0,0 +1,175 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Context.h"
+
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using json = nlohmann::json;
+
+namespace iqrf {
+
+  /**
+   * Tests of driver function calls passing parameters and results as values
+   *
+   * Values have to match results of calls passing JSON text.
+   */
+  class ContextTest : public ::testing::Test {
+  protected:
+    static std::string readFile(const std::string &path) {
+      std::ifstream file(path);
+      EXPECT_TRUE(file.is_open()) << path;
+      std::stringstream ss;
+      ss << file.rdbuf();
+      return ss.str();
+    }
+
+    static std::string dataDir() {
+      return std::string(std::getenv("TESTS_DATA_DIR")) + "../src/";
+    }
+
+    static std::string readDriver(const std::string &standard, const std::string &version) {
+      auto doc = json::parse(readFile(dataDir() + "tests/TestJsCache/iqrfRepoCache0/standards/" + standard + "/" + version + "/data.json"));
+      return doc["driver"].get<std::string>();
+    }
+
+    static std::string toStr(const rapidjson::Value &val) {
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+      val.Accept(writer);
+      return buffer.GetString();
+    }
+
+    /**
+     * Calls function with JSON text and with values, both results are expected to be equal
+     */
+    void expectParity(int handle, const std::string &fname, const std::string &params) {
+      std::string textRet;
+      m_context.callFunction(handle, fname, params, textRet);
+      rapidjson::Document paramsDoc;
+      paramsDoc.Parse(params);
+      rapidjson::Document ret;
+      m_context.callFunction(handle, fname, paramsDoc, ret, ret.GetAllocator());
+      EXPECT_EQ(json::parse(textRet), json::parse(toStr(ret))) << params;
+    }
+
+    Context m_context;
+  };
+
+  TEST_F(ContextTest, valueConversion) {
+    m_context.loadCode(
+      "var t = {};"
+      "t.echo = function (p) { return p; };"
+      "t.special = function (p) {"
+      "  return { int: 1, neg: -7, zero: -0, frac: 1.5, big: 1e300, nan: NaN, inf: -Infinity, undef: undefined,"
+      "    fn: function () {}, arr: [undefined, Infinity, 'x', { n: null }], date: new Date(0), str: 'a\\u017e\"', param: p };"
+      "};"
+      "t.undef = function () { return undefined; };"
+    );
+    expectParity(0, "t.echo", "{\"a\":[1,2.5,\"s\",null,true,{\"k\":false}],\"b\":-3,\"c\":\"\\u017e\"}");
+    expectParity(0, "t.echo", "[]");
+    expectParity(0, "t.echo", "\"text\"");
+    expectParity(1, "t.special", "{\"x\":1}");
+
+    rapidjson::Document params;
+    params.Parse("{}");
+    rapidjson::Document ret;
+    m_context.callFunction(1, "t.special", params, ret, ret.GetAllocator());
+    // integral numbers are stored as integers, the same as parsed JSON text
+    EXPECT_TRUE(ret["int"].IsInt());
+    EXPECT_TRUE(ret["zero"].IsInt());
+    EXPECT_TRUE(ret["frac"].IsDouble());
+    EXPECT_TRUE(ret["nan"].IsNull());
+    EXPECT_FALSE(ret.HasMember("undef"));
+    EXPECT_FALSE(ret.HasMember("fn"));
+    EXPECT_EQ("1970-01-01T00:00:00.000Z", std::string(ret["date"].GetString()));
+
+    m_context.callFunction(2, "t.undef", params, ret, ret.GetAllocator());
+    EXPECT_TRUE(ret.IsNull());
+  }
+
+  TEST_F(ContextTest, errorKeepsContextUsable) {
+    m_context.loadCode(
+      "var t = {};"
+      "t.fail = function (p) { throw new Error('failed ' + p.x); };"
+      "t.echo = function (p) { return p; };"
+    );
+    rapidjson::Document params;
+    params.Parse("{\"x\":1}");
+    rapidjson::Document ret;
+    try {
+      m_context.callFunction(0, "t.fail", params, ret, ret.GetAllocator());
+      ADD_FAILURE() << "Expected exception";
+    } catch (const std::logic_error &e) {
+      EXPECT_EQ("Error: failed 1", std::string(e.what()));
+    }
+    EXPECT_THROW(m_context.callFunction(1, "t.missing", params, ret, ret.GetAllocator()), std::logic_error);
+    EXPECT_THROW(m_context.callFunction(2, "missing.echo", params, ret, ret.GetAllocator()), PeripheralException);
+    // stack is left intact, following calls find functions
+    for (int i = 0; i < 3; ++i) {
+      m_context.callFunction(3, "t.echo", params, ret, ret.GetAllocator());
+      EXPECT_EQ("{\"x\":1}", toStr(ret));
+    }
+  }
+
+  TEST_F(ContextTest, resultConversionError) {
+    m_context.loadCode(
+      "var t = {};"
+      "t.getter = function () { return { a: 1, get b() { throw new Error('getter'); } }; };"
+      "t.toJson = function () { return [1, { toJSON: function () { throw new Error('toJSON'); } }]; };"
+      "t.proxy = function () { return new Proxy({}, { ownKeys: function () { throw new Error('ownKeys'); } }); };"
+      "t.echo = function (p) { return p; };"
+    );
+    rapidjson::Document params;
+    params.Parse("{\"x\":1}");
+    rapidjson::Document ret;
+    int handle = 0;
+    // errors of driver code run while result is converted are reported as call errors
+    for (const char *fname : {"t.getter", "t.toJson", "t.proxy"}) {
+      try {
+        m_context.callFunction(handle++, fname, params, ret, ret.GetAllocator());
+        ADD_FAILURE() << "Expected exception " << fname;
+      } catch (const std::logic_error &e) {
+        EXPECT_NE(std::string::npos, std::string(e.what()).find("Error: ")) << e.what();
+      }
+    }
+    m_context.callFunction(handle, "t.echo", params, ret, ret.GetAllocator());
+    EXPECT_EQ("{\"x\":1}", toStr(ret));
+  }
+
+  TEST_F(ContextTest, driverParity) {
+    std::ostringstream code;
+    code << readDriver("-1", "0") << std::endl << readDriver("13", "0") << std::endl << readDriver("94", "15") << std::endl
+      << readFile(dataDir() + "start-IqrfDaemon/javaScript/DaemonWrapper.js") << std::endl;
+    m_context.loadCode(code.str());
+    std::string response = "{\"nadr\":\"01\",\"pnum\":\"5e\",\"hwpid\":\"ffff\",\"rcode\":\"00\",\"dpaval\":\"4a\",";
+    expectParity(0, "iqrf.sensor.Enumerate_Response_rsp", response + "\"pcmd\":\"be\",\"rdata\":\"01.02.80.81.a0.c0\"}");
+    std::string request = "\"originalRequest\":{\"nadr\":\"01\",\"pnum\":\"5e\",\"pcmd\":\"01\",\"hwpid\":\"ffff\",\"rdata\":\"ff.ff.ff.ff\"}";
+    for (const char *rdata : {"01.68.01.02.2c.01.80.05.a0.78.56.34.12", "01.50.fe.81.ff", "a1.00.00.c0.40"}) {
+      expectParity(1, "iqrf.sensor.ReadSensorsWithTypes_Response_rsp", response + "\"pcmd\":\"81\",\"rdata\":\"" + rdata + "\"," + request + "}");
+    }
+  }
+}
@@ -0,0 +1,352 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CurlUtils.h"
+
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace iqrf {
+
+  /**
+   * Local HTTP server standing in for repository, serves single file with ETag and range support
+   */
+  class HttpStandIn {
+  public:
+    /// Received request
+    struct Request {
+      std::string path;
+      std::string range;
+      std::string ifRange;
+    };
+
+    HttpStandIn() {
+      m_socket = ::socket(AF_INET, SOCK_STREAM, 0);
+      int reuse = 1;
+      ::setsockopt(m_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+      sockaddr_in addr{};
+      addr.sin_family = AF_INET;
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      addr.sin_port = 0;
+      if (::bind(m_socket, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || ::listen(m_socket, 8) != 0) {
+        throw std::runtime_error("Cannot start HTTP stand-in server.");
+      }
+      socklen_t len = sizeof(addr);
+      ::getsockname(m_socket, reinterpret_cast<sockaddr *>(&addr), &len);
+      m_port = ntohs(addr.sin_port);
+      m_thread = std::thread([this]() { serve(); });
+    }
+
+    ~HttpStandIn() {
+      m_stop = true;
+      m_thread.join();
+      ::close(m_socket);
+    }
+
+    std::string url(const std::string &path) const {
+      return "http://127.0.0.1:" + std::to_string(m_port) + path;
+    }
+
+    void setFile(const std::string &body, const std::string &etag) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      m_body = body;
+      m_etag = etag;
+    }
+
+    /// Next responses are interrupted after sending given number of body bytes
+    void interrupt(size_t afterBytes, unsigned int responses = 1) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      m_cutAfter = afterBytes;
+      m_cutResponses = responses;
+    }
+
+    /// Next partial responses start at given offset regardless of requested range
+    void misrange(size_t start, unsigned int responses = 1) {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      m_misrangeStart = start;
+      m_misrangeResponses = responses;
+    }
+
+    std::vector<Request> getRequests() const {
+      std::lock_guard<std::mutex> lock(m_mtx);
+      return m_requests;
+    }
+
+  private:
+    void serve() {
+      while (!m_stop) {
+        pollfd pfd{m_socket, POLLIN, 0};
+        if (::poll(&pfd, 1, 20) <= 0) {
+          continue;
+        }
+        int client = ::accept(m_socket, nullptr, nullptr);
+        if (client >= 0) {
+          handle(client);
+          ::close(client);
+        }
+      }
+    }
+
+    void handle(int client) {
+      std::string request;
+      char buf[4096];
+      while (request.find("\r\n\r\n") == std::string::npos) {
+        ssize_t len = ::recv(client, buf, sizeof(buf), 0);
+        if (len <= 0) {
+          return;
+        }
+        request.append(buf, len);
+      }
+      Request req;
+      std::istringstream is(request);
+      std::string line;
+      std::getline(is, line);
+      req.path = line.substr(line.find(' ') + 1, line.rfind(' ') - line.find(' ') - 1);
+      while (std::getline(is, line) && line != "\r") {
+        line.pop_back();
+        auto colon = line.find(": ");
+        std::string name = line.substr(0, colon);
+        std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+        if (name == "range") {
+          req.range = line.substr(colon + 2);
+        } else if (name == "if-range") {
+          req.ifRange = line.substr(colon + 2);
+        }
+      }
+
+      std::unique_lock<std::mutex> lock(m_mtx);
+      m_requests.push_back(req);
+      std::string body = m_body;
+      std::string etag = m_etag;
+      size_t cutAfter = std::string::npos;
+      if (m_cutResponses > 0) {
+        --m_cutResponses;
+        cutAfter = m_cutAfter;
+      }
+      size_t misrangeStart = std::string::npos;
+      if (m_misrangeResponses > 0 && !req.range.empty()) {
+        --m_misrangeResponses;
+        misrangeStart = m_misrangeStart;
+      }
+      lock.unlock();
+
+      std::ostringstream os;
+      if (req.path == "/missing") {
+        os << "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        send(client, os.str());
+        return;
+      }
+      size_t offset = 0;
+      if (req.range.rfind("bytes=", 0) == 0 && (req.ifRange.empty() || req.ifRange == etag)) {
+        offset = std::stoul(req.range.substr(6));
+        if (offset >= body.size()) {
+          os << "HTTP/1.1 416 Range Not Satisfiable\r\nContent-Range: bytes */" << body.size()
+            << "\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+          send(client, os.str());
+          return;
+        }
+        if (misrangeStart != std::string::npos) {
+          offset = misrangeStart;
+        }
+        os << "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " << offset << '-' << body.size() - 1 << '/' << body.size() << "\r\n";
+      } else {
+        os << "HTTP/1.1 200 OK\r\n";
+      }
+      os << "ETag: " << etag << "\r\nContent-Length: " << body.size() - offset << "\r\nConnection: close\r\n\r\n";
+      send(client, os.str() + body.substr(offset, cutAfter));
+    }
+
+    static void send(int client, const std::string &data) {
+      size_t sent = 0;
+      while (sent < data.size()) {
+        ssize_t len = ::send(client, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (len <= 0) {
+          return;
+        }
+        sent += len;
+      }
+    }
+
+    int m_socket = -1;
+    uint16_t m_port = 0;
+    std::atomic<bool> m_stop{false};
+    std::thread m_thread;
+    mutable std::mutex m_mtx;
+    std::string m_body;
+    std::string m_etag;
+    size_t m_cutAfter = 0;
+    unsigned int m_cutResponses = 0;
+    size_t m_misrangeStart = 0;
+    unsigned int m_misrangeResponses = 0;
+    std::vector<Request> m_requests;
+  };
+
+  class CurlUtilsTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      m_dir = fs::temp_directory_path() / ("CurlUtilsTest-" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+      fs::remove_all(m_dir);
+      m_file = (m_dir / "cache.zip").string();
+      m_body = randomBody(1 << 20);
+      m_server.setFile(m_body, "\"v1\"");
+    }
+
+    void TearDown() override {
+      fs::remove_all(m_dir);
+    }
+
+    static std::string randomBody(size_t size) {
+      std::mt19937 gen(size);
+      std::string body(size, '\0');
+      for (auto &c : body) {
+        c = static_cast<char>(gen());
+      }
+      return body;
+    }
+
+    static std::string read(const std::string &fileName) {
+      std::ifstream file(fileName, std::ios::binary);
+      return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    void download(unsigned int attempts) {
+      CurlUtils::downloadFileResumable(m_server.url("/zip"), m_file, {{"accept", "application/zip"}}, attempts, std::chrono::milliseconds(1));
+    }
+
+    HttpStandIn m_server;
+    fs::path m_dir;
+    std::string m_file;
+    std::string m_body;
+  };
+
+  TEST_F(CurlUtilsTest, completeDownload) {
+    download(1);
+    EXPECT_EQ(m_body, read(m_file));
+    EXPECT_FALSE(fs::exists(m_file + ".part"));
+    EXPECT_FALSE(fs::exists(m_file + ".part.tag"));
+    ASSERT_EQ(1u, m_server.getRequests().size());
+    EXPECT_TRUE(m_server.getRequests()[0].range.empty());
+  }
+
+  TEST_F(CurlUtilsTest, retryResumesTransfer) {
+    m_server.interrupt(300000, 2);
+    download(3);
+    EXPECT_EQ(m_body, read(m_file));
+    auto requests = m_server.getRequests();
+    ASSERT_EQ(3u, requests.size());
+    // each attempt asks only for the missing part
+    EXPECT_EQ("bytes=300000-", requests[1].range);
+    EXPECT_EQ("\"v1\"", requests[1].ifRange);
+    EXPECT_EQ("bytes=600000-", requests[2].range);
+  }
+
+  TEST_F(CurlUtilsTest, nextCallResumesTransfer) {
+    m_server.interrupt(500000);
+    EXPECT_THROW(download(1), std::runtime_error);
+    EXPECT_FALSE(fs::exists(m_file));
+    EXPECT_EQ(500000u, fs::file_size(m_file + ".part"));
+
+    download(1);
+    EXPECT_EQ(m_body, read(m_file));
+    EXPECT_EQ("bytes=500000-", m_server.getRequests().back().range);
+  }
+
+  TEST_F(CurlUtilsTest, changedFileDownloadedAgain) {
+    m_server.interrupt(500000);
+    EXPECT_THROW(download(1), std::runtime_error);
+
+    // validator does not match, server sends the whole new file
+    std::string body = randomBody(700000);
+    m_server.setFile(body, "\"v2\"");
+    download(1);
+    EXPECT_EQ(body, read(m_file));
+    EXPECT_EQ("\"v1\"", m_server.getRequests().back().ifRange);
+  }
+
+  TEST_F(CurlUtilsTest, completePartNotDownloadedAgain) {
+    m_server.interrupt(500000);
+    EXPECT_THROW(download(1), std::runtime_error);
+    {
+      std::ofstream part(m_file + ".part", std::ios::binary | std::ios::app);
+      part << m_body.substr(500000);
+    }
+    download(1);
+    EXPECT_EQ(m_body, read(m_file));
+  }
+
+  TEST_F(CurlUtilsTest, mismatchedRangeDiscarded) {
+    m_server.interrupt(500000);
+    EXPECT_THROW(download(1), std::runtime_error);
+
+    // partial content not continuing the partial file is not appended, the download starts over
+    m_server.misrange(400000);
+    EXPECT_THROW(download(1), std::runtime_error);
+    EXPECT_FALSE(fs::exists(m_file));
+    EXPECT_FALSE(fs::exists(m_file + ".part"));
+    EXPECT_EQ("bytes=500000-", m_server.getRequests().back().range);
+
+    download(1);
+    EXPECT_EQ(m_body, read(m_file));
+    EXPECT_TRUE(m_server.getRequests().back().range.empty());
+  }
+
+  TEST_F(CurlUtilsTest, missingFileNotRetried) {
+    EXPECT_THROW(
+      CurlUtils::downloadFileResumable(m_server.url("/missing"), m_file, {}, 3, std::chrono::milliseconds(1)),
+      std::runtime_error
+    );
+    EXPECT_EQ(1u, m_server.getRequests().size());
+    EXPECT_FALSE(fs::exists(m_file));
+    EXPECT_FALSE(fs::exists(m_file + ".part"));
+  }
+
+  TEST_F(CurlUtilsTest, concurrentDownloads) {
+    std::string serverFile = (m_dir / "serverCheck.json").string();
+    CurlUtils::downloadFiles({
+      {m_server.url("/zip"), m_file, {{"accept", "application/zip"}}},
+      {m_server.url("/server"), serverFile, {{"accept", "application/json"}}},
+    }, 1);
+    EXPECT_EQ(m_body, read(m_file));
+    EXPECT_EQ(m_body, read(serverFile));
+
+    // failure of any download is reported
+    EXPECT_THROW(CurlUtils::downloadFiles({
+      {m_server.url("/zip"), m_file, {}},
+      {m_server.url("/missing"), serverFile, {}},
+    }, 1), std::runtime_error);
+  }
+
+}
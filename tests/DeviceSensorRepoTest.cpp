@@ -0,0 +1,178 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <repositories/device_sensor_repo.hpp>
+
+#include <gtest/gtest.h>
+#include <SQLiteCpp/SQLiteCpp.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using iqrf::db::models::DeviceSensor;
+using iqrf::db::repos::DeviceSensorRepository;
+using iqrf::db::repos::DeviceSensorValue;
+using iqrf::db::repos::StatementCache;
+
+namespace iqrf {
+
+  class DeviceSensorRepoTest : public ::testing::Test {
+  protected:
+    static constexpr uint8_t NODES = 239;
+    static constexpr uint8_t SENSORS = 4;
+
+    void SetUp() override {
+      m_dbPath = std::string(std::getenv("TESTS_DATA_DIR")) + "sensors.db";
+      std::filesystem::remove(m_dbPath);
+      m_db = std::make_shared<SQLite::Database>(m_dbPath, SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE);
+      m_db->exec(R"(
+        CREATE TABLE "deviceSensor" (
+          "address" INTEGER NOT NULL,
+          "type" INTEGER NOT NULL,
+          "globalIndex" INTEGER NOT NULL,
+          "typeIndex" INTEGER NOT NULL,
+          "sensorId" INTEGER NOT NULL,
+          "value" REAL,
+          "updated" TEXT,
+          "metadata" TEXT,
+          PRIMARY KEY("address", "type", "globalIndex")
+        );
+      )");
+      SQLite::Transaction transaction(*m_db);
+      DeviceSensorRepository repo(m_db);
+      for (uint8_t addr = 1; addr <= NODES; ++addr) {
+        // two temperature sensors followed by other types
+        for (uint8_t i = 0; i < SENSORS; ++i) {
+          repo.insert(DeviceSensor(addr, i < 2 ? 1 : i, i, i < 2 ? i : 0, i + 1));
+        }
+      }
+      transaction.commit();
+    }
+
+    void TearDown() override {
+      m_db.reset();
+      std::filesystem::remove(m_dbPath);
+    }
+
+    /// Sensor values of whole network sweep
+    static std::vector<DeviceSensorValue> sweep(double value) {
+      std::vector<DeviceSensorValue> values;
+      for (uint8_t addr = 1; addr <= NODES; ++addr) {
+        for (uint8_t i = 0; i < SENSORS; ++i) {
+          values.push_back({addr, static_cast<uint8_t>(i < 2 ? 1 : i), i, value + addr});
+        }
+      }
+      return values;
+    }
+
+    std::string m_dbPath;
+    std::shared_ptr<SQLite::Database> m_db;
+  };
+
+  TEST_F(DeviceSensorRepoTest, updateValues) {
+    DeviceSensorRepository repo(m_db);
+    auto updated = std::make_shared<std::string>("2026-01-01T00:00:00Z");
+    std::vector<DeviceSensorValue> values = {
+      {1, 1, 1, 21.5},
+      {2, 3, 3, 1.5},
+      {NODES + 1, 1, 0, 5},
+      {2, 3, 1, 5},
+    };
+    auto missing = repo.updateValues(values, updated, false);
+    ASSERT_EQ(2u, missing.size());
+    EXPECT_EQ(NODES + 1, missing[0].address);
+    EXPECT_EQ(1, missing[1].index);
+
+    auto sensor = repo.getByAddressTypeIndex(1, 1, 1, false);
+    EXPECT_DOUBLE_EQ(21.5, sensor->getValue().value());
+    EXPECT_EQ(*updated, *sensor->getUpdated());
+    // timestamp is bound once for all values
+    sensor = repo.getByAddressTypeIndex(2, 3, 3, false);
+    EXPECT_DOUBLE_EQ(1.5, sensor->getValue().value());
+    EXPECT_EQ(*updated, *sensor->getUpdated());
+    EXPECT_FALSE(repo.getByAddressTypeIndex(1, 1, 0, false)->getValue().has_value());
+  }
+
+  TEST_F(DeviceSensorRepoTest, updateValuesFrcIndex) {
+    auto cache = std::make_shared<StatementCache>(m_db);
+    DeviceSensorRepository repo(m_db, cache);
+    // second temperature sensor by type index
+    auto missing = repo.updateValues({{5, 1, 1, 22}, {5, 1, 2, 23}}, nullptr, true);
+    ASSERT_EQ(1u, missing.size());
+    EXPECT_DOUBLE_EQ(22, repo.getByAddressTypeIndex(5, 1, 1, true)->getValue().value());
+    EXPECT_DOUBLE_EQ(22, repo.getByAddressTypeIndex(5, 1, 1, false)->getValue().value());
+    EXPECT_EQ(nullptr, repo.getByAddressTypeIndex(5, 1, 1, false)->getUpdated());
+  }
+
+  TEST_F(DeviceSensorRepoTest, updateMetadata) {
+    DeviceSensorRepository repo(m_db);
+    auto updated = std::make_shared<std::string>("2026-01-01T00:00:00Z");
+    repo.updateValues({{3, 1, 0, 21.5}}, updated, false);
+
+    // stale value of sensor loaded before write-behind flush
+    auto sensor = repo.getByAddressTypeIndex(3, 1, 0, false);
+    sensor->setValue(1);
+    sensor->setUpdated(std::make_shared<std::string>("2026-01-01T00:01:00Z"));
+    sensor->setMetadata(std::make_shared<std::string>("{}"));
+    repo.updateMetadata(*sensor, false);
+    auto stored = repo.getByAddressTypeIndex(3, 1, 0, false);
+    EXPECT_DOUBLE_EQ(21.5, stored->getValue().value());
+    EXPECT_EQ(*updated, *stored->getUpdated());
+    EXPECT_EQ("{}", *stored->getMetadata());
+
+    // data block timestamp
+    repo.updateMetadata(*sensor, true);
+    stored = repo.getByAddressTypeIndex(3, 1, 0, false);
+    EXPECT_DOUBLE_EQ(21.5, stored->getValue().value());
+    EXPECT_EQ(*sensor->getUpdated(), *stored->getUpdated());
+  }
+
+  TEST_F(DeviceSensorRepoTest, sweepBenchmark) {
+    auto cache = std::make_shared<StatementCache>(m_db);
+    DeviceSensorRepository repo(m_db, cache);
+    auto updated = std::make_shared<std::string>("2026-01-01T00:00:00Z");
+
+    // each sensor looked up and updated in its own implicit transaction
+    auto values = sweep(1);
+    auto start = std::chrono::steady_clock::now();
+    for (const auto &item : values) {
+      auto sensor = repo.getByAddressTypeIndex(item.address, item.type, item.index, false);
+      sensor->setValue(item.value);
+      sensor->setUpdated(updated);
+      repo.update(*sensor);
+    }
+    auto singleTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    values = sweep(2);
+    start = std::chrono::steady_clock::now();
+    {
+      SQLite::Transaction transaction(*m_db);
+      EXPECT_TRUE(repo.updateValues(values, updated, false).empty());
+      transaction.commit();
+    }
+    auto batchTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    EXPECT_DOUBLE_EQ(2 + NODES, repo.getByAddressTypeIndex(NODES, 3, 3, false)->getValue().value());
+    RecordProperty("sensorValues", static_cast<int>(values.size()));
+    RecordProperty("singleUpdatesUs", std::to_string(singleTime));
+    RecordProperty("batchUpdateUs", std::to_string(batchTime));
+  }
+
+}
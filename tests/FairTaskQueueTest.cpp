@@ -0,0 +1,122 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "FairTaskQueue.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fair_task_queue_test {
+
+class FairTaskQueueTest : public ::testing::Test {
+protected:
+  std::mutex mtx;
+  std::vector<std::string> processed;
+
+  void handler(const std::string &val) {
+    std::lock_guard<std::mutex> lock(mtx);
+    processed.push_back(val);
+  }
+
+  void SetUp() override {
+    processed.clear();
+  }
+};
+
+TEST_F(FairTaskQueueTest, SizeTest) {
+  FairTaskQueue<std::string, std::string> queue([this](std::string val) {
+    handler(val);
+  });
+  queue.stopQueue();
+  EXPECT_EQ(queue.size(), 0);
+
+  EXPECT_EQ(queue.pushToQueue("a", "a1"), 1);
+  EXPECT_EQ(queue.pushToQueue("a", "a2"), 2);
+  EXPECT_EQ(queue.pushToQueue("b", "b1"), 1);
+  EXPECT_EQ(queue.size(), 3);
+  EXPECT_EQ(queue.size("a"), 2);
+  EXPECT_EQ(queue.size("b"), 1);
+  EXPECT_EQ(queue.size("c"), 0);
+
+  auto occupancy = queue.getOccupancy();
+  EXPECT_EQ(occupancy.size(), 2);
+  EXPECT_EQ(occupancy["a"], 2);
+  EXPECT_EQ(occupancy["b"], 1);
+
+  queue.clearQueue();
+  EXPECT_EQ(queue.size(), 0);
+  EXPECT_TRUE(queue.getOccupancy().empty());
+}
+
+TEST_F(FairTaskQueueTest, RoundRobinTest) {
+  FairTaskQueue<std::string, std::string> queue([this](std::string val) {
+    handler(val);
+  });
+  queue.stopQueue();
+
+  for (int i = 1; i <= 4; ++i) {
+    queue.pushToQueue("flood", "f" + std::to_string(i));
+  }
+  queue.pushToQueue("ws", "w1");
+  queue.pushToQueue("ws", "w2");
+
+  queue.startQueue();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  std::vector<std::string> expected = {"f1", "w1", "f2", "w2", "f3", "f4"};
+  EXPECT_EQ(processed, expected);
+  EXPECT_EQ(queue.size(), 0);
+}
+
+TEST_F(FairTaskQueueTest, QuantumTest) {
+  FairTaskQueue<std::string, std::string> queue([this](std::string val) {
+    handler(val);
+  });
+  queue.stopQueue();
+  queue.setQuantum("a", 2);
+
+  queue.pushToQueue("a", "a1");
+  queue.pushToQueue("a", "a2");
+  queue.pushToQueue("a", "a3");
+  queue.pushToQueue("b", "b1");
+  queue.pushToQueue("b", "b2");
+
+  queue.startQueue();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  std::vector<std::string> expected = {"a1", "a2", "b1", "a3", "b2"};
+  EXPECT_EQ(processed, expected);
+}
+
+TEST_F(FairTaskQueueTest, StopQueueTest) {
+  FairTaskQueue<std::string, std::string> queue([this](std::string val) {
+    handler(val);
+  });
+  EXPECT_TRUE(queue.isActive());
+  queue.stopQueue();
+  EXPECT_FALSE(queue.isActive());
+
+  queue.pushToQueue("a", "a1");
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_EQ(queue.size(), 1);
+  EXPECT_TRUE(processed.empty());
+}
+
+}
@@ -0,0 +1,65 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FunctionProfiler.h"
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace iqrf {
+
+  TEST(FunctionProfilerTest, disabledByDefault) {
+    FunctionProfiler profiler;
+    EXPECT_FALSE(profiler.isEnabled());
+    profiler.enable(true);
+    EXPECT_TRUE(profiler.isEnabled());
+    profiler.enable(false);
+    EXPECT_FALSE(profiler.isEnabled());
+  }
+
+  TEST(FunctionProfilerTest, record) {
+    FunctionProfiler profiler;
+    profiler.record(1, 7, 300ns, -64, false);
+    profiler.record(1, 7, 500ns, -16, true);
+    profiler.record(1, 8, 100ns, 128, false);
+    profiler.record(-0x10000, 7, 200ns, 0, false);
+    auto result = profiler.getProfile();
+    ASSERT_EQ(2u, result.size());
+    const auto &profile = result[1][7];
+    EXPECT_EQ(2u, profile.calls);
+    EXPECT_EQ(1u, profile.errors);
+    EXPECT_EQ(800u, profile.totalTimeNs);
+    EXPECT_EQ(500u, profile.maxTimeNs);
+    EXPECT_EQ(-80, profile.heapGrowthBytes);
+    // maximum of negative growths stays negative
+    EXPECT_EQ(-16, profile.maxHeapGrowthBytes);
+    EXPECT_EQ(1u, result[1][8].calls);
+    EXPECT_EQ(128, result[1][8].maxHeapGrowthBytes);
+    EXPECT_EQ(200u, result[-0x10000][7].totalTimeNs);
+  }
+
+  TEST(FunctionProfilerTest, reset) {
+    FunctionProfiler profiler;
+    profiler.enable(true);
+    profiler.record(1, 7, 300ns, 0, false);
+    profiler.reset();
+    EXPECT_TRUE(profiler.getProfile().empty());
+    EXPECT_TRUE(profiler.isEnabled());
+  }
+
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Context.h"
+#include "HeapAllocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+namespace iqrf {
+
+  TEST(HeapAllocatorTest, accounting) {
+    HeapAllocator allocator;
+    void *small = HeapAllocator::allocFunction(&allocator, 10);
+    void *large = HeapAllocator::allocFunction(&allocator, 5000);
+    ASSERT_NE(nullptr, small);
+    ASSERT_NE(nullptr, large);
+    std::memset(small, 0xAA, 10);
+    std::memset(large, 0xBB, 5000);
+    auto stats = allocator.getStats();
+    EXPECT_EQ(5010u, stats.liveBytes);
+    EXPECT_EQ(5010u, stats.peakBytes);
+    EXPECT_GE(stats.reservedBytes, 5010u);
+
+    // growing small block moves it into larger class or process heap, content is kept
+    small = HeapAllocator::reallocFunction(&allocator, small, 2000);
+    ASSERT_NE(nullptr, small);
+    EXPECT_EQ(0xAA, static_cast<unsigned char *>(small)[9]);
+    EXPECT_EQ(7000u, allocator.getStats().liveBytes);
+
+    HeapAllocator::freeFunction(&allocator, small);
+    HeapAllocator::freeFunction(&allocator, large);
+    HeapAllocator::freeFunction(&allocator, nullptr);
+    stats = allocator.getStats();
+    EXPECT_EQ(0u, stats.liveBytes);
+    EXPECT_EQ(7000u, stats.peakBytes);
+  }
+
+  TEST(HeapAllocatorTest, poolReuse) {
+    HeapAllocator allocator;
+    void *first = HeapAllocator::allocFunction(&allocator, 40);
+    size_t reserved = allocator.getStats().reservedBytes;
+    HeapAllocator::freeFunction(&allocator, first);
+    // freed block is reused by allocation of the same class without taking more memory
+    void *second = HeapAllocator::allocFunction(&allocator, 33);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(reserved, allocator.getStats().reservedBytes);
+    // zero size allocation returns nullptr
+    EXPECT_EQ(nullptr, HeapAllocator::reallocFunction(&allocator, second, 0));
+    EXPECT_EQ(0u, allocator.getStats().liveBytes);
+  }
+
+  TEST(HeapAllocatorTest, limitOnlyWhenEnabled) {
+    HeapAllocator allocator(1000);
+    void *block = HeapAllocator::allocFunction(&allocator, 2000);
+    ASSERT_NE(nullptr, block);
+    allocator.enableLimit(true);
+    EXPECT_EQ(nullptr, HeapAllocator::allocFunction(&allocator, 10));
+    EXPECT_EQ(nullptr, HeapAllocator::reallocFunction(&allocator, block, 3000));
+    // shrinking is always allowed
+    block = HeapAllocator::reallocFunction(&allocator, block, 100);
+    ASSERT_NE(nullptr, block);
+    allocator.enableLimit(false);
+    HeapAllocator::freeFunction(&allocator, block);
+    auto stats = allocator.getStats();
+    EXPECT_EQ(1000u, stats.limitBytes);
+    EXPECT_EQ(2u, stats.limitHits);
+    EXPECT_EQ(0u, stats.liveBytes);
+  }
+
+  TEST(HeapAllocatorTest, contextLimit) {
+    Context context(512 * 1024);
+    context.loadCode(
+      "var t = {};"
+      "t.grow = function (p) { var a = []; for (var i = 0; i < p; ++i) { a.push('item' + i); } return a.length; };"
+    );
+    std::string ret;
+    context.callFunction(0, "t.grow", "100", ret);
+    EXPECT_EQ("100", ret);
+    // runaway driver code fails with an error instead of exhausting process memory
+    EXPECT_THROW(context.callFunction(0, "t.grow", "10000000", ret), std::logic_error);
+    auto stats = context.getMemoryStats();
+    EXPECT_LT(0u, stats.limitHits);
+    EXPECT_LE(stats.liveBytes, stats.peakBytes);
+    // context stays usable after the failure
+    context.callFunction(0, "t.grow", "100", ret);
+    EXPECT_EQ("100", ret);
+  }
+
+}
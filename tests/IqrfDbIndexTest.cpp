@@ -0,0 +1,86 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IqrfDbIndex.h"
+
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+#include <vector>
+
+using iqrf::db::models::Device;
+using iqrf::db::models::DeviceSensor;
+using iqrf::db::models::Product;
+
+namespace iqrf {
+
+  class IqrfDbIndexTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      // coordinator without product
+      m_devices.emplace_back(0, true, 0x8100AAAA, 0, 0, 0);
+      for (uint8_t addr = 1; addr <= 239; ++addr) {
+        m_devices.emplace_back(addr, true, 0x81000000 + addr, addr % 2 + 1, 0, 1);
+        // two temperature sensors followed by humidity sensor
+        m_sensors.emplace_back(addr, 1, 0, 0, 1);
+        m_sensors.emplace_back(addr, 1, 1, 1, 1);
+        m_sensors.emplace_back(addr, 128, 2, 0, 2);
+      }
+      m_products.emplace(1, Product(1, 0x0001, 0, 0x08D7, "0404", 0x0416));
+      m_products.emplace(2, Product(2, 0x0002, 0, 0x08D7, "0404", 0x0416));
+    }
+
+    std::vector<Device> m_devices;
+    std::vector<DeviceSensor> m_sensors;
+    std::unordered_map<uint32_t, Product> m_products;
+  };
+
+  TEST_F(IqrfDbIndexTest, deviceAttributes) {
+    IqrfDbIndex index(m_devices, m_products, m_sensors);
+    EXPECT_TRUE(index.hasDevice(0));
+    EXPECT_EQ(0x8100AAAAu, index.getMid(0).value());
+    EXPECT_FALSE(index.getHwpid(0).has_value());
+    EXPECT_EQ(0x81000000u + 239, index.getMid(239).value());
+    EXPECT_EQ(0x0002, index.getHwpid(239).value());
+    EXPECT_EQ(0x0001, index.getHwpid(10).value());
+    EXPECT_FALSE(index.hasDevice(240));
+    EXPECT_FALSE(index.getMid(255).has_value());
+  }
+
+  TEST_F(IqrfDbIndexTest, sensorIndexes) {
+    // sensors are indexed regardless of record order
+    std::vector<DeviceSensor> sensors(m_sensors.rbegin(), m_sensors.rend());
+    IqrfDbIndex index(m_devices, m_products, sensors);
+    EXPECT_EQ(0, index.getGlobalSensorIndex(1, 1, 0).value());
+    EXPECT_EQ(1, index.getGlobalSensorIndex(1, 1, 1).value());
+    EXPECT_EQ(2, index.getGlobalSensorIndex(239, 128, 0).value());
+    EXPECT_FALSE(index.getGlobalSensorIndex(239, 128, 1).has_value());
+    EXPECT_FALSE(index.getGlobalSensorIndex(0, 1, 0).has_value());
+    EXPECT_FALSE(index.getGlobalSensorIndex(240, 1, 0).has_value());
+    EXPECT_TRUE(index.hasSensor(239, 128, 2));
+    EXPECT_FALSE(index.hasSensor(239, 128, 1));
+    EXPECT_FALSE(index.hasSensor(240, 1, 0));
+  }
+
+  TEST_F(IqrfDbIndexTest, emptyIndex) {
+    IqrfDbIndex index;
+    EXPECT_FALSE(index.hasDevice(1));
+    EXPECT_FALSE(index.getHwpid(1).has_value());
+    EXPECT_FALSE(index.getGlobalSensorIndex(1, 1, 0).has_value());
+  }
+
+}
@@ -0,0 +1,183 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Context.h"
+#ifdef WITH_QUICKJS
+#include "QuickJsContext.h"
+#endif
+
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace iqrf {
+
+  /**
+   * Engine under test
+   */
+  struct JsEngineParam {
+    /// engine name
+    std::string name;
+    /// creates empty context of engine
+    std::function<std::shared_ptr<JsEngineContext>()> create;
+  };
+
+  std::ostream &operator<<(std::ostream &os, const JsEngineParam &param) {
+    return os << param.name;
+  }
+
+  /**
+   * Tests shared by all engines, driver code results have to match Duktape results
+   */
+  class JsEngineTest : public ::testing::TestWithParam<JsEngineParam> {
+  protected:
+    static std::string readFile(const std::string &path) {
+      std::ifstream file(path);
+      EXPECT_TRUE(file.is_open()) << path;
+      std::stringstream ss;
+      ss << file.rdbuf();
+      return ss.str();
+    }
+
+    static std::string dataDir() {
+      return std::string(std::getenv("TESTS_DATA_DIR")) + "../src/";
+    }
+
+    static std::string readDriver(const std::string &standard, const std::string &version) {
+      auto doc = json::parse(readFile(dataDir() + "tests/TestJsCache/iqrfRepoCache0/standards/" + standard + "/" + version + "/data.json"));
+      return doc["driver"].get<std::string>();
+    }
+
+    static std::string driverCode() {
+      std::ostringstream code;
+      code << readDriver("-1", "0") << std::endl << readDriver("13", "0") << std::endl << readDriver("94", "15") << std::endl
+        << readFile(dataDir() + "start-IqrfDaemon/javaScript/DaemonWrapper.js") << std::endl;
+      return code.str();
+    }
+
+    static std::vector<std::string> sensorResponses() {
+      std::string response = "{\"nadr\":\"01\",\"pnum\":\"5e\",\"hwpid\":\"ffff\",\"rcode\":\"00\",\"dpaval\":\"4a\",\"pcmd\":\"81\",";
+      std::string request = "\"originalRequest\":{\"nadr\":\"01\",\"pnum\":\"5e\",\"pcmd\":\"01\",\"hwpid\":\"ffff\",\"rdata\":\"ff.ff.ff.ff\"}";
+      std::vector<std::string> responses;
+      for (const char *rdata : {"01.68.01.02.2c.01.80.05.a0.78.56.34.12", "01.50.fe.81.ff", "a1.00.00.c0.40"}) {
+        responses.push_back(response + "\"rdata\":\"" + rdata + "\"," + request + "}");
+      }
+      return responses;
+    }
+
+    static std::string toStr(const rapidjson::Value &val) {
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+      val.Accept(writer);
+      return buffer.GetString();
+    }
+  };
+
+  TEST_P(JsEngineTest, driverParity) {
+    const std::string fname = "iqrf.sensor.ReadSensorsWithTypes_Response_rsp";
+    Context reference;
+    reference.loadCode(driverCode());
+    auto context = GetParam().create();
+    std::vector<char> bytecode;
+    context->loadCode(driverCode(), &bytecode);
+    EXPECT_FALSE(bytecode.empty());
+    for (const auto &params : sensorResponses()) {
+      std::string expected;
+      reference.callFunction(0, fname, params, expected);
+      std::string textRet;
+      context->callFunction(0, fname, params, textRet);
+      EXPECT_EQ(json::parse(expected), json::parse(textRet)) << params;
+      rapidjson::Document paramsDoc;
+      paramsDoc.Parse(params);
+      rapidjson::Document ret;
+      context->callFunction(0, fname, paramsDoc, ret, ret.GetAllocator());
+      EXPECT_EQ(json::parse(expected), json::parse(toStr(ret))) << params;
+    }
+
+    // compiled code is loaded by a context of the same engine
+    auto loaded = GetParam().create();
+    loaded->loadBytecode(bytecode);
+    std::string expected;
+    std::string ret;
+    reference.callFunction(fname, sensorResponses()[0], expected);
+    loaded->callFunction(fname, sensorResponses()[0], ret);
+    EXPECT_EQ(json::parse(expected), json::parse(ret));
+  }
+
+  TEST_P(JsEngineTest, errors) {
+    auto context = GetParam().create();
+    context->loadCode(
+      "var t = {};"
+      "t.fail = function (p) { throw new Error('failed ' + p.x); };"
+      "t.echo = function (p) { return p; };"
+    );
+    std::string ret;
+    try {
+      context->callFunction(0, "t.fail", "{\"x\":1}", ret);
+      ADD_FAILURE() << "Expected exception";
+    } catch (const std::logic_error &e) {
+      EXPECT_EQ("Error: failed 1", std::string(e.what()));
+    }
+    EXPECT_THROW(context->callFunction(1, "t.missing", "{}", ret), std::logic_error);
+    EXPECT_THROW(context->callFunction(2, "missing.echo", "{}", ret), PeripheralException);
+    EXPECT_THROW(context->callFunction(3, "t.missing_rsp", "{}", ret), PeripheralCommandException);
+    context->callFunction(4, "t.echo", "{\"x\":1}", ret);
+    EXPECT_EQ("{\"x\":1}", ret);
+  }
+
+  TEST_P(JsEngineTest, throughput) {
+    const std::string fname = "iqrf.sensor.ReadSensorsWithTypes_Response_rsp";
+    const int calls = 2000;
+    auto context = GetParam().create();
+    context->loadCode(driverCode());
+    auto responses = sensorResponses();
+    std::vector<rapidjson::Document> params(responses.size());
+    for (size_t i = 0; i < responses.size(); ++i) {
+      params[i].Parse(responses[i]);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < calls; ++i) {
+      rapidjson::Document ret;
+      context->callFunction(0, fname, params[i % params.size()], ret, ret.GetAllocator());
+      ASSERT_TRUE(ret.IsObject());
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    RecordProperty("callsPerSecond", std::to_string(static_cast<long>(calls / elapsed.count())));
+    RecordProperty("heapBytes", std::to_string(context->getMemoryStats().liveBytes));
+  }
+
+  INSTANTIATE_TEST_SUITE_P(Engines, JsEngineTest, ::testing::Values(
+    JsEngineParam{"duktape", []() { return std::make_shared<Context>(); }}
+#ifdef WITH_QUICKJS
+    , JsEngineParam{"quickjs", []() { return std::make_shared<QuickJsContext>(); }}
+#endif
+  ), [](const ::testing::TestParamInfo<JsEngineParam> &info) { return info.param.name; });
+}
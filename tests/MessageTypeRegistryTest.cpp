@@ -0,0 +1,87 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MessageTypeRegistry.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace iqrf {
+
+  typedef MessageTypeRegistry::MsgType MsgType;
+
+  TEST(MessageTypeRegistryTest, intern) {
+    MessageTypeRegistry registry;
+    auto first = registry.intern(MsgType("iqrfDb_GetSensors", 1, 0, 0));
+    auto second = registry.intern(MsgType("iqrfDb_GetSensors", 1, 1, 0));
+    auto other = registry.intern(MsgType("mngDaemon_Version", 1, 0, 0));
+    EXPECT_EQ(first, registry.intern(MsgType("iqrfDb_GetSensors", 1, 0, 0)));
+    EXPECT_NE(first, second);
+    EXPECT_EQ(2u, registry.getTypeCount());
+    EXPECT_EQ(3u, registry.size());
+
+    const auto &msgType = registry.get(second);
+    EXPECT_EQ("iqrfDb_GetSensors", msgType.m_type);
+    EXPECT_EQ(second, msgType.m_id);
+    EXPECT_EQ(registry.get(first).m_typeId, msgType.m_typeId);
+    EXPECT_NE(registry.get(other).m_typeId, msgType.m_typeId);
+  }
+
+  TEST(MessageTypeRegistryTest, find) {
+    MessageTypeRegistry registry;
+    auto id = registry.intern(MsgType("iqrfDb_GetSensors", 1, 0, 0));
+    auto typeId = registry.getTypeId(std::string_view("iqrfDb_GetSensors"));
+    ASSERT_NE(MsgType::UnknownId, typeId);
+
+    const MsgType *found = registry.find(typeId, 1, 0, 0);
+    ASSERT_NE(nullptr, found);
+    // lookup returns registered entry
+    EXPECT_EQ(&registry.get(id), found);
+    EXPECT_EQ(nullptr, registry.find(typeId, 2, 0, 0));
+    EXPECT_EQ(MsgType::UnknownId, registry.getTypeId("iqrfDb_GetSensor"));
+    EXPECT_EQ(nullptr, registry.find(MsgType::UnknownId, 1, 0, 0));
+  }
+
+  TEST(MessageTypeRegistryTest, parseVersion) {
+    int major = 1, minor = 0, micro = 0;
+    MessageTypeRegistry::parseVersion("2.3.14", major, minor, micro);
+    EXPECT_EQ(2, major);
+    EXPECT_EQ(3, minor);
+    EXPECT_EQ(14, micro);
+
+    // parsing stops at invalid component
+    major = 1, minor = 0, micro = 0;
+    MessageTypeRegistry::parseVersion("2.x.4", major, minor, micro);
+    EXPECT_EQ(2, major);
+    EXPECT_EQ(0, minor);
+    EXPECT_EQ(0, micro);
+
+    major = 1, minor = 0, micro = 0;
+    MessageTypeRegistry::parseVersion("3.1", major, minor, micro);
+    EXPECT_EQ(3, major);
+    EXPECT_EQ(1, minor);
+    EXPECT_EQ(0, micro);
+
+    major = 1, minor = 0, micro = 0;
+    MessageTypeRegistry::parseVersion("", major, minor, micro);
+    EXPECT_EQ(1, major);
+    MessageTypeRegistry::parseVersion("v2", major, minor, micro);
+    EXPECT_EQ(1, major);
+  }
+
+}
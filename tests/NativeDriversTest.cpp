@@ -0,0 +1,325 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Context.h"
+#include "NativeDrivers.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <openssl/evp.h>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace iqrf {
+
+  /**
+   * Differential tests of native driver functions against driver code they replace
+   *
+   * Both implementations are run on the same DPA responses and must return identical JSON.
+   */
+  class NativeDriversTest : public ::testing::Test {
+  protected:
+    static std::string readFile(const std::string &path) {
+      std::ifstream file(path, std::ios::binary);
+      EXPECT_TRUE(file.is_open()) << path;
+      std::stringstream ss;
+      ss << file.rdbuf();
+      return ss.str();
+    }
+
+    static std::string dataDir() {
+      return std::string(std::getenv("TESTS_DATA_DIR")) + "../src/";
+    }
+
+    static std::string readDriver(const std::string &standard, const std::string &version) {
+      auto doc = json::parse(readFile(dataDir() + "tests/TestJsCache/iqrfRepoCache0/standards/" + standard + "/" + version + "/data.json"));
+      return doc["driver"].get<std::string>();
+    }
+
+    static std::string sha256(const std::string &data) {
+      unsigned char digest[EVP_MAX_MD_SIZE];
+      unsigned int len = 0;
+      EVP_Digest(data.data(), data.size(), digest, &len, EVP_sha256(), nullptr);
+      std::string hash;
+      char buf[3];
+      for (unsigned int i = 0; i < len; ++i) {
+        std::snprintf(buf, sizeof(buf), "%02x", digest[i]);
+        hash += buf;
+      }
+      return hash;
+    }
+
+    static std::string toRdata(const std::vector<uint8_t> &data) {
+      std::string rdata;
+      char buf[4];
+      for (size_t i = 0; i < data.size(); ++i) {
+        std::snprintf(buf, sizeof(buf), i > 0 ? ".%02x" : "%02x", data[i]);
+        rdata += buf;
+      }
+      return rdata;
+    }
+
+    static json response(const std::string &pnum, const std::string &pcmd, const std::vector<uint8_t> &data) {
+      return {{"nadr", "01"}, {"pnum", pnum}, {"pcmd", pcmd}, {"hwpid", "ffff"}, {"rcode", "00"}, {"dpaval", "4a"}, {"rdata", toRdata(data)}};
+    }
+
+    void SetUp() override {
+      m_library = readDriver("-1", "0");
+      m_embedFrc = readDriver("13", "0");
+      m_sensor = readDriver("94", "15");
+      m_binaryOutput = readDriver("75", "4");
+      m_wrapper = readFile(dataDir() + "start-IqrfDaemon/javaScript/DaemonWrapper.js");
+      std::ostringstream code;
+      code << m_library << std::endl << m_embedFrc << std::endl << m_sensor << std::endl << m_binaryOutput << std::endl << m_wrapper << std::endl;
+      m_context.loadCode(code.str());
+    }
+
+    /**
+     * Calls both implementations and compares results
+     * @return true if native function handled the call
+     */
+    bool expectParity(const std::string &fname, NativeDrivers::Function function, const json &params) {
+      std::string paramsStr = params.dump();
+      std::string nativeRet;
+      if (!function(paramsStr, nativeRet)) {
+        return false;
+      }
+      std::string jsRet;
+      try {
+        m_context.callFunction(fname, paramsStr, jsRet);
+      } catch (const std::exception &e) {
+        ADD_FAILURE() << "Native function handled call driver fails on: " << e.what() << std::endl << paramsStr;
+        return true;
+      }
+      EXPECT_EQ(jsRet, nativeRet) << paramsStr;
+      return true;
+    }
+
+    /**
+     * Checks that native function declines call
+     */
+    void expectDeclined(NativeDrivers::Function function, const json &params) {
+      std::string ret;
+      EXPECT_FALSE(function(params.dump(), ret)) << params.dump();
+    }
+
+    std::string m_library;
+    std::string m_embedFrc;
+    std::string m_sensor;
+    std::string m_binaryOutput;
+    std::string m_wrapper;
+    Context m_context;
+    std::mt19937 m_random{0x5E};
+  };
+
+  TEST_F(NativeDriversTest, driverHashes) {
+    // native functions are selected only for driver code they were verified against
+    EXPECT_EQ(NativeDrivers::LIBRARY_V0_HASH, sha256(m_library));
+    EXPECT_EQ(NativeDrivers::EMBED_FRC_V0_HASH, sha256(m_embedFrc));
+    EXPECT_EQ(NativeDrivers::SENSOR_V15_HASH, sha256(m_sensor));
+    EXPECT_EQ(NativeDrivers::BINARY_OUTPUT_V4_HASH, sha256(m_binaryOutput));
+    EXPECT_EQ(NativeDrivers::DAEMON_WRAPPER_HASH, sha256(m_wrapper)) << "DaemonWrapper.js changed, verify native drivers and update hash";
+  }
+
+  TEST_F(NativeDriversTest, select) {
+    std::set<std::string> hashes = {NativeDrivers::LIBRARY_V0_HASH, NativeDrivers::SENSOR_V15_HASH, NativeDrivers::DAEMON_WRAPPER_HASH};
+    auto functions = NativeDrivers::select(hashes);
+    EXPECT_EQ(2u, functions->size());
+    EXPECT_EQ(1u, functions->count("iqrf.sensor.ReadSensorsWithTypes_Response_rsp"));
+    EXPECT_EQ(0u, functions->count("iqrf.sensor.Frc_Response_rsp"));
+
+    hashes.insert(NativeDrivers::EMBED_FRC_V0_HASH);
+    hashes.insert(NativeDrivers::BINARY_OUTPUT_V4_HASH);
+    EXPECT_EQ(5u, NativeDrivers::select(hashes)->size());
+
+    hashes.erase(NativeDrivers::DAEMON_WRAPPER_HASH);
+    EXPECT_TRUE(NativeDrivers::select(hashes)->empty());
+  }
+
+  TEST_F(NativeDriversTest, jsonNumber) {
+    std::vector<std::pair<double, std::string>> numbers = {
+      {0, "0"}, {-0.0, "0"}, {22.5, "22.5"}, {-22, "-22"}, {0.1, "0.1"}, {1.0 / 3, "0.3333333333333333"},
+      {1e21, "1e+21"}, {1e20, "100000000000000000000"}, {1e-7, "1e-7"}, {0.000001, "0.000001"},
+      {-1.5e-7, "-1.5e-7"}, {4294967291, "4294967291"}, {NAN, "null"}
+    };
+    for (const auto &[value, expected] : numbers) {
+      std::string out;
+      NativeDrivers::appendJsonNumber(out, value);
+      EXPECT_EQ(expected, out);
+    }
+  }
+
+  TEST_F(NativeDriversTest, sensorEnumerate) {
+    const std::string fname = "iqrf.sensor.Enumerate_Response_rsp";
+    json rsp = response("5e", "be", {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x80, 0x81, 0x82, 0x83, 0xa0, 0xa1, 0xa2, 0xa3, 0xc0});
+    EXPECT_TRUE(expectParity(fname, &NativeDrivers::sensorEnumerate, rsp));
+    rsp["pnum"] = "5E";
+    rsp["pcmd"] = "BE";
+    rsp["rdata"] = "01.80";
+    EXPECT_TRUE(expectParity(fname, &NativeDrivers::sensorEnumerate, rsp));
+
+    // unknown type, error response, malformed data
+    rsp["rdata"] = "01.0a";
+    expectDeclined(&NativeDrivers::sensorEnumerate, rsp);
+    rsp["rdata"] = "01.1g";
+    expectDeclined(&NativeDrivers::sensorEnumerate, rsp);
+    rsp["rdata"] = "01";
+    rsp["rcode"] = "01";
+    expectDeclined(&NativeDrivers::sensorEnumerate, rsp);
+  }
+
+  TEST_F(NativeDriversTest, sensorReadSensorsWithTypes) {
+    const std::string fname = "iqrf.sensor.ReadSensorsWithTypes_Response_rsp";
+    std::vector<uint8_t> twoByteTypes = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13};
+    std::vector<uint8_t> oneByteTypes = {0x80, 0x81, 0x82, 0x83};
+    std::vector<uint8_t> fourByteTypes = {0xa0, 0xa1, 0xa2, 0xa3};
+    std::vector<uint16_t> specialValues = {0x0000, 0x0001, 0x7fff, 0x8000, 0x8001, 0xfffe, 0xffff, 0x0168, 0xfe50};
+    int handled = 0;
+    int declined = 0;
+    auto check = [&](const std::vector<uint8_t> &data) {
+      json rsp = response("5e", "81", data);
+      rsp["originalRequest"] = {{"nadr", "01"}, {"pnum", "5e"}, {"pcmd", "01"}, {"hwpid", "ffff"}, {"rdata", "ff.ff.ff.ff"}};
+      expectParity(fname, &NativeDrivers::sensorReadSensorsWithTypes, rsp) ? ++handled : ++declined;
+    };
+    for (uint8_t type : twoByteTypes) {
+      for (uint16_t value : specialValues) {
+        check({type, static_cast<uint8_t>(value & 0xff), static_cast<uint8_t>(value >> 8)});
+      }
+    }
+    for (uint8_t type : oneByteTypes) {
+      for (int value = 0; value <= 0xff; ++value) {
+        check({type, static_cast<uint8_t>(value)});
+      }
+    }
+    for (uint8_t type : fourByteTypes) {
+      for (uint32_t value : {0x00000000u, 0x00000004u, 0x7fffffffu, 0x80000000u, 0xfffffffeu, 0xffffffffu, 0x12345678u}) {
+        check({type, static_cast<uint8_t>(value), static_cast<uint8_t>(value >> 8), static_cast<uint8_t>(value >> 16), static_cast<uint8_t>(value >> 24)});
+      }
+    }
+    check({0xc0, 0x03, 0x01, 0x02, 0x03, 0x01, 0x68, 0x01});
+    check({});
+    // recorded multi-sensor readings
+    for (int i = 0; i < 500; ++i) {
+      std::vector<uint8_t> data;
+      int count = 1 + m_random() % 6;
+      for (int j = 0; j < count; ++j) {
+        std::vector<uint8_t> types;
+        switch (m_random() % 3) {
+          case 0: types = twoByteTypes; break;
+          case 1: types = oneByteTypes; break;
+          default: types = fourByteTypes; break;
+        }
+        uint8_t type = types[m_random() % types.size()];
+        data.push_back(type);
+        size_t length = (type & 0x80) == 0 ? 2 : (type & 0xe0) == 0x80 ? 1 : 4;
+        for (size_t k = 0; k < length; ++k) {
+          data.push_back(static_cast<uint8_t>(m_random()));
+        }
+      }
+      check(data);
+    }
+    EXPECT_GT(handled, 1000);
+    RecordProperty("handled", handled);
+    RecordProperty("declined", declined);
+
+    // truncated data, CO2 error value the driver fails on
+    expectDeclined(&NativeDrivers::sensorReadSensorsWithTypes, response("5e", "81", {0x01, 0x68}));
+    expectDeclined(&NativeDrivers::sensorReadSensorsWithTypes, response("5e", "81", {0x02, 0x00, 0x80}));
+  }
+
+  TEST_F(NativeDriversTest, sensorFrc) {
+    const std::string fname = "iqrf.sensor.Frc_Response_rsp";
+    struct FrcCase {
+      uint8_t type;
+      uint8_t frcCommand;
+    };
+    std::vector<FrcCase> cases = {
+      {0x01, 0x90}, {0x01, 0xe0}, {0x02, 0x90}, {0x02, 0xe0}, {0x03, 0x90}, {0x03, 0xe0}, {0x04, 0xe0}, {0x05, 0xe0},
+      {0x06, 0xe0}, {0x07, 0xe0}, {0x08, 0xe0}, {0x09, 0xe0}, {0x0b, 0xe0}, {0x0c, 0xe0}, {0x0d, 0xe0}, {0x0e, 0xe0},
+      {0x0f, 0xe0}, {0x10, 0xe0}, {0x11, 0xe0}, {0x12, 0xe0}, {0x13, 0xe0}, {0x80, 0x90}, {0x81, 0x10}, {0x81, 0x90},
+      {0x82, 0x90}, {0x83, 0x90}, {0xa0, 0xf9}
+    };
+    int handled = 0;
+    for (const auto &frcCase : cases) {
+      for (int round = 0; round < 20; ++round) {
+        // FRC send returns status and 55 bytes, extra result 9 bytes
+        std::vector<uint8_t> frcData(64, 0);
+        for (auto &byte : frcData) {
+          // mostly missing nodes, some special FRC values
+          switch (m_random() % 4) {
+            case 0: byte = 0; break;
+            case 1: byte = static_cast<uint8_t>(m_random() % 4); break;
+            default: byte = static_cast<uint8_t>(m_random()); break;
+          }
+        }
+        if (frcCase.frcCommand != 0x10) {
+          // FRC value 3 is rejected by the driver
+          for (auto &byte : frcData) {
+            if (byte == 3) {
+              byte = 4;
+            }
+          }
+        }
+        std::vector<uint8_t> sendData = {0x20};
+        sendData.insert(sendData.end(), frcData.begin(), frcData.begin() + 55);
+        json params = {
+          {"sensorType", frcCase.type},
+          {"frcCommand", frcCase.frcCommand},
+          {"responseFrcSend", response("0d", "80", sendData)},
+        };
+        if (round % 2 == 0) {
+          params["responseFrcExtraResult"] = response("0d", "81", std::vector<uint8_t>(frcData.begin() + 55, frcData.end()));
+        }
+        params["frcSendRequest"] = {{"nadr", "00"}, {"pnum", "0d"}, {"pcmd", "00"}, {"hwpid", "ffff"}, {"rdata", "90.5e.01.00.00"}};
+        if (expectParity(fname, &NativeDrivers::sensorFrc, params)) {
+          ++handled;
+        }
+      }
+    }
+    EXPECT_GT(handled, 400);
+    RecordProperty("handled", handled);
+
+    // unsupported FRC command, FRC value 3, binary data 30 over 2 bytes FRC
+    json params = {{"sensorType", 0x01}, {"frcCommand", 0xf9}, {"responseFrcSend", response("0d", "80", {0x00, 0x00, 0x00})}};
+    expectDeclined(&NativeDrivers::sensorFrc, params);
+    params["frcCommand"] = 0x90;
+    params["responseFrcSend"] = response("0d", "80", {0x00, 0x03});
+    expectDeclined(&NativeDrivers::sensorFrc, params);
+    params = {{"sensorType", 0xa0}, {"frcCommand", 0xe0}, {"responseFrcSend", response("0d", "80", {0x00, 0x00, 0x00, 0x10, 0x00})}};
+    expectDeclined(&NativeDrivers::sensorFrc, params);
+  }
+
+  TEST_F(NativeDriversTest, binaryOutput) {
+    for (int count = 0; count <= 32; count += 4) {
+      EXPECT_TRUE(expectParity("iqrf.binaryoutput.Enumerate_Response_rsp", &NativeDrivers::binaryOutputEnumerate, response("4b", "be", {static_cast<uint8_t>(count)})));
+    }
+    for (uint32_t bitmap : {0x00000000u, 0x00000001u, 0x80000000u, 0xffffffffu, 0x12345678u}) {
+      std::vector<uint8_t> data = {static_cast<uint8_t>(bitmap), static_cast<uint8_t>(bitmap >> 8), static_cast<uint8_t>(bitmap >> 16), static_cast<uint8_t>(bitmap >> 24)};
+      EXPECT_TRUE(expectParity("iqrf.binaryoutput.SetOutput_Response_rsp", &NativeDrivers::binaryOutputSetOutput, response("4b", "80", data)));
+    }
+    expectDeclined(&NativeDrivers::binaryOutputSetOutput, response("4b", "80", {0x00}));
+  }
+
+}
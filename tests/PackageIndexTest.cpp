@@ -0,0 +1,182 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PackageIndex.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+
+using json = nlohmann::json;
+
+namespace iqrf {
+
+  /**
+   * Package fields used by index
+   */
+  struct TestPackage {
+    unsigned int m_packageId;
+    uint16_t m_hwpid;
+    uint16_t m_hwpidVer;
+    std::string m_os;
+    std::string m_dpa;
+  };
+
+  class PackageIndexTest : public ::testing::Test {
+  protected:
+    /**
+     * Loads packages of repository snapshot used by daemon tests
+     */
+    static std::map<unsigned int, TestPackage> loadSnapshot() {
+      std::map<unsigned int, TestPackage> packages;
+      std::string dir = std::string(std::getenv("TESTS_DATA_DIR")) + "../src/tests/TestJsCache/iqrfRepoCache0/packages";
+      for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+        if (!entry.is_directory()) {
+          continue;
+        }
+        std::ifstream file(entry.path() / "data.json");
+        auto doc = json::parse(file);
+        unsigned int id = doc["packageID"];
+        packages.emplace(id, TestPackage{id, doc["hwpid"], doc["hwpidVer"], doc["os"], doc["dpa"]});
+      }
+      return packages;
+    }
+
+    /**
+     * Generates repository of given size, products are spread over OS and DPA combinations
+     */
+    static std::map<unsigned int, TestPackage> generate(unsigned int count) {
+      std::map<unsigned int, TestPackage> packages;
+      for (unsigned int id = 0; id < count; ++id) {
+        char os[5];
+        char dpa[5];
+        std::snprintf(os, sizeof(os), "%04X", 0x08B0 + id % 16);
+        std::snprintf(dpa, sizeof(dpa), "%04x", 0x0300 + id % 32);
+        packages.emplace(id, TestPackage{id, static_cast<uint16_t>(id / 4), static_cast<uint16_t>(id % 4), os, dpa});
+      }
+      return packages;
+    }
+
+    /**
+     * Reference lookup, the same as the cache did before indexing
+     */
+    static const TestPackage *scan(const std::map<unsigned int, TestPackage> &packages, uint16_t hwpid, uint16_t hwpidVer, const std::string &os, const std::string &dpa) {
+      for (const auto &[id, package] : packages) {
+        if (package.m_hwpid == hwpid && package.m_hwpidVer == hwpidVer && package.m_os == os && package.m_dpa == dpa) {
+          return &package;
+        }
+      }
+      return nullptr;
+    }
+  };
+
+  TEST_F(PackageIndexTest, parseVersion) {
+    uint16_t value = 0;
+    EXPECT_TRUE(PackageIndex<TestPackage>::parseVersion("08C8", value));
+    EXPECT_EQ(0x08C8, value);
+    EXPECT_TRUE(PackageIndex<TestPackage>::parseVersion("041a", value));
+    EXPECT_EQ(0x041A, value);
+    EXPECT_FALSE(PackageIndex<TestPackage>::parseVersion("8C8", value));
+    EXPECT_FALSE(PackageIndex<TestPackage>::parseVersion("08G8", value));
+    EXPECT_FALSE(PackageIndex<TestPackage>::parseVersion("", value));
+  }
+
+  TEST_F(PackageIndexTest, snapshotLookups) {
+    auto packages = loadSnapshot();
+    ASSERT_FALSE(packages.empty());
+    PackageIndex<TestPackage> index;
+    index.build(packages);
+    for (const auto &[id, package] : packages) {
+      const TestPackage *expected = scan(packages, package.m_hwpid, package.m_hwpidVer, package.m_os, package.m_dpa);
+      EXPECT_EQ(expected, index.find(package.m_hwpid, package.m_hwpidVer, package.m_os, package.m_dpa));
+      uint16_t os = 0;
+      uint16_t dpa = 0;
+      ASSERT_TRUE(PackageIndex<TestPackage>::parseVersion(package.m_os, os));
+      ASSERT_TRUE(PackageIndex<TestPackage>::parseVersion(package.m_dpa, dpa));
+      EXPECT_EQ(expected, index.find(package.m_hwpid, package.m_hwpidVer, os, dpa));
+
+      // packages of OS and DPA combination are listed in package ID order
+      const auto &list = index.find(package.m_os, package.m_dpa);
+      std::vector<const TestPackage *> expectedList;
+      for (const auto &[otherId, other] : packages) {
+        if (other.m_os == package.m_os && other.m_dpa == package.m_dpa) {
+          expectedList.push_back(&other);
+        }
+      }
+      EXPECT_EQ(expectedList, list);
+    }
+    EXPECT_EQ(nullptr, index.find(0xFFFF, 0xFFFF, "08C8", "0303"));
+    EXPECT_TRUE(index.find("0000", "0000").empty());
+    index.clear();
+    EXPECT_EQ(nullptr, index.find(packages.begin()->second.m_hwpid, packages.begin()->second.m_hwpidVer,
+      packages.begin()->second.m_os, packages.begin()->second.m_dpa));
+  }
+
+  TEST_F(PackageIndexTest, duplicateKeepsFirst) {
+    std::map<unsigned int, TestPackage> packages;
+    packages.emplace(7, TestPackage{7, 1, 0, "08C8", "0303"});
+    packages.emplace(3, TestPackage{3, 1, 0, "08C8", "0303"});
+    packages.emplace(5, TestPackage{5, 1, 0, "08c8", "0303"});
+    PackageIndex<TestPackage> index;
+    index.build(packages);
+    EXPECT_EQ(3u, index.find(1, 0, "08C8", "0303")->m_packageId);
+    EXPECT_EQ(5u, index.find(1, 0, "08c8", "0303")->m_packageId);
+    // numeric lookup does not depend on letter case of package strings
+    EXPECT_EQ(3u, index.find(1, 0, static_cast<uint16_t>(0x08C8), static_cast<uint16_t>(0x0303))->m_packageId);
+    EXPECT_EQ(2u, index.find("08C8", "0303").size());
+  }
+
+  TEST_F(PackageIndexTest, benchmark) {
+    const unsigned int count = 5000;
+    const int lookups = 20000;
+    auto packages = generate(count);
+    PackageIndex<TestPackage> index;
+    auto start = std::chrono::steady_clock::now();
+    index.build(packages);
+    std::chrono::duration<double, std::milli> buildTime = std::chrono::steady_clock::now() - start;
+
+    size_t found = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < lookups; ++i) {
+      const auto &package = packages.at(static_cast<unsigned int>(i * 7919) % count);
+      found += index.find(package.m_hwpid, package.m_hwpidVer, package.m_os, package.m_dpa) != nullptr;
+    }
+    std::chrono::duration<double> indexTime = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(static_cast<size_t>(lookups), found);
+
+    found = 0;
+    const int scans = lookups / 20;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < scans; ++i) {
+      const auto &package = packages.at(static_cast<unsigned int>(i * 7919) % count);
+      found += scan(packages, package.m_hwpid, package.m_hwpidVer, package.m_os, package.m_dpa) != nullptr;
+    }
+    std::chrono::duration<double> scanTime = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(static_cast<size_t>(scans), found);
+
+    RecordProperty("packages", static_cast<int>(count));
+    RecordProperty("indexBuildMs", std::to_string(buildTime.count()));
+    RecordProperty("indexedLookupsPerSecond", std::to_string(static_cast<long>(lookups / indexTime.count())));
+    RecordProperty("scannedLookupsPerSecond", std::to_string(static_cast<long>(scans / scanTime.count())));
+  }
+}
@@ -0,0 +1,121 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelRunner.h"
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace iqrf {
+
+  TEST(ParallelRunnerTest, allTasksOnce) {
+    std::vector<int> results(1000, 0);
+    ParallelRunner(4).run(results.size(), [&](size_t i) {
+      results[i] += static_cast<int>(i);
+    });
+    for (size_t i = 0; i < results.size(); ++i) {
+      EXPECT_EQ(static_cast<int>(i), results[i]);
+    }
+    // no tasks, nothing runs
+    ParallelRunner(4).run(0, [](size_t) {
+      FAIL();
+    });
+  }
+
+  TEST(ParallelRunnerTest, threadsBounded) {
+    std::mutex mtx;
+    int running = 0;
+    int maxRunning = 0;
+    ParallelRunner(3).run(60, [&](size_t) {
+      {
+        std::lock_guard<std::mutex> lock(mtx);
+        maxRunning = std::max(maxRunning, ++running);
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      std::lock_guard<std::mutex> lock(mtx);
+      --running;
+    });
+    EXPECT_LE(maxRunning, 3);
+    EXPECT_LE(1u, ParallelRunner().getThreads());
+  }
+
+  TEST(ParallelRunnerTest, lowestFailureRethrown) {
+    std::vector<int> done(100, 0);
+    try {
+      ParallelRunner(4).run(done.size(), [&](size_t i) {
+        if (i == 70 || i == 30) {
+          throw std::runtime_error(std::to_string(i));
+        }
+        done[i] = 1;
+      });
+      FAIL();
+    } catch (const std::runtime_error &e) {
+      EXPECT_EQ("30", std::string(e.what()));
+    }
+    // failure does not stop other tasks
+    EXPECT_EQ(98, std::count(done.begin(), done.end(), 1));
+  }
+
+  TEST(ParallelRunnerTest, parsePackages) {
+    std::string dir = std::string(std::getenv("TESTS_DATA_DIR")) + "../src/tests/TestJsCache/iqrfRepoCache0/packages";
+    std::vector<std::string> files;
+    for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+      if (entry.is_directory()) {
+        files.emplace_back((entry.path() / "data.json").string());
+      }
+    }
+    // enlarge workload to make timing meaningful
+    std::vector<std::string> workload;
+    for (int i = 0; i < 10; ++i) {
+      workload.insert(workload.end(), files.begin(), files.end());
+    }
+
+    auto parse = [&](unsigned int threads, std::vector<unsigned int> &ids) {
+      ids.assign(workload.size(), 0);
+      auto start = std::chrono::steady_clock::now();
+      ParallelRunner(threads).run(workload.size(), [&](size_t i) {
+        std::ifstream file(workload[i]);
+        ids[i] = json::parse(file)["packageID"];
+      });
+      return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::vector<unsigned int> sequentialIds;
+    std::vector<unsigned int> parallelIds;
+    auto sequential = parse(1, sequentialIds);
+    auto parallel = parse(0, parallelIds);
+    // results are merged by index, order does not depend on scheduling
+    EXPECT_EQ(sequentialIds, parallelIds);
+    RecordProperty("packageFiles", static_cast<int>(workload.size()));
+    RecordProperty("threads", static_cast<int>(ParallelRunner().getThreads()));
+    RecordProperty("sequentialMs", std::to_string(sequential));
+    RecordProperty("parallelMs", std::to_string(parallel));
+  }
+
+}
@@ -0,0 +1,160 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RequestCoalescer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace iqrf {
+
+  class RequestCoalescerTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      m_coalescer.configure(true, {"iqrfDb_GetSensors"});
+    }
+
+    /// Attaches request of client
+    RequestCoalescer::Admission attach(const std::string &key, const MessagingInstance &messaging, const std::string &msgId) {
+      return m_coalescer.attach(key, MTYPE, messaging, msgId);
+    }
+
+    static constexpr const char *MTYPE = "iqrfDb_GetSensors";
+    RequestCoalescer m_coalescer;
+    MessagingInstance m_first = MessagingInstance("ws", "first");
+    MessagingInstance m_second = MessagingInstance("ws", "second");
+  };
+
+  TEST_F(RequestCoalescerTest, coalescable) {
+    EXPECT_TRUE(m_coalescer.isCoalescable(MTYPE));
+    EXPECT_FALSE(m_coalescer.isCoalescable("iqrfDb_Enumerate"));
+    m_coalescer.configure(false, {MTYPE});
+    EXPECT_FALSE(m_coalescer.isCoalescable(MTYPE));
+  }
+
+  TEST_F(RequestCoalescerTest, contentKey) {
+    rapidjson::Document first;
+    first.Parse(R"({"mType":"iqrfDb_GetSensors","data":{"msgId":"1","req":{"a":1,"b":2}}})");
+    rapidjson::Document second;
+    second.Parse(R"({"data":{"req":{"b":2,"a":1},"msgId":"2"},"mType":"iqrfDb_GetSensors"})");
+    rapidjson::Document other;
+    other.Parse(R"({"mType":"iqrfDb_GetSensors","data":{"msgId":"1","req":{"a":1,"b":3}}})");
+    EXPECT_EQ(RequestCoalescer::createKey(first), RequestCoalescer::createKey(second));
+    EXPECT_NE(RequestCoalescer::createKey(first), RequestCoalescer::createKey(other));
+  }
+
+  TEST_F(RequestCoalescerTest, attachAndRelease) {
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_first, "1"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("key", m_second, "7"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("key", m_first, "2"));
+    EXPECT_EQ(1u, m_coalescer.getPendingCount());
+
+    auto waiters = m_coalescer.release(m_first, "1");
+    ASSERT_EQ(2u, waiters.size());
+    EXPECT_EQ(m_second.to_string(), waiters.front().messaging.to_string());
+    EXPECT_EQ("7", waiters.front().msgId);
+    EXPECT_EQ("2", waiters.back().msgId);
+    EXPECT_EQ(MTYPE, waiters.back().mType);
+    EXPECT_EQ(0u, m_coalescer.getPendingCount());
+    // released request no longer collects requesters
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_second, "8"));
+    EXPECT_TRUE(m_coalescer.release(m_first, "1").empty());
+  }
+
+  TEST_F(RequestCoalescerTest, dequeue) {
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_first, "1"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("key", m_second, "1"));
+    m_coalescer.dequeued(m_first, "1");
+    // request being handled may have changed state, identical request is queued again
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_second, "2"));
+    EXPECT_EQ(2u, m_coalescer.getPendingCount());
+    EXPECT_EQ(1u, m_coalescer.release(m_first, "1").size());
+    EXPECT_TRUE(m_coalescer.release(m_second, "2").empty());
+    EXPECT_EQ(0u, m_coalescer.getPendingCount());
+
+    // dequeued request without requesters is not tracked
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_first, "3"));
+    m_coalescer.dequeued(m_first, "3");
+    EXPECT_EQ(0u, m_coalescer.getPendingCount());
+  }
+
+  TEST_F(RequestCoalescerTest, duplicateId) {
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_first, "1"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("key", m_second, "1"));
+    // other request of the same client with the same message ID
+    EXPECT_EQ(RequestCoalescer::Admission::DuplicateId, attach("other", m_first, "1"));
+    m_coalescer.dequeued(m_first, "1");
+    // requesters are still waiting for response of the first request
+    EXPECT_EQ(RequestCoalescer::Admission::DuplicateId, attach("key", m_first, "1"));
+
+    auto waiters = m_coalescer.release(m_first, "1");
+    ASSERT_EQ(1u, waiters.size());
+    EXPECT_EQ(m_second.to_string(), waiters.front().messaging.to_string());
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("other", m_first, "1"));
+  }
+
+  TEST_F(RequestCoalescerTest, releaseByOtherMessageType) {
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_first, "1"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("key", m_second, "1"));
+    EXPECT_TRUE(m_coalescer.isTracked(m_first, "1"));
+    EXPECT_FALSE(m_coalescer.isTracked(m_second, "1"));
+    m_coalescer.dequeued(m_first, "1");
+    // request is answered by response of other message type, e.g. messageError, released by its origin only
+    EXPECT_TRUE(m_coalescer.release(m_second, "1").empty());
+    auto waiters = m_coalescer.release(m_first, "1");
+    ASSERT_EQ(1u, waiters.size());
+    EXPECT_EQ(m_second.to_string(), waiters.front().messaging.to_string());
+    EXPECT_EQ(0u, m_coalescer.getPendingCount());
+  }
+
+  TEST_F(RequestCoalescerTest, releaseBroadcast) {
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_first, "1"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("key", m_second, "2"));
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("other", m_second, "1"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("other", m_first, "3"));
+    // broadcast is not delivered to the second client
+    auto waiters = m_coalescer.releaseBroadcast("1", [&](const MessagingInstance &messaging) {
+      return messaging == m_first;
+    });
+    ASSERT_EQ(1u, waiters.size());
+    EXPECT_EQ("2", waiters.front().msgId);
+    EXPECT_EQ(1u, m_coalescer.getPendingCount());
+    EXPECT_TRUE(m_coalescer.releaseBroadcast("2", [](const MessagingInstance &) { return true; }).empty());
+    EXPECT_EQ(1u, m_coalescer.releaseBroadcast("1", [](const MessagingInstance &) { return true; }).size());
+    EXPECT_EQ(0u, m_coalescer.getPendingCount());
+  }
+
+  TEST_F(RequestCoalescerTest, expire) {
+    EXPECT_EQ(RequestCoalescer::Admission::Queue, attach("key", m_first, "1"));
+    EXPECT_EQ(RequestCoalescer::Admission::Attached, attach("key", m_second, "1"));
+    // queued request does not expire
+    EXPECT_TRUE(m_coalescer.expire(RequestCoalescer::Clock::now() + std::chrono::hours(1)).empty());
+    m_coalescer.dequeued(m_first, "1");
+    EXPECT_TRUE(m_coalescer.expire(RequestCoalescer::Clock::now() - std::chrono::hours(1)).empty());
+    EXPECT_EQ(1u, m_coalescer.getPendingCount());
+
+    auto waiters = m_coalescer.expire(RequestCoalescer::Clock::now() + std::chrono::hours(1));
+    ASSERT_EQ(1u, waiters.size());
+    EXPECT_EQ(m_second.to_string(), waiters.front().messaging.to_string());
+    EXPECT_EQ(MTYPE, waiters.front().mType);
+    EXPECT_EQ(0u, m_coalescer.getPendingCount());
+    // late response has no requesters left
+    EXPECT_TRUE(m_coalescer.release(m_first, "1").empty());
+  }
+
+}
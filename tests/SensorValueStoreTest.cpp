@@ -0,0 +1,96 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SensorValueStore.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using iqrf::db::models::DeviceSensor;
+
+namespace iqrf {
+
+  TEST(SensorValueStoreTest, applyLatestValue) {
+    SensorValueStore store;
+    auto first = std::make_shared<std::string>("2026-01-01T00:00:00Z");
+    auto second = std::make_shared<std::string>("2026-01-01T00:01:00Z");
+    store.set(1, 1, 0, 21.5, first);
+    store.set(1, 1, 0, 22, second);
+    EXPECT_EQ(1u, store.getDirtyCount());
+
+    DeviceSensor sensor(1, 1, 0, 0, 1);
+    EXPECT_TRUE(store.apply(sensor));
+    EXPECT_DOUBLE_EQ(22, sensor.getValue().value());
+    EXPECT_EQ(second, sensor.getUpdated());
+    // same global index of other type
+    DeviceSensor other(1, 2, 0, 0, 2);
+    EXPECT_FALSE(store.apply(other));
+    EXPECT_FALSE(other.getValue().has_value());
+  }
+
+  TEST(SensorValueStoreTest, takeDirty) {
+    SensorValueStore store;
+    store.set(1, 1, 0, 1, nullptr);
+    store.set(2, 1, 0, 2, nullptr);
+    auto dirty = store.takeDirty();
+    ASSERT_EQ(2u, dirty.size());
+    EXPECT_EQ(0u, store.getDirtyCount());
+    EXPECT_FALSE(store.getOldestDirty().has_value());
+    EXPECT_TRUE(store.takeDirty().empty());
+
+    // clean values are still served until evicted
+    DeviceSensor sensor(2, 1, 0, 0, 1);
+    EXPECT_TRUE(store.apply(sensor));
+    EXPECT_DOUBLE_EQ(2, sensor.getValue().value());
+    store.set(1, 1, 0, 3, nullptr);
+    store.evictClean();
+    EXPECT_FALSE(store.apply(sensor));
+    EXPECT_EQ(1u, store.getDirtyCount());
+  }
+
+  TEST(SensorValueStoreTest, restoreDirty) {
+    SensorValueStore store;
+    store.set(1, 1, 0, 1, nullptr);
+    store.set(2, 1, 0, 2, nullptr);
+    auto since = store.getOldestDirty();
+    auto dirty = store.takeDirty();
+    // overwritten during failed write
+    store.set(2, 1, 0, 5, nullptr);
+    store.restoreDirty(dirty);
+    EXPECT_EQ(2u, store.getDirtyCount());
+    EXPECT_EQ(since, store.getOldestDirty());
+
+    dirty = store.takeDirty();
+    ASSERT_EQ(2u, dirty.size());
+    for (const auto &item : dirty) {
+      EXPECT_DOUBLE_EQ(item.address == 2 ? 5 : 1, item.value);
+    }
+    // value set again and written since is not marked dirty by older failed write
+    store.set(1, 1, 0, 7, nullptr);
+    store.takeDirty();
+    store.restoreDirty(dirty);
+    dirty = store.takeDirty();
+    ASSERT_EQ(1u, dirty.size());
+    EXPECT_EQ(2, dirty[0].address);
+    store.clear();
+    DeviceSensor sensor(1, 1, 0, 0, 1);
+    EXPECT_FALSE(store.apply(sensor));
+  }
+
+}
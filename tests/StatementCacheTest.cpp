@@ -0,0 +1,162 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <repositories/device_sensor_repo.hpp>
+#include <repositories/statement_cache.hpp>
+
+#include <gtest/gtest.h>
+#include <SQLiteCpp/SQLiteCpp.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using iqrf::db::models::DeviceSensor;
+using iqrf::db::repos::DeviceSensorRepository;
+using iqrf::db::repos::StatementCache;
+
+namespace iqrf {
+
+  class StatementCacheTest : public ::testing::Test {
+  protected:
+    static constexpr uint8_t NODES = 239;
+    static constexpr uint8_t SENSORS = 32;
+
+    void SetUp() override {
+      m_db = std::make_shared<SQLite::Database>(":memory:", SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE);
+      m_db->exec(R"(
+        CREATE TABLE "sensor" (
+          "id" INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL,
+          "type" INTEGER NOT NULL,
+          "name" TEXT NOT NULL,
+          "shortname" TEXT NOT NULL,
+          "unit" TEXT NOT NULL,
+          "decimals" INTEGER NOT NULL,
+          "frc2Bit" INTEGER NOT NULL,
+          "frc1Byte" INTEGER NOT NULL,
+          "frc2Byte" INTEGER NOT NULL,
+          "frc4Byte" INTEGER NOT NULL,
+          UNIQUE("type", "name")
+        );
+        CREATE TABLE "deviceSensor" (
+          "address" INTEGER NOT NULL,
+          "type" INTEGER NOT NULL,
+          "globalIndex" INTEGER NOT NULL,
+          "typeIndex" INTEGER NOT NULL,
+          "sensorId" INTEGER NOT NULL,
+          "value" REAL,
+          "updated" TEXT,
+          "metadata" TEXT,
+          FOREIGN KEY("sensorId") REFERENCES "sensor"("id"),
+          PRIMARY KEY("address", "type", "globalIndex")
+        );
+      )");
+      SQLite::Transaction transaction(*m_db);
+      for (uint8_t i = 0; i < SENSORS; ++i) {
+        m_db->exec("INSERT INTO sensor (type, name, shortname, unit, decimals, frc2Bit, frc1Byte, frc2Byte, frc4Byte)"
+          " VALUES (" + std::to_string(i + 1) + ", 'sensor', 's', 'u', 1, 0, 1, 1, 0);");
+      }
+      DeviceSensorRepository repo(m_db);
+      for (uint8_t addr = 1; addr <= NODES; ++addr) {
+        for (uint8_t i = 0; i < SENSORS; ++i) {
+          repo.insert(DeviceSensor(addr, i + 1, i, 0, i + 1));
+        }
+      }
+      transaction.commit();
+    }
+
+    /// Reads and updates every sensor of every node, returns run time
+    int64_t readUpdateAll(DeviceSensorRepository &repo, double value) {
+      auto start = std::chrono::steady_clock::now();
+      for (uint8_t addr = 1; addr <= NODES; ++addr) {
+        for (uint8_t i = 0; i < SENSORS; ++i) {
+          auto sensor = repo.getByAddressTypeIndex(addr, i + 1, i, false);
+          sensor->setValue(value + i);
+          repo.update(*sensor);
+        }
+      }
+      return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::shared_ptr<SQLite::Database> m_db;
+  };
+
+  TEST_F(StatementCacheTest, reusesStatements) {
+    auto cache = std::make_shared<StatementCache>(m_db);
+    DeviceSensorRepository repo(m_db, cache);
+    auto first = repo.getByAddressTypeIndex(5, 3, 2, false);
+    auto second = repo.getByAddressTypeIndex(7, 4, 3, false);
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    EXPECT_EQ(5, first->getAddress());
+    EXPECT_EQ(7, second->getAddress());
+    EXPECT_EQ(3, second->getGlobalIndex());
+    // bindings are not carried over to next use
+    EXPECT_EQ(nullptr, repo.getByAddressTypeIndex(240, 3, 2, false));
+    EXPECT_EQ(1u, cache->getPrepared());
+    EXPECT_EQ(2u, cache->getReused());
+  }
+
+  TEST_F(StatementCacheTest, nestedUse) {
+    auto cache = std::make_shared<StatementCache>(m_db);
+    DeviceSensorRepository repo(m_db, cache);
+    auto map = repo.getDeviceAddressSensorMap();
+    ASSERT_EQ(NODES, map.size());
+    EXPECT_EQ(SENSORS, map[NODES].size());
+    // outer statement is lent while inner statement is reused for each row
+    EXPECT_EQ(2u, cache->getPrepared());
+
+    auto lease = cache->acquire("SELECT 1;");
+    auto nested = cache->acquire("SELECT 1;");
+    EXPECT_NE(&*lease, &*nested);
+    EXPECT_EQ(4u, cache->getPrepared());
+  }
+
+  TEST_F(StatementCacheTest, reuseAfterError) {
+    auto cache = std::make_shared<StatementCache>(m_db);
+    DeviceSensorRepository repo(m_db, cache);
+    EXPECT_THROW(repo.insert(DeviceSensor(1, 1, 0, 0, 1)), std::runtime_error);
+    EXPECT_NO_THROW(repo.insert(DeviceSensor(NODES + 1, 1, 0, 0, 1)));
+    EXPECT_EQ(1u, cache->getPrepared());
+    EXPECT_NE(nullptr, repo.getByAddressTypeIndex(NODES + 1, 1, 0, false));
+  }
+
+  TEST_F(StatementCacheTest, otherConnection) {
+    auto other = std::make_shared<SQLite::Database>(":memory:", SQLite::OPEN_READWRITE | SQLite::OPEN_CREATE);
+    auto cache = std::make_shared<StatementCache>(other);
+    EXPECT_THROW(DeviceSensorRepository(m_db, cache), std::invalid_argument);
+  }
+
+  TEST_F(StatementCacheTest, readUpdateBenchmark) {
+    DeviceSensorRepository uncachedRepo(m_db);
+    auto uncachedTime = readUpdateAll(uncachedRepo, 1);
+
+    auto cache = std::make_shared<StatementCache>(m_db);
+    DeviceSensorRepository cachedRepo(m_db, cache);
+    auto cachedTime = readUpdateAll(cachedRepo, 2);
+    EXPECT_EQ(2u, cache->getPrepared());
+
+    auto sensor = cachedRepo.getByAddressTypeIndex(NODES, SENSORS, SENSORS - 1, false);
+    ASSERT_NE(nullptr, sensor);
+    EXPECT_DOUBLE_EQ(2 + SENSORS - 1, sensor->getValue().value());
+    RecordProperty("sensors", static_cast<int>(NODES * SENSORS));
+    RecordProperty("preparedUs", std::to_string(uncachedTime));
+    RecordProperty("cachedUs", std::to_string(cachedTime));
+  }
+
+}
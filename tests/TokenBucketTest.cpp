@@ -0,0 +1,56 @@
+/**
+ * Copyright 2015-2026 IQRF Tech s.r.o.
+ * Copyright 2019-2026 MICRORISC s.r.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "TokenBucket.h"
+
+namespace token_bucket_test {
+
+using namespace std::chrono_literals;
+
+TEST(TokenBucketTest, UnlimitedTest) {
+  TokenBucket bucket;
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_TRUE(bucket.tryConsume());
+  }
+}
+
+TEST(TokenBucketTest, BurstTest) {
+  auto now = TokenBucket::Clock::now();
+  TokenBucket bucket(1, 3, now);
+  EXPECT_TRUE(bucket.tryConsume(now));
+  EXPECT_TRUE(bucket.tryConsume(now));
+  EXPECT_TRUE(bucket.tryConsume(now));
+  EXPECT_FALSE(bucket.tryConsume(now));
+}
+
+TEST(TokenBucketTest, RefillTest) {
+  auto now = TokenBucket::Clock::now();
+  TokenBucket bucket(2, 2, now);
+  EXPECT_TRUE(bucket.tryConsume(now));
+  EXPECT_TRUE(bucket.tryConsume(now));
+  EXPECT_FALSE(bucket.tryConsume(now));
+
+  EXPECT_FALSE(bucket.tryConsume(now + 250ms));
+  EXPECT_TRUE(bucket.tryConsume(now + 500ms));
+  EXPECT_FALSE(bucket.tryConsume(now + 500ms));
+
+  // refill is capped by burst
+  EXPECT_DOUBLE_EQ(bucket.getTokens(now + 10s), 2);
+}
+
+}